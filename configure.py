@@ -24,8 +24,8 @@ if target.is_linux():
   extralibs += ['X11', 'Xext', 'GL']
 
 lua_lib = generator.lib(module = 'lua', sources = [
-  'bind.c', 'call.c', 'compile.c', 'eval.c', 'event.c', 'foundation.c', 'import.c', 'lua.c', 'module.c', 'network.c',
-  'read.c', 'resource.c', 'symbol.c', 'version.c', 'window.c'])
+  'archive.c', 'bind.c', 'call.c', 'compile.c', 'compress.c', 'embedded.c', 'eval.c', 'event.c', 'foundation.c', 'heap.c', 'import.c', 'jobs.c', 'lua.c', 'module.c', 'network.c',
+  'profile.c', 'read.c', 'resource.c', 'subenv.c', 'symbol.c', 'template.c', 'version.c', 'window.c'])
 
 if not target.is_ios() and not target.is_android():
   configs = [config for config in toolchain.configs if config not in ['profile', 'deploy']]
@@ -35,6 +35,8 @@ if not target.is_ios() and not target.is_android():
     generator.bin('luaimport', ['main.c'], 'luaimport', basepath = 'tools', implicit_deps = [lua_lib], dependlibs = dependlibs, libs = ['luajit'] + extralibs, configs = configs, variables = extravariables)
     generator.bin('luacompile', ['main.c'], 'luacompile', basepath = 'tools', implicit_deps = [lua_lib], dependlibs = dependlibs, libs = ['luajit'] + extralibs, configs = configs, variables = extravariables)
     generator.bin('', ['luacompile/main.c'], 'luacompile32', basepath = 'tools', implicit_deps = [lua_lib], dependlibs = dependlibs, libs = ['luajit32'] + extralibs, configs = configs, variables = dict({'support_lua': True}, **extravariables))
+    generator.bin('luaembed', ['main.c'], 'luaembed', basepath = 'tools', implicit_deps = [lua_lib], dependlibs = dependlibs, libs = ['luajit'] + extralibs, configs = configs, variables = extravariables)
+    generator.bin('', ['luaembed/main.c'], 'luaembed32', basepath = 'tools', implicit_deps = [lua_lib], dependlibs = dependlibs, libs = ['luajit32'] + extralibs, configs = configs, variables = dict({'support_lua': True}, **extravariables))
 
 #No test cases if we're a submodule
 if generator.is_subninja():
@@ -54,7 +56,7 @@ if target.is_linux():
   gllibs = ['Xxf86vm', 'Xext', 'X11', 'GL']
 
 test_cases = [
-  'bind', 'foundation', 'network', 'render', 'resource', 'window'
+  'bind', 'foundation', 'lua', 'network', 'render', 'resource', 'window'
 ]
 if target.is_ios() or target.is_android():
   #Build one fat binary with all test cases
@@ -0,0 +1,390 @@
+/* archive.c  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#include <lua/lua.h>
+
+#include <foundation/foundation.h>
+#include <resource/platform.h>
+#include <resource/import.h>
+
+/* Archive layout, all values in stream byte order:
+   uint32 magic, uint32 version, uint32 entry count,
+   entries of uint64 uuid words, uint64 platform, uint64 offset, uint64 size, uint64 checksum,
+   bytecode of each entry at its offset from start of file */
+
+#define LUA_ARCHIVE_HEADER_SIZE (sizeof(uint32_t) * 3)
+#define LUA_ARCHIVE_ENTRY_SIZE (sizeof(uint64_t) * 6)
+
+struct lua_archive_entry_t {
+	uuid_t uuid;
+	uint64_t platform;
+	uint64_t offset;
+	uint64_t size;
+	hash_t checksum;
+	//! Bytecode in archive data
+	const void* bytecode;
+	//! Script a built-in module was compiled from, relative to the import base path
+	string_const_t script;
+	//! Digest of the script a built-in module was compiled from
+	uint256_t source;
+	//! Checksum or script verified on first load
+	bool verified;
+	//! Module was invalidated, load from resource streams instead
+	bool shadowed;
+};
+typedef struct lua_archive_entry_t lua_archive_entry_t;
+
+struct lua_archive_t {
+	atomic32_t ref;
+	string_t path;
+	//! Data following the index, null if bytecode is static data
+	const void* data;
+	size_t count;
+	lua_archive_entry_t entry[];
+};
+
+static lua_archive_t** _lua_archives;
+static mutex_t* _lua_archive_lock;
+
+LUA_EXTERN int
+lua_archive_initialize(void);
+
+LUA_EXTERN void
+lua_archive_finalize(void);
+
+LUA_EXTERN bool
+lua_archive_mount_static(const char* name, size_t length, const uuid_t* uuids, const void* const* bytecode,
+                         const size_t* sizes, const string_const_t* scripts, const uint256_t* sources,
+                         size_t count);
+
+LUA_EXTERN lua_module_t*
+lua_archive_load(const uuid_t uuid, uint64_t platform);
+
+LUA_EXTERN void
+lua_archive_shadow(const uuid_t uuid);
+
+LUA_EXTERN void
+lua_archive_release(lua_archive_t* archive);
+
+LUA_EXTERN lua_module_t*
+lua_module_load_resource(const uuid_t uuid, uint64_t platform, bool map, unsigned int* opened);
+
+LUA_EXTERN void
+lua_module_release(lua_module_t* module);
+
+int
+lua_archive_initialize(void) {
+	_lua_archive_lock = mutex_allocate(STRING_CONST("lua-archive"));
+	return 0;
+}
+
+void
+lua_archive_finalize(void) {
+	for (size_t iarch = 0, asize = array_size(_lua_archives); iarch < asize; ++iarch)
+		lua_archive_release(_lua_archives[iarch]);
+	array_deallocate(_lua_archives);
+	mutex_deallocate(_lua_archive_lock);
+	_lua_archive_lock = nullptr;
+}
+
+void
+lua_archive_release(lua_archive_t* archive) {
+	if (archive && !atomic_decr32(&archive->ref, memory_order_release)) {
+		memory_deallocate((void*)archive->data);
+		string_deallocate(archive->path.str);
+		memory_deallocate(archive);
+	}
+}
+
+bool
+lua_archive_write(stream_t* stream, const uuid_t* uuids, const uint64_t* platforms, size_t count) {
+	lua_module_t** modules = nullptr;
+	bool success = true;
+
+	for (size_t imod = 0; success && (imod < count); ++imod) {
+		lua_module_t* module = lua_module_load_resource(uuids[imod], platforms[imod], false, nullptr);
+		if (module) {
+			array_push(modules, module);
+		}
+		else {
+			string_const_t uuidstr = string_from_uuid_static(uuids[imod]);
+			log_warnf(HASH_LUA, WARNING_INVALID_VALUE, STRING_CONST("Unable to load module for archive: %.*s"),
+			          STRING_FORMAT(uuidstr));
+			success = false;
+		}
+	}
+
+	if (success) {
+		stream_write_uint32(stream, LUA_ARCHIVE_MAGIC);
+		stream_write_uint32(stream, LUA_ARCHIVE_VERSION);
+		stream_write_uint32(stream, (uint32_t)count);
+
+		uint64_t offset = LUA_ARCHIVE_HEADER_SIZE + (count * LUA_ARCHIVE_ENTRY_SIZE);
+		for (size_t imod = 0; imod < count; ++imod) {
+			stream_write_uint64(stream, uuids[imod].word[0]);
+			stream_write_uint64(stream, uuids[imod].word[1]);
+			stream_write_uint64(stream, platforms[imod]);
+			stream_write_uint64(stream, offset);
+			stream_write_uint64(stream, modules[imod]->size);
+			stream_write_uint64(stream, hash(modules[imod]->bytecode, modules[imod]->size));
+			offset += modules[imod]->size;
+		}
+
+		for (size_t imod = 0; success && (imod < count); ++imod)
+			success = (stream_write(stream, modules[imod]->bytecode, modules[imod]->size) == modules[imod]->size);
+	}
+
+	for (size_t imod = 0, msize = array_size(modules); imod < msize; ++imod)
+		lua_module_release(modules[imod]);
+	array_deallocate(modules);
+
+	return success;
+}
+
+static lua_archive_t*
+lua_archive_open(const char* path, size_t length) {
+	stream_t* stream = stream_open(path, length, STREAM_IN | STREAM_BINARY);
+	if (!stream)
+		return nullptr;
+
+	size_t total = stream_size(stream);
+	uint32_t magic = stream_read_uint32(stream);
+	uint32_t version = stream_read_uint32(stream);
+	size_t count = stream_read_uint32(stream);
+	size_t data_offset = LUA_ARCHIVE_HEADER_SIZE + (count * LUA_ARCHIVE_ENTRY_SIZE);
+	if ((magic != LUA_ARCHIVE_MAGIC) || (version != LUA_ARCHIVE_VERSION) || (data_offset > total)) {
+		log_warnf(HASH_LUA, WARNING_INVALID_VALUE, STRING_CONST("Invalid module archive: %.*s"),
+		          (int)length, path);
+		stream_deallocate(stream);
+		return nullptr;
+	}
+
+	lua_archive_t* archive = memory_allocate(HASH_LUA, sizeof(lua_archive_t) + (count * sizeof(lua_archive_entry_t)),
+	                                         0, MEMORY_PERSISTENT | MEMORY_ZERO_INITIALIZED);
+	archive->count = count;
+	atomic_store32(&archive->ref, 1, memory_order_relaxed);
+
+	bool valid = true;
+	for (size_t ientry = 0; ientry < count; ++ientry) {
+		lua_archive_entry_t* entry = archive->entry + ientry;
+		entry->uuid.word[0] = stream_read_uint64(stream);
+		entry->uuid.word[1] = stream_read_uint64(stream);
+		entry->platform = stream_read_uint64(stream);
+		entry->offset = stream_read_uint64(stream);
+		entry->size = stream_read_uint64(stream);
+		entry->checksum = stream_read_uint64(stream);
+		if (!entry->size || (entry->offset < data_offset) || (entry->offset > total) ||
+		        (entry->size > total - entry->offset))
+			valid = false;
+	}
+
+	//All bytecode is read in one go. Not mapped, the archive stays mounted while the file on disk
+	//can be replaced or truncated by a rebuild
+	size_t data_size = total - data_offset;
+	if (valid && data_size) {
+		void* buffer = memory_allocate(HASH_LUA, data_size, 0, MEMORY_PERSISTENT);
+		archive->data = buffer;
+		valid = (stream_read(stream, buffer, data_size) == data_size);
+	}
+	stream_deallocate(stream);
+
+	for (size_t ientry = 0; valid && (ientry < count); ++ientry) {
+		lua_archive_entry_t* entry = archive->entry + ientry;
+		entry->bytecode = pointer_offset_const(archive->data, entry->offset - data_offset);
+	}
+
+	if (!valid) {
+		log_warnf(HASH_LUA, WARNING_INVALID_VALUE, STRING_CONST("Corrupt module archive: %.*s"),
+		          (int)length, path);
+		lua_archive_release(archive);
+		return nullptr;
+	}
+
+	archive->path = string_clone(path, length);
+	return archive;
+}
+
+bool
+lua_archive_mount(const char* path, size_t length) {
+	lua_archive_t* archive = lua_archive_open(path, length);
+	if (!archive)
+		return false;
+
+	mutex_lock(_lua_archive_lock);
+	array_insert(_lua_archives, 0, archive);
+	mutex_unlock(_lua_archive_lock);
+
+	log_debugf(HASH_LUA, STRING_CONST("Mounted module archive with %" PRIsize " modules: %.*s"),
+	           archive->count, (int)length, path);
+	return true;
+}
+
+void
+lua_archive_unmount(const char* path, size_t length) {
+	lua_archive_t* archive = nullptr;
+	mutex_lock(_lua_archive_lock);
+	for (size_t iarch = 0, asize = array_size(_lua_archives); iarch < asize; ++iarch) {
+		if (string_equal(STRING_ARGS(_lua_archives[iarch]->path), path, length)) {
+			archive = _lua_archives[iarch];
+			array_erase_ordered(_lua_archives, iarch);
+			break;
+		}
+	}
+	mutex_unlock(_lua_archive_lock);
+	lua_archive_release(archive);
+}
+
+/* Bytecode linked into the executable is mounted with the lowest precedence and checked against
+   the script it was compiled from on first load, scripts are static data outliving the archive */
+bool
+lua_archive_mount_static(const char* name, size_t length, const uuid_t* uuids, const void* const* bytecode,
+                         const size_t* sizes, const string_const_t* scripts, const uint256_t* sources,
+                         size_t count) {
+	lua_archive_t* archive = memory_allocate(HASH_LUA, sizeof(lua_archive_t) + (count * sizeof(lua_archive_entry_t)),
+	                                         0, MEMORY_PERSISTENT | MEMORY_ZERO_INITIALIZED);
+	archive->count = count;
+	archive->path = string_clone(name, length);
+	atomic_store32(&archive->ref, 1, memory_order_relaxed);
+	for (size_t ientry = 0; ientry < count; ++ientry) {
+		lua_archive_entry_t* entry = archive->entry + ientry;
+		entry->uuid = uuids[ientry];
+		entry->platform = RESOURCE_PLATFORM_ALL;
+		entry->size = sizes[ientry];
+		entry->bytecode = bytecode[ientry];
+		entry->script = scripts[ientry];
+		entry->source = sources[ientry];
+		entry->verified = !entry->script.length;
+	}
+
+	lua_archive_unmount(name, length);
+
+	mutex_lock(_lua_archive_lock);
+	array_push(_lua_archives, archive);
+	mutex_unlock(_lua_archive_lock);
+
+	log_debugf(HASH_LUA, STRING_CONST("Mounted static module archive with %" PRIsize " modules: %.*s"),
+	           count, (int)length, name);
+	return true;
+}
+
+//Stale if the script differs from the one embedded, trusted if scripts are not deployed
+static bool
+lua_archive_verify_script(const lua_archive_entry_t* entry) {
+#if RESOURCE_ENABLE_LOCAL_SOURCE
+	string_const_t base_path = resource_import_base_path();
+	if (!base_path.length)
+		return true;
+
+	char buffer[BUILD_MAX_PATHLEN];
+	string_t path = path_concat(buffer, sizeof(buffer), STRING_ARGS(base_path), STRING_ARGS(entry->script));
+	stream_t* stream = stream_open(STRING_ARGS(path), STREAM_IN | STREAM_BINARY);
+	if (!stream)
+		return true;
+	uint256_t source = stream_sha256(stream);
+	stream_deallocate(stream);
+	return uint256_equal(source, entry->source);
+#else
+	FOUNDATION_UNUSED(entry);
+	return true;
+#endif
+}
+
+size_t
+lua_archive_count(void) {
+	mutex_lock(_lua_archive_lock);
+	size_t count = array_size(_lua_archives);
+	mutex_unlock(_lua_archive_lock);
+	return count;
+}
+
+//Most specific entry for the platform in the most recently mounted archive holding the module
+lua_module_t*
+lua_archive_load(const uuid_t uuid, uint64_t platform) {
+	lua_archive_t* archive = nullptr;
+	lua_archive_entry_t* entry = nullptr;
+
+	mutex_lock(_lua_archive_lock);
+	for (size_t iarch = 0, asize = array_size(_lua_archives); !entry && (iarch < asize); ++iarch) {
+		lua_archive_t* candidate = _lua_archives[iarch];
+		for (size_t ientry = 0; ientry < candidate->count; ++ientry) {
+			lua_archive_entry_t* current = candidate->entry + ientry;
+			if (!uuid_equal(current->uuid, uuid) ||
+			        !resource_platform_is_equal_or_more_specific(platform, current->platform))
+				continue;
+			if (!entry || resource_platform_is_equal_or_more_specific(current->platform, entry->platform))
+				entry = current;
+		}
+		if (entry) {
+			archive = candidate;
+			if (entry->shadowed) {
+				entry = nullptr;
+				archive = nullptr;
+				break;
+			}
+			if (!entry->verified) {
+				if (archive->data) {
+					entry->verified = (hash(entry->bytecode, entry->size) == entry->checksum);
+					if (!entry->verified)
+						log_warnf(HASH_LUA, WARNING_INVALID_VALUE, STRING_CONST("Module data checksum mismatch in archive: %.*s"),
+						          STRING_FORMAT(archive->path));
+				}
+				else {
+					entry->verified = lua_archive_verify_script(entry);
+					if (!entry->verified)
+						log_warnf(HASH_LUA, WARNING_INVALID_VALUE, STRING_CONST("Built-in module is stale, script changed: %.*s"),
+						          STRING_FORMAT(entry->script));
+				}
+				if (!entry->verified) {
+					entry->shadowed = true;
+					entry = nullptr;
+					archive = nullptr;
+					break;
+				}
+			}
+			atomic_incr32(&archive->ref, memory_order_relaxed);
+		}
+	}
+	mutex_unlock(_lua_archive_lock);
+
+	if (!entry)
+		return nullptr;
+
+	//Module references the archive data instead of owning a mapping or copy
+	lua_module_t* module = memory_allocate(HASH_LUA, sizeof(lua_module_t), 0,
+	                                       MEMORY_PERSISTENT | MEMORY_ZERO_INITIALIZED);
+	module->uuid = uuid;
+	module->platform = platform;
+	module->version = LUA_RESOURCE_MODULE_VERSION;
+	module->size = entry->size;
+	module->bytecode = entry->bytecode;
+	module->archive = archive;
+	atomic_store32(&module->ref, 1, memory_order_relaxed);
+	return module;
+}
+
+//Invalidated modules have changed since the archive was written
+void
+lua_archive_shadow(const uuid_t uuid) {
+	if (!_lua_archive_lock)
+		return;
+	mutex_lock(_lua_archive_lock);
+	for (size_t iarch = 0, asize = array_size(_lua_archives); iarch < asize; ++iarch) {
+		lua_archive_t* archive = _lua_archives[iarch];
+		for (size_t ientry = 0; ientry < archive->count; ++ientry) {
+			if (uuid_equal(archive->entry[ientry].uuid, uuid))
+				archive->entry[ientry].shadowed = true;
+		}
+	}
+	mutex_unlock(_lua_archive_lock);
+}
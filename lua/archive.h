@@ -0,0 +1,71 @@
+/* archive.h  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#pragma once
+
+/*! \file archive.h
+    Packed archives of compiled Lua modules */
+
+#include <foundation/platform.h>
+
+#include <lua/types.h>
+
+/*! Write an archive packing the compiled bytecode of the given modules behind an index of
+uuid, platform, offset, size and checksum. Modules are loaded from their compiled resources.
+\param stream Output stream
+\param uuids Modules to pack
+\param platforms Platform of each module, RESOURCE_PLATFORM_ALL matches any platform on load
+\param count Number of modules
+\return true if successful, false if any module could not be loaded or written */
+LUA_API bool
+lua_archive_write(stream_t* stream, const uuid_t* uuids, const uint64_t* platforms, size_t count);
+
+/*! Mount an archive. The file is opened and read once, so it can be rebuilt while mounted,
+module loads then consult mounted archives before individual resource streams. The most
+recently mounted archive takes precedence.
+\param path Archive file path
+\param length Length of path
+\return true if successful, false if the file could not be opened or is not a valid archive */
+LUA_API bool
+lua_archive_mount(const char* path, size_t length);
+
+/*! Mount the bytecode of the built-in foundation, network, resource and window modules linked
+into the library (see BUILD_ENABLE_LUA_EMBEDDED_MODULES) as an archive named LUA_ARCHIVE_EMBEDDED.
+Done by lua_module_initialize unless disabled in config. The embedded archive has lower precedence
+than all other mounted archives, and modules modified in the resource system are loaded from
+resources instead. So are modules whose script under the import base path differs from the
+script the embedded bytecode was compiled from, checked on first load.
+\return true if successful, false if the library was built without embedded modules */
+LUA_API bool
+lua_archive_mount_embedded(void);
+
+/*! Unmount an archive. Modules already loaded from the archive stay valid.
+\param path Archive file path given to lua_archive_mount, or LUA_ARCHIVE_EMBEDDED
+\param length Length of path */
+LUA_API void
+lua_archive_unmount(const char* path, size_t length);
+
+/*! Get number of mounted archives
+\return Number of mounted archives */
+LUA_API size_t
+lua_archive_count(void);
+
+//! Archive file identifier, "LUAA"
+#define LUA_ARCHIVE_MAGIC 0x4141554C
+
+//! Archive file format version
+#define LUA_ARCHIVE_VERSION 1
+
+//! Name of the archive of built-in modules mounted by lua_archive_mount_embedded
+#define LUA_ARCHIVE_EMBEDDED "lua-embedded"
@@ -74,7 +74,7 @@ lua_bind_function(lua_t* env, const char* method, size_t length, lua_fn fn) {
 		op.data.name = method;
 		op.size = length;
 		op.arg.value[0].fn = fn;
-		lua_push_op(env, &op);
+		lua_push_op(env, &op, true);
 		return LUA_QUEUED;
 	}
 	lua_value_t val = { .fn = fn };
@@ -97,7 +97,7 @@ lua_bind_int(lua_t* env, const char* property, size_t length, int value) {
 		op.data.name = property;
 		op.size = length;
 		op.arg.value[0].ival = value;
-		lua_push_op(env, &op);
+		lua_push_op(env, &op, true);
 		return LUA_QUEUED;
 	}
 	lua_value_t val = { .ival = value };
@@ -120,7 +120,7 @@ lua_bind_real(lua_t* env, const char* property, size_t length, real value) {
 		op.data.name = property;
 		op.size = length;
 		op.arg.value[0].val = value;
-		lua_push_op(env, &op);
+		lua_push_op(env, &op, true);
 		return LUA_QUEUED;
 	}
 	lua_value_t val = { .val = value };
@@ -29,11 +29,80 @@ on a lua state to one thread at a time. */
 #define BUILD_ENABLE_LUA_THREAD_SAFE 0
 
 /*! \def BUILD_LUA_CALL_QUEUE_SIZE
-Number of calls that can be queued while synchronizing thread execution. Only used
-if BUILD_ENABLE_LUA_THREAD_SAFE is set. */
+Number of calls that can be queued while synchronizing thread execution, one less can
+be pending at a time. Queueing on a full queue blocks until the state is free and drains
+the queue. Only used if BUILD_ENABLE_LUA_THREAD_SAFE is set. */
 #define BUILD_LUA_CALL_QUEUE_SIZE  256
 
+/*! \def BUILD_ENABLE_LUA_EMBEDDED_MODULES
+Control if bytecode of the built-in foundation, network, resource and window modules is linked
+into the library and served from memory before the resource system. The bytecode is generated
+by the luaembed tool into lua/embedded_fr2.h and lua/embedded_compat.h, and is little endian. */
+#define BUILD_ENABLE_LUA_EMBEDDED_MODULES FOUNDATION_ARCH_ENDIAN_LITTLE
+
+/*! \def BUILD_LUA_PROFILE_INTERVAL
+Default number of bytes allocated between each sample when profiling allocations. */
+#define BUILD_LUA_PROFILE_INTERVAL 16384
+
+/*! \def BUILD_LUA_PROFILE_DEPTH
+Maximum number of call frames captured per allocation sample. */
+#define BUILD_LUA_PROFILE_DEPTH 32
+
+/*! \def BUILD_LUA_TEMPLATE_RESERVE
+Default number of ready Lua environments kept in reserve by a template. */
+#define BUILD_LUA_TEMPLATE_RESERVE 4
+
+/*! \def BUILD_LUA_MAP_MINIMUM_SIZE
+Minimum size of bytecode blobs loaded from local files by memory mapping instead of reading.
+Smaller blobs are cheaper to copy than to map. */
+#define BUILD_LUA_MAP_MINIMUM_SIZE 65536
+
+/*! \def BUILD_LUA_EVAL_CACHE_CAPACITY
+Default maximum number of compiled chunks kept per state by lua_eval_string. */
+#define BUILD_LUA_EVAL_CACHE_CAPACITY 256
+
+/*! \def BUILD_LUA_EVAL_CACHE_LIMIT
+Default maximum number of source bytes of compiled chunks kept per state by lua_eval_string. */
+#define BUILD_LUA_EVAL_CACHE_LIMIT (256 * 1024)
+
+/*! \def BUILD_LUA_RELOAD_DELAY
+Suggested quiet period in milliseconds collecting resource events before modules are reloaded,
+see reload_delay in lua_config_t. */
+#define BUILD_LUA_RELOAD_DELAY 100
+
+/*! \def BUILD_LUA_PREFETCH_THREADS
+Maximum number of threads (including the calling thread) loading modules in lua_module_prefetch. */
+#define BUILD_LUA_PREFETCH_THREADS 8
+
+/*! \def BUILD_LUA_COMPILE_THREADS
+Maximum number of threads (including the calling thread) compiling resources in lua_compile_jobs. */
+#define BUILD_LUA_COMPILE_THREADS 32
+
+/*! \def BUILD_LUA_JOB_THREADS
+Maximum number of persistent worker threads shared by lua_module_prefetch, lua_compile_jobs and
+lua_import_jobs. Workers are started on demand and kept until lua_module_finalize. */
+#define BUILD_LUA_JOB_THREADS 31
+
+/*! \def BUILD_LUA_IMPORT_THREADS
+Maximum number of threads (including the calling thread) importing files in lua_import_jobs. */
+#define BUILD_LUA_IMPORT_THREADS 32
+
+/*! \def BUILD_LUA_IMPORT_CHUNK_SIZE
+Number of bytes of source read and digested at a time when importing. */
+#define BUILD_LUA_IMPORT_CHUNK_SIZE 65536
+
+/*! \def BUILD_LUA_COMPILE_REPORT_LOADS
+Number of loads (and decompressions) averaged when measuring bytecode load time in
+lua_compile_report. */
+#define BUILD_LUA_COMPILE_REPORT_LOADS 16
+
 #define BUILD_SIZE_LUA_LOOKUP_BUCKETS 31
+#define BUILD_SIZE_LUA_MODULE_BUCKETS 61
+#define BUILD_SIZE_LUA_EVAL_CACHE_BUCKETS 61
+//! Initial capacity of global module map, must be a power of two
+#define BUILD_SIZE_LUA_MODULEMAP_CAPACITY 32
 #define BUILD_SIZE_LUA_NAME_MAXLENGTH 128
 
 #define BUILD_REGISTRY_LOADED_MODULES "loaded-modules"
+#define BUILD_REGISTRY_LOADED_SOURCE "loaded-source"
+#define BUILD_REGISTRY_SUBENV_META "subenv-meta"
@@ -26,8 +26,32 @@
 lua_result_t
 lua_do_call_custom(lua_t* env, const char* method, size_t length, lua_arg_t* arg);
 
+lua_result_t
+lua_do_call_subenv(lua_t* env, lua_subenv_t subenv, const char* method, size_t length,
+                   lua_arg_t* arg);
+
+//Push named value from globals, or from sub-environment (which falls back to globals)
+static void
+lua_push_root(lua_State* state, lua_subenv_t subenv, const char* name, size_t length) {
+	if (subenv > 0) {
+		lua_rawgeti(state, LUA_REGISTRYINDEX, subenv);
+		lua_pushlstring(state, name, length);
+		lua_gettable(state, -2);
+		lua_replace(state, -2);
+	}
+	else {
+		lua_getlglobal(state, name, length);
+	}
+}
+
 lua_result_t
 lua_do_call_custom(lua_t* env, const char* method, size_t length, lua_arg_t* arg) {
+	return lua_do_call_subenv(env, 0, method, length, arg);
+}
+
+lua_result_t
+lua_do_call_subenv(lua_t* env, lua_subenv_t subenv, const char* method, size_t length,
+                   lua_arg_t* arg) {
 	lua_State* state;
 	lua_result_t result;
 	int numargs, i;
@@ -44,7 +68,7 @@ lua_do_call_custom(lua_t* env, const char* method, size_t length, lua_arg_t* arg
 	next = string_find(method, length, '.', 0);
 	if (next != STRING_NPOS) {
 		part = string_const(method, next);
-		lua_getlglobal(state, part.str, part.length);
+		lua_push_root(state, subenv, part.str, part.length);
 		if (lua_isnil(state, -1)) {
 			log_errorf(HASH_LUA, ERROR_INVALID_VALUE,
 			           STRING_CONST("Invalid script call, '%.*s' is not set (%.*s)"),
@@ -100,7 +124,7 @@ lua_do_call_custom(lua_t* env, const char* method, size_t length, lua_arg_t* arg
 		lua_gettable(state, -2);
 	}
 	else {
-		lua_getlglobal(state, method, length);
+		lua_push_root(state, subenv, method, length);
 	}
 
 	if (lua_isnil(state, -1)) {
@@ -199,7 +223,7 @@ lua_call_custom(lua_t* env, const char* method, size_t length, lua_arg_t* arg) {
 			op.arg = *arg;
 		else
 			op.arg.num = 0;
-		lua_push_op(env, &op);
+		lua_push_op(env, &op, true);
 		return LUA_QUEUED;
 	}
 	lua_execute_pending(env);
@@ -251,3 +275,63 @@ lua_call_ptr(lua_t* env, const char* method, size_t length, void* ptr) {
 	lua_arg_t arg = { .num = 1, .type[0] = LUADATA_PTR, .value[0].ptr = ptr };
 	return lua_call_custom(env, method, length, &arg);
 }
+
+lua_result_t
+lua_subenv_call_custom(lua_t* env, lua_subenv_t subenv, const char* method, size_t length,
+                       lua_arg_t* arg) {
+	if (subenv <= 0)
+		return LUA_ERROR;
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+	//Sub-environment calls are not queued, wait for execution right
+	lua_acquire_execution_right(env, true);
+	lua_execute_pending(env);
+	lua_result_t res = lua_do_call_subenv(env, subenv, method, length, arg);
+	lua_release_execution_right(env);
+	return res;
+#else
+	return lua_do_call_subenv(env, subenv, method, length, arg);
+#endif
+}
+
+lua_result_t
+lua_subenv_call_void(lua_t* env, lua_subenv_t subenv, const char* method, size_t length) {
+	return lua_subenv_call_custom(env, subenv, method, length, 0);
+}
+
+lua_result_t
+lua_subenv_call_real(lua_t* env, lua_subenv_t subenv, const char* method, size_t length, real val) {
+	lua_arg_t arg = { .num = 1, .type[0] = LUADATA_REAL, .value[0].val = val };
+	return lua_subenv_call_custom(env, subenv, method, length, &arg);
+}
+
+lua_result_t
+lua_subenv_call_int(lua_t* env, lua_subenv_t subenv, const char* method, size_t length, int val) {
+	lua_arg_t arg = { .num = 1, .type[0] = LUADATA_INT, .value[0].ival = val };
+	return lua_subenv_call_custom(env, subenv, method, length, &arg);
+}
+
+lua_result_t
+lua_subenv_call_bool(lua_t* env, lua_subenv_t subenv, const char* method, size_t length, bool val) {
+	lua_arg_t arg = { .num = 1, .type[0] = LUADATA_BOOL, .value[0].flag = val };
+	return lua_subenv_call_custom(env, subenv, method, length, &arg);
+}
+
+lua_result_t
+lua_subenv_call_string(lua_t* env, lua_subenv_t subenv, const char* method, size_t length,
+                       const char* str, size_t arglength) {
+	lua_arg_t arg = { .num = 1, .type[0] = LUADATA_STR, .size[0] = (uint16_t)arglength, .value[0].str = str };
+	return lua_subenv_call_custom(env, subenv, method, length, &arg);
+}
+
+lua_result_t
+lua_subenv_call_object(lua_t* env, lua_subenv_t subenv, const char* method, size_t length,
+                       object_t obj) {
+	lua_arg_t arg = { .num = 1, .type[0] = LUADATA_OBJ, .value[0].obj = obj };
+	return lua_subenv_call_custom(env, subenv, method, length, &arg);
+}
+
+lua_result_t
+lua_subenv_call_ptr(lua_t* env, lua_subenv_t subenv, const char* method, size_t length, void* ptr) {
+	lua_arg_t arg = { .num = 1, .type[0] = LUADATA_PTR, .value[0].ptr = ptr };
+	return lua_subenv_call_custom(env, subenv, method, length, &arg);
+}
@@ -52,3 +52,38 @@ lua_call_bool(lua_t* env, const char* method, size_t length, bool arg);
 //! Call method
 LUA_API lua_result_t
 lua_call_custom(lua_t* env, const char* method, size_t length, lua_arg_t* arg);
+
+//! Call method in sub-environment
+LUA_API lua_result_t
+lua_subenv_call_void(lua_t* env, lua_subenv_t subenv, const char* method, size_t length);
+
+//! Call method in sub-environment
+LUA_API lua_result_t
+lua_subenv_call_ptr(lua_t* env, lua_subenv_t subenv, const char* method, size_t length, void* arg);
+
+//! Call method in sub-environment
+LUA_API lua_result_t
+lua_subenv_call_object(lua_t* env, lua_subenv_t subenv, const char* method, size_t length,
+                       object_t arg);
+
+//! Call method in sub-environment
+LUA_API lua_result_t
+lua_subenv_call_real(lua_t* env, lua_subenv_t subenv, const char* method, size_t length, real arg);
+
+//! Call method in sub-environment
+LUA_API lua_result_t
+lua_subenv_call_int(lua_t* env, lua_subenv_t subenv, const char* method, size_t length, int arg);
+
+//! Call method in sub-environment (arglength must fit in a uint16_t)
+LUA_API lua_result_t
+lua_subenv_call_string(lua_t* env, lua_subenv_t subenv, const char* method, size_t length,
+                       const char* arg, size_t arglength);
+
+//! Call method in sub-environment
+LUA_API lua_result_t
+lua_subenv_call_bool(lua_t* env, lua_subenv_t subenv, const char* method, size_t length, bool arg);
+
+//! Call method in sub-environment
+LUA_API lua_result_t
+lua_subenv_call_custom(lua_t* env, lua_subenv_t subenv, const char* method, size_t length,
+                       lua_arg_t* arg);
@@ -12,20 +12,32 @@
  * http://luajit.org/
  */
 
+#define LUA_USE_INTERNAL_HEADER
+
 #include <foundation/foundation.h>
 #include <lua/lua.h>
 #include <resource/resource.h>
 
-#if RESOURCE_ENABLE_LOCAL_SOURCE
+#undef LUA_API
+#define LUA_HAS_LUA_STATE_TYPE
+
+#include "luajit/src/lua.h"
+#include "luajit/src/luajit.h"
+
+LUA_EXTERN lua_State*
+lua_state_allocate_bare(void);
+
+LUA_EXTERN int
+lua_compile_initialize(void);
 
-LUA_API int
-lua_load(lua_State* L, lua_Reader reader, void* dt, const char* chunkname);
+LUA_EXTERN void
+lua_compile_finalize(void);
 
-LUA_API int
-lua_dump(lua_State* L, lua_Writer writer, void* data);
+LUA_EXTERN size_t
+lua_jobs_run(bool (*work)(void*, size_t), void* data, size_t count, size_t threads);
 
-LUA_API int
-lua_pcall(lua_State* L, int nargs, int nresults, int errfunc);
+LUA_EXTERN void
+lua_compile_state_release(void);
 
 typedef struct {
 	char*   bytecode;
@@ -51,6 +63,483 @@ lua_compile_dump_writer(lua_State* state, const void* buffer, size_t size, void*
 	return 0;
 }
 
+/* Compile states only load and dump, no libraries are opened and no code is executed. Each
+   thread lazily creates one and reuses it, all are closed at finalize or when a job pool worker
+   exits. The generation guards against threads outliving a finalize and initialize cycle. The
+   lock also serializes writes of compiled resources from concurrent compile jobs. */
+FOUNDATION_DECLARE_THREAD_LOCAL(lua_State*, compile_state, nullptr)
+FOUNDATION_DECLARE_THREAD_LOCAL(unsigned int, compile_generation, 0)
+
+static mutex_t* _lua_compile_lock;
+static lua_State** _lua_compile_states;
+static unsigned int _lua_compile_generation;
+
+struct lua_compile_platform_profile_t {
+	uint64_t platform;
+	lua_compile_profile_t profile;
+};
+typedef struct lua_compile_platform_profile_t lua_compile_platform_profile_t;
+
+static lua_compile_platform_profile_t* _lua_compile_profiles;
+
+static char _lua_compile_cache_buffer[BUILD_MAX_PATHLEN];
+static string_t _lua_compile_cache_path;
+static lua_compile_cache_statistics_t _lua_compile_cache_statistics;
+
+int
+lua_compile_initialize(void) {
+	_lua_compile_lock = mutex_allocate(STRING_CONST("lua-compile"));
+	memset(&_lua_compile_cache_statistics, 0, sizeof(_lua_compile_cache_statistics));
+	++_lua_compile_generation;
+	return 0;
+}
+
+void
+lua_compile_finalize(void) {
+	for (size_t istate = 0, ssize = array_size(_lua_compile_states); istate < ssize; ++istate)
+		lua_close(_lua_compile_states[istate]);
+	array_deallocate(_lua_compile_states);
+	array_deallocate(_lua_compile_profiles);
+	mutex_deallocate(_lua_compile_lock);
+	_lua_compile_lock = nullptr;
+	++_lua_compile_generation;
+}
+
+static lua_State*
+lua_compile_state(void) {
+	lua_State* state = get_thread_compile_state();
+	if (state && (get_thread_compile_generation() == _lua_compile_generation))
+		return state;
+
+	state = lua_state_allocate_bare();
+	if (state) {
+		mutex_lock(_lua_compile_lock);
+		array_push(_lua_compile_states, state);
+		mutex_unlock(_lua_compile_lock);
+	}
+	set_thread_compile_state(state);
+	set_thread_compile_generation(_lua_compile_generation);
+	return state;
+}
+
+//Close the compile state of a thread about to exit
+void
+lua_compile_state_release(void) {
+	lua_State* state = get_thread_compile_state();
+	if (state && (get_thread_compile_generation() == _lua_compile_generation)) {
+		mutex_lock(_lua_compile_lock);
+		for (size_t istate = 0, ssize = array_size(_lua_compile_states); istate < ssize; ++istate) {
+			if (_lua_compile_states[istate] == state) {
+				array_erase(_lua_compile_states, istate);
+				break;
+			}
+		}
+		mutex_unlock(_lua_compile_lock);
+		lua_close(state);
+	}
+	set_thread_compile_state(nullptr);
+}
+
+int
+lua_compile_bytecode(const void* source, size_t size, lua_compile_profile_t profile,
+                     void** bytecode, size_t* bytecode_size) {
+	int result = 0;
+	lua_compile_dump_t dump = {0, 0};
+	lua_State* state = lua_compile_state();
+	if (!state)
+		return -1;
+
+	lua_readbuffer_t read_buffer = {
+		.buffer = source,
+		.size = size,
+		.offset = 0
+	};
+
+	if (lua_load(state, lua_read_buffer, &read_buffer, "compile") != 0) {
+		const char* errstr = lua_tostring(state, -1);
+		log_errorf(HASH_LUA, ERROR_INTERNAL_FAILURE, STRING_CONST("Lua load failed: %s"),
+		           errstr ? errstr : "<no error>");
+		result = -1;
+	}
+	else if ((lua_dumpx(state, lua_compile_dump_writer, &dump, (profile == LUACOMPILE_RELEASE) ? 1 : 0) != 0) ||
+	         !dump.bytecode_size) {
+		log_error(HASH_LUA, ERROR_INTERNAL_FAILURE, STRING_CONST("Lua bytecode dump failed"));
+		result = -1;
+	}
+	else {
+		//Verify the dump loads back, the chunk itself is never called
+		lua_readbuffer_t read_dump = {
+			.buffer = dump.bytecode,
+			.size = dump.bytecode_size,
+			.offset = 0
+		};
+		if (lua_load(state, lua_read_buffer, &read_dump, "verify") != 0) {
+			const char* errstr = lua_tostring(state, -1);
+			log_errorf(HASH_LUA, ERROR_INTERNAL_FAILURE, STRING_CONST("Lua bytecode verify failed: %s"),
+			           errstr ? errstr : "<no error>");
+			result = -1;
+		}
+	}
+	lua_settop(state, 0);
+
+	if (result < 0) {
+		memory_deallocate(dump.bytecode);
+		return result;
+	}
+
+	*bytecode = dump.bytecode;
+	*bytecode_size = dump.bytecode_size;
+	return 0;
+}
+
+int
+lua_compile_report(const void* source, size_t size, lua_compile_report_t* report) {
+	memset(report, 0, sizeof(lua_compile_report_t));
+	for (int profile = 0; profile < LUACOMPILE_PROFILE_COUNT; ++profile) {
+		void* bytecode = nullptr;
+		size_t bytecode_size = 0;
+		if (lua_compile_bytecode(source, size, (lua_compile_profile_t)profile, &bytecode, &bytecode_size) < 0)
+			return -1;
+
+		//Bytecode loaded in the same thread state as compiled, the chunk is never called
+		lua_State* state = lua_compile_state();
+		bool loaded = true;
+		tick_t start = time_current();
+		for (int iload = 0; loaded && (iload < BUILD_LUA_COMPILE_REPORT_LOADS); ++iload) {
+			lua_readbuffer_t read_buffer = {
+				.buffer = bytecode,
+				.size = bytecode_size,
+				.offset = 0
+			};
+			loaded = (lua_load(state, lua_read_buffer, &read_buffer, "report") == 0);
+			lua_settop(state, 0);
+		}
+		deltatime_t elapsed = time_ticks_to_seconds(time_diff(start, time_current()));
+
+		size_t capacity = lua_compress_bound(bytecode_size);
+		void* compressed = memory_allocate(HASH_LUA, capacity, 0, MEMORY_PERSISTENT);
+		size_t compressed_size = lua_compress(bytecode, bytecode_size, compressed, capacity);
+		start = time_current();
+		for (int iload = 0; loaded && (iload < BUILD_LUA_COMPILE_REPORT_LOADS); ++iload)
+			loaded = lua_decompress(compressed, compressed_size, bytecode, bytecode_size);
+		deltatime_t decompressed = time_ticks_to_seconds(time_diff(start, time_current()));
+		memory_deallocate(compressed);
+		memory_deallocate(bytecode);
+		if (!loaded)
+			return -1;
+
+		report->size[profile] = bytecode_size;
+		report->load_time[profile] = elapsed / (deltatime_t)BUILD_LUA_COMPILE_REPORT_LOADS;
+		report->compressed_size[profile] = compressed_size;
+		report->decompress_time[profile] = decompressed / (deltatime_t)BUILD_LUA_COMPILE_REPORT_LOADS;
+	}
+	return 0;
+}
+
+void
+lua_compile_set_profile(uint64_t platform, lua_compile_profile_t profile) {
+	if (_lua_compile_lock)
+		mutex_lock(_lua_compile_lock);
+	size_t iprof = 0, psize = array_size(_lua_compile_profiles);
+	while ((iprof < psize) && (_lua_compile_profiles[iprof].platform != platform))
+		++iprof;
+	if (iprof < psize) {
+		_lua_compile_profiles[iprof].profile = profile;
+	}
+	else {
+		lua_compile_platform_profile_t platform_profile = {platform, profile};
+		array_push(_lua_compile_profiles, platform_profile);
+	}
+	if (_lua_compile_lock)
+		mutex_unlock(_lua_compile_lock);
+}
+
+lua_compile_profile_t
+lua_compile_profile(uint64_t platform) {
+	lua_compile_profile_t profile = (lua_compile_profile_t)lua_module_config().compile_profile;
+	uint64_t best = 0;
+	bool found = false;
+	if (_lua_compile_lock)
+		mutex_lock(_lua_compile_lock);
+	for (size_t iprof = 0, psize = array_size(_lua_compile_profiles); iprof < psize; ++iprof) {
+		uint64_t candidate = _lua_compile_profiles[iprof].platform;
+		if (!resource_platform_is_equal_or_more_specific(platform, candidate))
+			continue;
+		if (!found || resource_platform_is_equal_or_more_specific(candidate, best)) {
+			profile = _lua_compile_profiles[iprof].profile;
+			best = candidate;
+			found = true;
+		}
+	}
+	if (_lua_compile_lock)
+		mutex_unlock(_lua_compile_lock);
+	return (profile < LUACOMPILE_PROFILE_COUNT) ? profile : LUACOMPILE_DEVELOPMENT;
+}
+
+lua_compile_profile_t
+lua_compile_profile_parse(const char* name, size_t length) {
+	if (string_equal(name, length, STRING_CONST("release")))
+		return LUACOMPILE_RELEASE;
+	return LUACOMPILE_DEVELOPMENT;
+}
+
+void
+lua_compile_cache_set_path(const char* path, size_t length) {
+	if (length) {
+		_lua_compile_cache_path = string_copy(_lua_compile_cache_buffer, sizeof(_lua_compile_cache_buffer),
+		                                      path, length);
+		_lua_compile_cache_path = path_clean(STRING_ARGS(_lua_compile_cache_path),
+		                                     sizeof(_lua_compile_cache_buffer));
+		_lua_compile_cache_path = path_absolute(STRING_ARGS(_lua_compile_cache_path),
+		                                        sizeof(_lua_compile_cache_buffer));
+	}
+	else {
+		_lua_compile_cache_path = string(_lua_compile_cache_buffer, 0);
+	}
+}
+
+string_const_t
+lua_compile_cache_path(void) {
+	return string_to_const(_lua_compile_cache_path);
+}
+
+lua_compile_cache_statistics_t
+lua_compile_cache_statistics(void) {
+	lua_compile_cache_statistics_t statistics;
+	if (_lua_compile_lock)
+		mutex_lock(_lua_compile_lock);
+	statistics = _lua_compile_cache_statistics;
+	if (_lua_compile_lock)
+		mutex_unlock(_lua_compile_lock);
+	return statistics;
+}
+
+static bool
+lua_compile_job(void* data, size_t index) {
+	lua_compile_job_t* job = (lua_compile_job_t*)data + index;
+	tick_t start = time_current();
+	job->success = resource_compile(job->uuid, job->platform);
+	job->time = time_ticks_to_seconds(time_diff(start, time_current()));
+	return job->success;
+}
+
+//Pool workers keep their compile state across calls and close it when they exit
+size_t
+lua_compile_jobs(lua_compile_job_t* jobs, size_t count, unsigned int threads) {
+	size_t numthreads = threads ? threads : system_hardware_threads();
+	if (numthreads > BUILD_LUA_COMPILE_THREADS)
+		numthreads = BUILD_LUA_COMPILE_THREADS;
+	return lua_jobs_run(lua_compile_job, jobs, count, numthreads);
+}
+
+#if RESOURCE_ENABLE_LOCAL_SOURCE
+
+/* Cache key is the digest of everything the compiled bytecode depends on: compiler version,
+   bytecode format, FR2 mode, strip setting and the source itself. */
+static uint256_t
+lua_compile_cache_key(const void* source, size_t size, bool strip) {
+	const uint32_t settings[4] = {
+		LUAJIT_VERSION_NUM,
+		LUA_RESOURCE_MODULE_VERSION,
+		lua_is_fr2() ? 1U : 0U,
+		strip ? 1U : 0U
+	};
+	sha256_t* digest = sha256_allocate();
+	sha256_digest(digest, settings, sizeof(settings));
+	sha256_digest(digest, source, size);
+	sha256_digest_finalize(digest);
+	uint256_t key = sha256_get_digest_raw(digest);
+	sha256_deallocate(digest);
+	return key;
+}
+
+//Artifacts are stored as <cache>/<first byte of key>/<key>, fanned out over subdirectories
+static string_t
+lua_compile_cache_artifact_path(char* buffer, size_t capacity, const uint256_t key) {
+	return string_format(buffer, capacity, STRING_CONST("%.*s/%02x/%016" PRIx64 "%016" PRIx64 "%016" PRIx64 "%016" PRIx64),
+	                     STRING_FORMAT(_lua_compile_cache_path), (unsigned int)(key.word[0] >> 56),
+	                     key.word[0], key.word[1], key.word[2], key.word[3]);
+}
+
+static bool
+lua_compile_cache_load(const uint256_t key, void** bytecode, size_t* bytecode_size, deltatime_t* time) {
+	char buffer[BUILD_MAX_PATHLEN];
+	string_t path = lua_compile_cache_artifact_path(buffer, sizeof(buffer), key);
+	stream_t* stream = stream_open(STRING_ARGS(path), STREAM_IN | STREAM_BINARY);
+	if (!stream)
+		return false;
+
+	bool success = false;
+	size_t total = stream_size(stream);
+	uint32_t version = stream_read_uint32(stream);
+	uint64_t size = stream_read_uint64(stream);
+	uint64_t microseconds = stream_read_uint64(stream);
+	size_t header = sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint64_t);
+	if ((version == LUA_COMPILE_CACHE_VERSION) && size && (total == header + size)) {
+		*bytecode = memory_allocate(HASH_LUA, (size_t)size, 0, MEMORY_PERSISTENT);
+		if (stream_read(stream, *bytecode, (size_t)size) == size) {
+			*bytecode_size = (size_t)size;
+			*time = (deltatime_t)microseconds / 1000000.0;
+			success = true;
+		}
+		else {
+			memory_deallocate(*bytecode);
+			*bytecode = nullptr;
+		}
+	}
+	stream_deallocate(stream);
+
+	return success;
+}
+
+//Artifacts are written to a temporary file and moved in place, concurrent writers of the same key are harmless
+static bool
+lua_compile_cache_store(const uint256_t key, const void* bytecode, size_t bytecode_size, deltatime_t time) {
+	char buffer[BUILD_MAX_PATHLEN];
+	char tmpbuffer[BUILD_MAX_PATHLEN];
+	string_t path = lua_compile_cache_artifact_path(buffer, sizeof(buffer), key);
+	string_const_t directory = path_directory_name(STRING_ARGS(path));
+	if (!fs_is_directory(STRING_ARGS(directory)) && !fs_make_directory(STRING_ARGS(directory)))
+		return false;
+
+	string_t tmppath = string_format(tmpbuffer, sizeof(tmpbuffer), STRING_CONST("%.*s.%" PRIx64 ".tmp"),
+	                                 STRING_FORMAT(path), thread_id());
+	stream_t* stream = stream_open(STRING_ARGS(tmppath), STREAM_OUT | STREAM_CREATE | STREAM_TRUNCATE | STREAM_BINARY);
+	if (!stream)
+		return false;
+
+	stream_write_uint32(stream, LUA_COMPILE_CACHE_VERSION);
+	stream_write_uint64(stream, bytecode_size);
+	stream_write_uint64(stream, (uint64_t)(time * 1000000.0));
+	bool success = (stream_write(stream, bytecode, bytecode_size) == bytecode_size);
+	stream_deallocate(stream);
+
+	if (success)
+		success = fs_move_file(STRING_ARGS(tmppath), STRING_ARGS(path)) || fs_is_file(STRING_ARGS(path));
+	if (fs_is_file(STRING_ARGS(tmppath)))
+		fs_remove_file(STRING_ARGS(tmppath));
+	return success;
+}
+
+static bool
+lua_compile_is_identifier(char c, bool first) {
+	return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_') ||
+	       (!first && (c >= '0') && (c <= '9'));
+}
+
+//Skip long bracket at offset, return offset past closing bracket or unchanged offset if none
+static size_t
+lua_compile_skip_long_bracket(const char* source, size_t size, size_t offset) {
+	size_t level = 0;
+	size_t cur = offset + 1;
+	if ((offset >= size) || (source[offset] != '['))
+		return offset;
+	while ((cur < size) && (source[cur] == '='))
+		++cur, ++level;
+	if ((cur >= size) || (source[cur] != '['))
+		return offset;
+	for (++cur; cur < size; ++cur) {
+		if (source[cur] != ']')
+			continue;
+		size_t close = cur + 1;
+		size_t match = 0;
+		while ((close < size) && (source[close] == '=') && (match < level))
+			++close, ++match;
+		if ((match == level) && (close < size) && (source[close] == ']'))
+			return close + 1;
+	}
+	return size;
+}
+
+/* Collect uuids of registered modules required with a constant name, found by scanning the source
+   since the chunk is not executed. Comments and string literals are skipped. */
+static uuid_t*
+lua_compile_scan_requires(const char* source, size_t size) {
+	uuid_t* dependencies = nullptr;
+	char previous = 0;
+	size_t offset = 0;
+
+	//Precompiled bytecode has no source to scan
+	if (size && (source[0] == 0x1B))
+		return nullptr;
+
+	while (offset < size) {
+		char c = source[offset];
+		if ((c == '-') && (offset + 1 < size) && (source[offset + 1] == '-')) {
+			size_t skip = lua_compile_skip_long_bracket(source, size, offset + 2);
+			if (skip != offset + 2) {
+				offset = skip;
+			}
+			else {
+				while ((offset < size) && (source[offset] != '\n'))
+					++offset;
+			}
+			continue;
+		}
+		if ((c == '"') || (c == '\'')) {
+			for (++offset; (offset < size) && (source[offset] != c); ++offset) {
+				if (source[offset] == '\\')
+					++offset;
+			}
+			++offset;
+			previous = c;
+			continue;
+		}
+		if (c == '[') {
+			size_t skip = lua_compile_skip_long_bracket(source, size, offset);
+			if (skip != offset) {
+				offset = skip;
+				previous = ']';
+				continue;
+			}
+		}
+		if (!lua_compile_is_identifier(c, true)) {
+			if ((c != ' ') && (c != '\t') && (c != '\r') && (c != '\n'))
+				previous = c;
+			++offset;
+			continue;
+		}
+
+		size_t start = offset;
+		while ((offset < size) && lua_compile_is_identifier(source[offset], false))
+			++offset;
+		bool is_require = ((offset - start) == 7) && !memcmp(source + start, "require", 7) &&
+		                  (previous != '.') && (previous != ':');
+		previous = 'a';
+		if (!is_require)
+			continue;
+
+		size_t cur = offset;
+		while ((cur < size) && ((source[cur] == ' ') || (source[cur] == '\t')))
+			++cur;
+		if ((cur < size) && (source[cur] == '(')) {
+			++cur;
+			while ((cur < size) && ((source[cur] == ' ') || (source[cur] == '\t')))
+				++cur;
+		}
+		if ((cur >= size) || ((source[cur] != '"') && (source[cur] != '\'')))
+			continue;
+
+		char quote = source[cur++];
+		size_t name = cur;
+		while ((cur < size) && (source[cur] != quote) && (source[cur] != '\\') && (source[cur] != '\n'))
+			++cur;
+		if ((cur >= size) || (source[cur] != quote))
+			continue;
+
+		uuid_t dependency = lua_module_lookup(source + name, cur - name);
+		if (uuid_is_null(dependency))
+			continue;
+		size_t idep = 0, dsize = array_size(dependencies);
+		while ((idep < dsize) && !uuid_equal(dependencies[idep], dependency))
+			++idep;
+		if (idep == dsize)
+			array_push(dependencies, dependency);
+	}
+
+	return dependencies;
+}
+
 static resource_change_t*
 resource_source_platform_reduce(resource_change_t* change, resource_change_t* best, void* data) {
 	uint64_t** subplatforms = data;
@@ -84,9 +573,6 @@ lua_compile(const uuid_t uuid, uint64_t platform, resource_source_t* source,
 	if (resource_type_hash != HASH_LUA)
 		return -1;
 
-	uint64_t restore_platform = lua_resource_platform();
-	lua_resource_set_platform(platform);
-
 	error_context_declare_local(
 	    char uuidbuf[40];
 	    const string_t uuidstr = string_from_uuid(uuidbuf, sizeof(uuidbuf), uuid)
@@ -112,6 +598,7 @@ lua_compile(const uuid_t uuid, uint64_t platform, resource_source_t* source,
 
 		platform_decl = resource_platform_decompose(subplatform);
 		bool need_fr2 = lua_arch_is_fr2(platform_decl.arch);
+		lua_compile_profile_t profile = lua_compile_profile(subplatform);
 
 		//We cannot compile for a non-matching FR2 mode
 		if (need_fr2 != lua_is_fr2()) {
@@ -122,8 +609,9 @@ lua_compile(const uuid_t uuid, uint64_t platform, resource_source_t* source,
 			break;
 		}
 
-		log_debugf(HASH_RESOURCE, STRING_CONST("Compile for platform: %" PRIx64 " (FR2 %s)"),
-		           subplatform, lua_is_fr2() ? "true" : "false");
+		log_debugf(HASH_RESOURCE, STRING_CONST("Compile for platform: %" PRIx64 " (FR2 %s, %s)"),
+		           subplatform, lua_is_fr2() ? "true" : "false",
+		           (profile == LUACOMPILE_RELEASE) ? "release" : "development");
 
 		resource_change_t* sourcechange = resource_source_get(source, HASH_SOURCE, subplatform);
 		if (sourcechange && (sourcechange->flags & RESOURCE_SOURCEFLAG_BLOB)) {
@@ -148,58 +636,79 @@ lua_compile(const uuid_t uuid, uint64_t platform, resource_source_t* source,
 				continue;
 			}
 
-			lua_t* env;
-			lua_State* state;
-			lua_compile_dump_t dump;
-			lua_readbuffer_t read_buffer = {
-				.buffer = source_blob,
-				.size = source_size,
-				.offset = 0
-			};
-
-			FOUNDATION_UNUSED(uuid);
-
-			env = lua_allocate();
-			state = lua_state(env);
-			memset(&dump, 0, sizeof(dump));
-
-			if (lua_load(state, lua_read_buffer, &read_buffer, "compile") != 0) {
-				const char* errstr = lua_tostring(state, -1);
-				log_errorf(HASH_LUA, ERROR_INTERNAL_FAILURE, STRING_CONST("Lua load failed: %s"),
-				           errstr ? errstr : "<no error>");
-				lua_pop(state, 1);
-				result = -1;
-			}
-			else {
-				lua_dump(state, lua_compile_dump_writer, &dump);
-
-				if (lua_pcall(state, 0, 0, 0) != 0) {
-					const char* errstr = lua_tostring(state, -1);
-					log_errorf(HASH_LUA, ERROR_INTERNAL_FAILURE, STRING_CONST("Lua pcall failed: %s"),
-					           errstr ? errstr : "<no error>");
-					lua_pop(state, 1);
-					result = -1;
+			uuid_t* dependencies = nullptr;
+			bool cached = false;
+			uint256_t key = uint256_null();
+			tick_t start = time_current();
+			if (_lua_compile_cache_path.length) {
+				deltatime_t compile_time = 0;
+				key = lua_compile_cache_key(source_blob, source_size, profile == LUACOMPILE_RELEASE);
+				cached = lua_compile_cache_load(key, &compiled_blob, &compiled_size, &compile_time);
+				deltatime_t elapsed = time_ticks_to_seconds(time_diff(start, time_current()));
+				mutex_lock(_lua_compile_lock);
+				if (cached) {
+					++_lua_compile_cache_statistics.hits;
+					if (compile_time > elapsed)
+						_lua_compile_cache_statistics.time_saved += compile_time - elapsed;
 				}
 				else {
-					log_debug(HASH_LUA, STRING_CONST("Lua bytecode dump successful"));
-					compiled_blob = dump.bytecode;
-					compiled_size = dump.bytecode_size;
+					++_lua_compile_cache_statistics.misses;
 				}
+				mutex_unlock(_lua_compile_lock);
+				if (cached)
+					log_debugf(HASH_LUA, STRING_CONST("Lua bytecode from compile cache, saved %.2fms"),
+					           compile_time > elapsed ? (compile_time - elapsed) * 1000.0 : 0.0);
 			}
 
-			lua_deallocate(env);
+			if (!cached && (lua_compile_bytecode(source_blob, source_size, profile, &compiled_blob, &compiled_size) == 0)) {
+				log_debug(HASH_LUA, STRING_CONST("Lua bytecode dump successful"));
+				deltatime_t compile_time = time_ticks_to_seconds(time_diff(start, time_current()));
+				if (_lua_compile_cache_path.length &&
+				        lua_compile_cache_store(key, compiled_blob, compiled_size, compile_time)) {
+					mutex_lock(_lua_compile_lock);
+					++_lua_compile_cache_statistics.stores;
+					mutex_unlock(_lua_compile_lock);
+				}
+			}
 
-			memory_deallocate(source_blob);
+			if (compiled_size) {
+				//Scanned on cache hits too, the uuids depend on current module registrations
+				dependencies = lua_compile_scan_requires(source_blob, source_size);
+				mutex_lock(_lua_compile_lock);
+				resource_source_set_dependencies(uuid, subplatform, dependencies, array_size(dependencies));
+				mutex_unlock(_lua_compile_lock);
+				if (dependencies)
+					log_debugf(HASH_RESOURCE, STRING_CONST("Compiled module requires %" PRIsize " modules"),
+					           array_size(dependencies));
+			}
+			else {
+				result = -1;
+			}
+			array_deallocate(dependencies);
 
-			if (result < 0)
-				memory_deallocate(dump.bytecode);
+			memory_deallocate(source_blob);
 		}
 
 		if (compiled_size <= 0)
 			continue;
 
-		stream = resource_local_create_static(uuid, subplatform);
-		if (stream) {
+		//Local resource writes are serialized across concurrent compile jobs
+		mutex_lock(_lua_compile_lock);
+		if (lua_module_config().bundle_resources) {
+			stream = resource_local_create_static(uuid, subplatform);
+			if (stream && lua_module_write_bundle(stream, source_hash, compiled_blob, compiled_size)) {
+				string_const_t streampath = stream_path(stream);
+				log_debugf(HASH_RESOURCE, STRING_CONST("Wrote bundled resource stream: %.*s"),
+				           STRING_FORMAT(streampath));
+			}
+			else {
+				log_errorf(HASH_RESOURCE, ERROR_SYSTEM_CALL_FAIL,
+				           STRING_CONST("Unable to create bundled resource stream"));
+				result = -1;
+			}
+			stream_deallocate(stream);
+		}
+		else if ((stream = resource_local_create_static(uuid, subplatform))) {
 			const uint32_t version = LUA_RESOURCE_MODULE_VERSION;
 			resource_header_t header = {
 				.type = resource_type_hash,
@@ -215,9 +724,8 @@ lua_compile(const uuid_t uuid, uint64_t platform, resource_source_t* source,
 			if (compiled_size > 0) {
 				stream = resource_local_create_dynamic(uuid, subplatform);
 				if (stream) {
-					stream_write_uint32(stream, version);
-					stream_write_uint64(stream, compiled_size);
-					stream_write(stream, compiled_blob, compiled_size);
+					lua_module_write_bytecode(stream, compiled_blob, compiled_size, false,
+					                          lua_module_config().compress_resources);
 					streampath = stream_path(stream);
 					log_debugf(HASH_RESOURCE, STRING_CONST("Wrote dynamic resource stream: %.*s"),
 					           STRING_FORMAT(streampath));
@@ -235,6 +743,7 @@ lua_compile(const uuid_t uuid, uint64_t platform, resource_source_t* source,
 			           STRING_CONST("Unable to create static resource stream"));
 			result = -1;
 		}
+		mutex_unlock(_lua_compile_lock);
 
 		memory_deallocate(compiled_blob);
 	}
@@ -244,8 +753,6 @@ lua_compile(const uuid_t uuid, uint64_t platform, resource_source_t* source,
 
 	error_context_pop();
 
-	lua_resource_set_platform(restore_platform);
-
 	return result;
 }
 
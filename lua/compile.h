@@ -22,7 +22,81 @@
 
 #include <lua/types.h>
 
-/* Compile lua resource
+//! Version of compile cache artifact format
+#define LUA_COMPILE_CACHE_VERSION 2
+
+/*! Compile lua source to bytecode without executing it. Loads, dumps and verifies the dump in
+a lightweight state reused by the calling thread.
+\param source Source code (or bytecode)
+\param size Size of source
+\param profile Compile profile, release strips debug info
+\param bytecode Receives bytecode, caller deallocates with memory_deallocate
+\param bytecode_size Receives size of bytecode
+\return 0 if successful, <0 if error */
+LUA_API int
+lua_compile_bytecode(const void* source, size_t size, lua_compile_profile_t profile,
+                     void** bytecode, size_t* bytecode_size);
+
+/*! Compile lua source in every compile profile and measure bytecode size and average
+lua_load time of each, as well as compressed size and average decompression time
+\param source Source code
+\param size Size of source
+\param report Receives size and load time for each profile
+\return 0 if successful, <0 if error */
+LUA_API int
+lua_compile_report(const void* source, size_t size, lua_compile_report_t* report);
+
+/*! Set compile profile used by lua_compile for a platform. The most specific matching platform
+set takes precedence, platforms without a match use the profile in the module config.
+\param platform Resource platform, RESOURCE_PLATFORM_ALL for all platforms
+\param profile Compile profile */
+LUA_API void
+lua_compile_set_profile(uint64_t platform, lua_compile_profile_t profile);
+
+/*! Get compile profile used by lua_compile for a platform
+\param platform Resource platform
+\return Compile profile */
+LUA_API lua_compile_profile_t
+lua_compile_profile(uint64_t platform);
+
+/*! Parse compile profile name, "release" or "development"
+\param name Profile name
+\param length Length of name
+\return Compile profile, development if name is not recognized */
+LUA_API lua_compile_profile_t
+lua_compile_profile_parse(const char* name, size_t length);
+
+/*! Compile independent resource and platform pairs in parallel on a pool of threads through
+resource_compile. Each thread compiles in its own compile state, resource writes are serialized.
+Blocks until all jobs are done.
+\param jobs Jobs, success and time are set for each job
+\param count Number of jobs
+\param threads Maximum number of threads including the calling thread, 0 for hardware thread count
+\return Number of jobs successfully compiled */
+LUA_API size_t
+lua_compile_jobs(lua_compile_job_t* jobs, size_t count, unsigned int threads);
+
+/*! Set the local directory of the content-addressed compile cache. Compiled bytecode is stored
+by the digest of the source, compiler version, FR2 mode and strip setting, and lua_compile reuses
+a stored artifact instead of compiling unchanged sources. Module dependencies are not cached, they
+depend on the module registrations and are scanned from the source on every compile.
+\param path Cache directory path, created as needed
+\param length Length of path, 0 to disable the compile cache */
+LUA_API void
+lua_compile_cache_set_path(const char* path, size_t length);
+
+/*! Get the local directory of the compile cache
+\return Cache directory path, empty if compile cache is disabled */
+LUA_API string_const_t
+lua_compile_cache_path(void);
+
+/*! Get compile cache statistics accumulated since module initialization
+\return Compile cache statistics */
+LUA_API lua_compile_cache_statistics_t
+lua_compile_cache_statistics(void);
+
+/* Compile lua resource. The chunk is never executed, modules it requires with constant names
+are found by scanning the source and stored as resource dependencies
 \param uuid Resource UUID
 \param platform Resource platform
 \param source Resource source representation
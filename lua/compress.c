@@ -0,0 +1,192 @@
+/* compress.c  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#include <lua/lua.h>
+
+#include <foundation/foundation.h>
+
+/* Sequences of a token byte (literal length and match length nibbles), extended literal length,
+   literals, 16-bit little endian match offset and extended match length. Extended lengths are
+   runs of 255 bytes terminated by a smaller byte. The last sequence holds literals only. */
+
+#define LUA_COMPRESS_MIN_MATCH 4
+#define LUA_COMPRESS_MAX_OFFSET 65535
+//Matches must start this far from the end and end at least last literals from the end
+#define LUA_COMPRESS_MATCH_LIMIT 12
+#define LUA_COMPRESS_LAST_LITERALS 5
+#define LUA_COMPRESS_HASH_BITS 12
+
+static FOUNDATION_FORCEINLINE uint32_t
+lua_compress_read32(const uint8_t* data) {
+	uint32_t value;
+	memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+static FOUNDATION_FORCEINLINE uint32_t
+lua_compress_hash(uint32_t sequence) {
+	return (sequence * 2654435761U) >> (32 - LUA_COMPRESS_HASH_BITS);
+}
+
+static uint8_t*
+lua_compress_length(uint8_t* out, size_t length) {
+	while (length >= 255) {
+		*out++ = 255;
+		length -= 255;
+	}
+	*out++ = (uint8_t)length;
+	return out;
+}
+
+//Emit literals and match (zero length for last sequence), null if it does not fit
+static uint8_t*
+lua_compress_sequence(uint8_t* out, const uint8_t* end, const uint8_t* literals, size_t literal_length,
+                      size_t offset, size_t match_length) {
+	size_t extra = match_length ? (match_length - LUA_COMPRESS_MIN_MATCH) : 0;
+	size_t needed = 1 + (literal_length / 255) + 1 + literal_length + (match_length ? (2 + (extra / 255) + 1) : 0);
+	if (needed > (size_t)(end - out))
+		return nullptr;
+
+	uint8_t* token = out++;
+	*token = (uint8_t)(((literal_length < 15) ? literal_length : 15) << 4);
+	if (literal_length >= 15)
+		out = lua_compress_length(out, literal_length - 15);
+	memcpy(out, literals, literal_length);
+	out += literal_length;
+
+	if (match_length) {
+		*out++ = (uint8_t)(offset & 0xFF);
+		*out++ = (uint8_t)(offset >> 8);
+		*token |= (uint8_t)((extra < 15) ? extra : 15);
+		if (extra >= 15)
+			out = lua_compress_length(out, extra - 15);
+	}
+	return out;
+}
+
+size_t
+lua_compress_bound(size_t size) {
+	return size + (size / 255) + 16;
+}
+
+size_t
+lua_compress(const void* source, size_t size, void* dest, size_t capacity) {
+	uint32_t table[1 << LUA_COMPRESS_HASH_BITS];
+	const uint8_t* in = source;
+	uint8_t* out = dest;
+	const uint8_t* out_end = out + capacity;
+	size_t anchor = 0;
+
+	if (size > LUA_COMPRESS_MATCH_LIMIT) {
+		size_t limit = size - LUA_COMPRESS_MATCH_LIMIT;
+		size_t match_end = size - LUA_COMPRESS_LAST_LITERALS;
+		size_t ip = 1;
+		memset(table, 0, sizeof(table));
+		while (ip <= limit) {
+			uint32_t sequence = lua_compress_read32(in + ip);
+			uint32_t bucket = lua_compress_hash(sequence);
+			size_t ref = table[bucket];
+			table[bucket] = (uint32_t)ip;
+			if ((ref >= ip) || ((ip - ref) > LUA_COMPRESS_MAX_OFFSET) ||
+			        (lua_compress_read32(in + ref) != sequence)) {
+				//Step faster through data without matches
+				ip += 1 + ((ip - anchor) >> 6);
+				continue;
+			}
+
+			while ((ip > anchor) && (ref > 0) && (in[ip - 1] == in[ref - 1]))
+				--ip, --ref;
+			size_t length = LUA_COMPRESS_MIN_MATCH;
+			while ((ip + length < match_end) && (in[ip + length] == in[ref + length]))
+				++length;
+
+			out = lua_compress_sequence(out, out_end, in + anchor, ip - anchor, ip - ref, length);
+			if (!out)
+				return 0;
+			ip += length;
+			anchor = ip;
+			if (ip - 2 <= limit)
+				table[lua_compress_hash(lua_compress_read32(in + ip - 2))] = (uint32_t)(ip - 2);
+		}
+	}
+
+	out = lua_compress_sequence(out, out_end, in + anchor, size - anchor, 0, 0);
+	return out ? (size_t)(out - (uint8_t*)dest) : 0;
+}
+
+bool
+lua_decompress(const void* source, size_t size, void* dest, size_t dest_size) {
+	const uint8_t* in = source;
+	const uint8_t* in_end = in + size;
+	uint8_t* out = dest;
+	uint8_t* out_end = out + dest_size;
+
+	while (in < in_end) {
+		uint8_t token = *in++;
+
+		size_t literal_length = token >> 4;
+		if (literal_length == 15) {
+			uint8_t byte;
+			do {
+				if (in >= in_end)
+					return false;
+				byte = *in++;
+				literal_length += byte;
+			} while (byte == 255);
+		}
+		if ((literal_length > (size_t)(in_end - in)) || (literal_length > (size_t)(out_end - out)))
+			return false;
+		memcpy(out, in, literal_length);
+		in += literal_length;
+		out += literal_length;
+
+		//Last sequence has no match
+		if (in == in_end)
+			break;
+
+		if (in_end - in < 2)
+			return false;
+		size_t offset = (size_t)in[0] | ((size_t)in[1] << 8);
+		in += 2;
+		if (!offset || (offset > (size_t)(out - (uint8_t*)dest)))
+			return false;
+
+		size_t match_length = token & 15;
+		if (match_length == 15) {
+			uint8_t byte;
+			do {
+				if (in >= in_end)
+					return false;
+				byte = *in++;
+				match_length += byte;
+			} while (byte == 255);
+		}
+		match_length += LUA_COMPRESS_MIN_MATCH;
+		if (match_length > (size_t)(out_end - out))
+			return false;
+
+		const uint8_t* match = out - offset;
+		if (offset >= match_length) {
+			memcpy(out, match, match_length);
+			out += match_length;
+		}
+		else {
+			//Overlapping match repeats the last offset bytes
+			for (size_t ibyte = 0; ibyte < match_length; ++ibyte)
+				*out++ = match[ibyte];
+		}
+	}
+
+	return out == out_end;
+}
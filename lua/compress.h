@@ -0,0 +1,47 @@
+/* compress.h  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#pragma once
+
+/*! \file compress.h
+    Fast block compression of compiled bytecode */
+
+#include <foundation/platform.h>
+
+#include <lua/types.h>
+
+/*! Get worst case size of compressed data
+\param size Size of uncompressed data
+\return Maximum size of compressed data */
+LUA_API size_t
+lua_compress_bound(size_t size);
+
+/*! Compress a block of data with a byte oriented LZ77 codec in the LZ4 block format,
+favouring decompression speed over ratio
+\param source Uncompressed data
+\param size Size of uncompressed data
+\param dest Destination buffer
+\param capacity Capacity of destination buffer
+\return Size of compressed data, 0 if it does not fit in destination buffer */
+LUA_API size_t
+lua_compress(const void* source, size_t size, void* dest, size_t capacity);
+
+/*! Decompress a block of data compressed by lua_compress
+\param source Compressed data
+\param size Size of compressed data
+\param dest Destination buffer
+\param dest_size Exact size of uncompressed data
+\return true if successful, false if data is corrupt or does not match size */
+LUA_API bool
+lua_decompress(const void* source, size_t size, void* dest, size_t dest_size);
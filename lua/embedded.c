@@ -0,0 +1,76 @@
+/* embedded.c  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#include <lua/lua.h>
+
+#include <foundation/foundation.h>
+
+LUA_EXTERN bool
+lua_archive_mount_static(const char* name, size_t length, const uuid_t* uuids, const void* const* bytecode,
+                         const size_t* sizes, const string_const_t* scripts, const uint256_t* sources,
+                         size_t count);
+
+#if BUILD_ENABLE_LUA_EMBEDDED_MODULES
+
+struct lua_embedded_module_t {
+	uint64_t uuid[2];
+	size_t size;
+	const uint8_t* bytecode;
+	//! sha256 of the script, as stream_sha256
+	uint64_t source[4];
+	//! Script path relative to the import base path
+	const char* script;
+};
+typedef struct lua_embedded_module_t lua_embedded_module_t;
+
+#include "embedded_fr2.h"
+#include "embedded_compat.h"
+
+#define LUA_EMBEDDED_MAX_MODULES 8
+
+//Bytecode differs between states with two-slot frame info (FR2, 64-bit GC) and without
+bool
+lua_archive_mount_embedded(void) {
+	const lua_embedded_module_t* embedded = lua_is_fr2() ? lua_embedded_fr2 : lua_embedded_compat;
+	size_t count = lua_is_fr2() ? sizeof(lua_embedded_fr2) / sizeof(lua_embedded_fr2[0]) :
+	               sizeof(lua_embedded_compat) / sizeof(lua_embedded_compat[0]);
+	FOUNDATION_ASSERT(count <= LUA_EMBEDDED_MAX_MODULES);
+
+	uuid_t uuids[LUA_EMBEDDED_MAX_MODULES];
+	const void* bytecode[LUA_EMBEDDED_MAX_MODULES];
+	size_t sizes[LUA_EMBEDDED_MAX_MODULES];
+	string_const_t scripts[LUA_EMBEDDED_MAX_MODULES];
+	uint256_t sources[LUA_EMBEDDED_MAX_MODULES];
+	for (size_t imod = 0; imod < count; ++imod) {
+		uuids[imod] = uuid_make(embedded[imod].uuid[0], embedded[imod].uuid[1]);
+		bytecode[imod] = embedded[imod].bytecode;
+		sizes[imod] = embedded[imod].size;
+		scripts[imod] = string_const(embedded[imod].script, string_length(embedded[imod].script));
+		sources[imod] = uint256_make(embedded[imod].source[0], embedded[imod].source[1],
+		                             embedded[imod].source[2], embedded[imod].source[3]);
+	}
+
+	//Modules whose script has changed since the header was generated load from resources
+	return lua_archive_mount_static(STRING_CONST(LUA_ARCHIVE_EMBEDDED), uuids, bytecode, sizes,
+	                                scripts, sources, count);
+}
+
+#else
+
+bool
+lua_archive_mount_embedded(void) {
+	return false;
+}
+
+#endif
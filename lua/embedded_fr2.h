@@ -0,0 +1,3055 @@
+#pragma once
+
+/* ****** AUTOMATICALLY GENERATED, DO NOT EDIT ******
+    Edit the built-in module scripts in resource/script
+    and rerun the luaembed tool to update this file */
+
+//Bytecode for states with FR2, development profile
+
+static const uint8_t lua_embedded_fr2_foundation[] = {
+	0x1b, 0x4c, 0x4a, 0x02, 0x0c, 0x07, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x6e, 0x00, 0x02,
+	0x09, 0x01, 0x04, 0x00, 0x08, 0x17, 0x9f, 0x05, 0x00, 0x2d, 0x02, 0x00, 0x00, 0x39, 0x02, 0x00,
+	0x02, 0x39, 0x04, 0x01, 0x00, 0x39, 0x05, 0x02, 0x00, 0x39, 0x06, 0x01, 0x01, 0x39, 0x07, 0x02,
+	0x01, 0x36, 0x08, 0x03, 0x00, 0x44, 0x02, 0x06, 0x00, 0x01, 0xc0, 0x0c, 0x6e, 0x75, 0x6c, 0x6c,
+	0x70, 0x74, 0x72, 0x0b, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x08, 0x73, 0x74, 0x72, 0x1b, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x5f, 0x63,
+	0x6f, 0x6e, 0x63, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x6c,
+	0x68, 0x73, 0x00, 0x00, 0x09, 0x72, 0x68, 0x73, 0x00, 0x00, 0x09, 0x00, 0x57, 0x00, 0x02, 0x08,
+	0x01, 0x03, 0x00, 0x07, 0x16, 0xa0, 0x05, 0x00, 0x2d, 0x02, 0x00, 0x00, 0x39, 0x02, 0x00, 0x02,
+	0x39, 0x04, 0x01, 0x00, 0x39, 0x05, 0x02, 0x00, 0x39, 0x06, 0x01, 0x01, 0x39, 0x07, 0x02, 0x01,
+	0x44, 0x02, 0x05, 0x00, 0x01, 0xc0, 0x0b, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x08, 0x73, 0x74,
+	0x72, 0x11, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x6c, 0x68, 0x73, 0x00, 0x00, 0x08, 0x72, 0x68, 0x73,
+	0x00, 0x00, 0x08, 0x00, 0x23, 0x00, 0x01, 0x02, 0x00, 0x01, 0x00, 0x02, 0x09, 0xa1, 0x05, 0x00,
+	0x39, 0x01, 0x00, 0x00, 0x4c, 0x01, 0x02, 0x00, 0x0b, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00,
+	0x00, 0x73, 0x74, 0x72, 0x00, 0x00, 0x03, 0x00, 0x43, 0x00, 0x01, 0x05, 0x01, 0x03, 0x00, 0x05,
+	0x10, 0xa2, 0x05, 0x00, 0x2d, 0x01, 0x00, 0x00, 0x39, 0x01, 0x00, 0x01, 0x39, 0x03, 0x01, 0x00,
+	0x39, 0x04, 0x02, 0x00, 0x44, 0x01, 0x03, 0x00, 0x00, 0xc0, 0x0b, 0x6c, 0x65, 0x6e, 0x67, 0x74,
+	0x68, 0x08, 0x73, 0x74, 0x72, 0x0b, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x66, 0x66, 0x69, 0x00, 0x73, 0x74, 0x72, 0x00, 0x00, 0x06, 0x00, 0x45, 0x00, 0x01, 0x04,
+	0x01, 0x02, 0x00, 0x05, 0x0e, 0xa3, 0x05, 0x00, 0x2d, 0x01, 0x00, 0x00, 0x39, 0x01, 0x00, 0x01,
+	0x39, 0x03, 0x01, 0x00, 0x42, 0x01, 0x02, 0x01, 0x4b, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x08, 0x73,
+	0x74, 0x72, 0x16, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f,
+	0x63, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x73, 0x74, 0x72, 0x00, 0x00,
+	0x06, 0x00, 0x34, 0x00, 0x01, 0x05, 0x01, 0x01, 0x00, 0x05, 0x0e, 0xb2, 0x05, 0x02, 0x2d, 0x01,
+	0x00, 0x00, 0x39, 0x01, 0x00, 0x01, 0x12, 0x03, 0x00, 0x00, 0x15, 0x04, 0x00, 0x00, 0x44, 0x01,
+	0x03, 0x00, 0x01, 0xc0, 0x09, 0x68, 0x61, 0x73, 0x68, 0x01, 0x01, 0x01, 0x01, 0x01, 0x43, 0x00,
+	0x73, 0x74, 0x72, 0x00, 0x00, 0x06, 0x00, 0xeb, 0x01, 0x00, 0x01, 0x0c, 0x02, 0x05, 0x01, 0x18,
+	0x49, 0xb6, 0x05, 0x08, 0x34, 0x01, 0x00, 0x00, 0x2d, 0x02, 0x00, 0x00, 0x39, 0x02, 0x00, 0x02,
+	0x12, 0x04, 0x00, 0x00, 0x42, 0x02, 0x02, 0x02, 0x29, 0x03, 0x00, 0x00, 0x17, 0x04, 0x00, 0x02,
+	0x29, 0x05, 0x01, 0x00, 0x4d, 0x03, 0x0c, 0x80, 0x2d, 0x07, 0x00, 0x00, 0x39, 0x07, 0x01, 0x07,
+	0x12, 0x09, 0x00, 0x00, 0x12, 0x0a, 0x06, 0x00, 0x42, 0x07, 0x03, 0x02, 0x2d, 0x08, 0x01, 0x00,
+	0x39, 0x08, 0x02, 0x08, 0x39, 0x0a, 0x03, 0x07, 0x39, 0x0b, 0x04, 0x07, 0x42, 0x08, 0x03, 0x02,
+	0x3c, 0x08, 0x06, 0x01, 0x4f, 0x03, 0xf4, 0x7f, 0x12, 0x03, 0x01, 0x00, 0x12, 0x04, 0x02, 0x00,
+	0x4a, 0x03, 0x03, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x0b, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x08,
+	0x73, 0x74, 0x72, 0x0b, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x19, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x0f,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+	0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03,
+	0x07, 0x07, 0x07, 0x43, 0x00, 0x66, 0x66, 0x69, 0x00, 0x61, 0x72, 0x72, 0x00, 0x00, 0x19, 0x74,
+	0x61, 0x62, 0x00, 0x02, 0x17, 0x61, 0x72, 0x72, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x04, 0x13,
+	0x01, 0x03, 0x0d, 0x02, 0x00, 0x0d, 0x03, 0x00, 0x0d, 0x69, 0x00, 0x01, 0x0b, 0x73, 0x74, 0x72,
+	0x00, 0x05, 0x06, 0x00, 0xcb, 0x02, 0x00, 0x01, 0x0f, 0x02, 0x05, 0x01, 0x26, 0x4c, 0xc0, 0x05,
+	0x08, 0x29, 0x01, 0x00, 0x00, 0x16, 0x02, 0x00, 0x01, 0x38, 0x02, 0x02, 0x00, 0x0a, 0x02, 0x00,
+	0x00, 0x58, 0x02, 0x03, 0x80, 0x55, 0x02, 0x02, 0x80, 0x16, 0x01, 0x00, 0x01, 0x58, 0x02, 0xf9,
+	0x7f, 0x2d, 0x02, 0x00, 0x00, 0x39, 0x02, 0x00, 0x02, 0x12, 0x04, 0x01, 0x00, 0x42, 0x02, 0x02,
+	0x02, 0x29, 0x03, 0x00, 0x00, 0x17, 0x04, 0x00, 0x01, 0x29, 0x05, 0x01, 0x00, 0x4d, 0x03, 0x0e,
+	0x80, 0x2d, 0x07, 0x00, 0x00, 0x39, 0x07, 0x01, 0x07, 0x12, 0x09, 0x02, 0x00, 0x12, 0x0a, 0x06,
+	0x00, 0x2d, 0x0b, 0x00, 0x00, 0x39, 0x0b, 0x02, 0x0b, 0x16, 0x0d, 0x00, 0x06, 0x38, 0x0d, 0x0d,
+	0x00, 0x16, 0x0e, 0x00, 0x06, 0x38, 0x0e, 0x0e, 0x00, 0x15, 0x0e, 0x0e, 0x00, 0x42, 0x0b, 0x03,
+	0x00, 0x41, 0x07, 0x02, 0x01, 0x4f, 0x03, 0xf2, 0x7f, 0x2d, 0x03, 0x01, 0x00, 0x39, 0x03, 0x03,
+	0x03, 0x12, 0x05, 0x02, 0x00, 0x2d, 0x06, 0x00, 0x00, 0x39, 0x06, 0x04, 0x06, 0x42, 0x03, 0x03,
+	0x02, 0x12, 0x04, 0x01, 0x00, 0x4a, 0x03, 0x03, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x1c, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c,
+	0x6f, 0x63, 0x61, 0x74, 0x65, 0x07, 0x67, 0x63, 0x11, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f,
+	0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x1d, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x73, 0x65, 0x74, 0x5f,
+	0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x1a, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x5f, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03,
+	0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x05, 0x05, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x43, 0x00, 0x66, 0x66, 0x69,
+	0x00, 0x74, 0x61, 0x62, 0x00, 0x00, 0x27, 0x6e, 0x75, 0x6d, 0x00, 0x02, 0x25, 0x61, 0x72, 0x72,
+	0x00, 0x0b, 0x1a, 0x01, 0x03, 0x0f, 0x02, 0x00, 0x0f, 0x03, 0x00, 0x0f, 0x69, 0x00, 0x01, 0x0d,
+	0x00, 0x5e, 0x00, 0x01, 0x07, 0x02, 0x02, 0x00, 0x08, 0x21, 0xcc, 0x05, 0x00, 0x2d, 0x01, 0x00,
+	0x00, 0x39, 0x01, 0x00, 0x01, 0x2d, 0x03, 0x01, 0x00, 0x27, 0x04, 0x01, 0x00, 0x29, 0x05, 0x02,
+	0x00, 0x12, 0x06, 0x00, 0x00, 0x42, 0x01, 0x05, 0x01, 0x4b, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x05,
+	0xc0, 0x07, 0x25, 0x73, 0x0f, 0x6c, 0x6f, 0x67, 0x5f, 0x64, 0x65, 0x62, 0x75, 0x67, 0x66, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x50, 0x52, 0x45, 0x48, 0x41, 0x53, 0x48,
+	0x5f, 0x4c, 0x55, 0x41, 0x00, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x00, 0x00, 0x09, 0x00,
+	0x5d, 0x00, 0x01, 0x07, 0x02, 0x02, 0x00, 0x08, 0x21, 0xcd, 0x05, 0x00, 0x2d, 0x01, 0x00, 0x00,
+	0x39, 0x01, 0x00, 0x01, 0x2d, 0x03, 0x01, 0x00, 0x27, 0x04, 0x01, 0x00, 0x29, 0x05, 0x02, 0x00,
+	0x12, 0x06, 0x00, 0x00, 0x42, 0x01, 0x05, 0x01, 0x4b, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x05, 0xc0,
+	0x07, 0x25, 0x73, 0x0e, 0x6c, 0x6f, 0x67, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x66, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x50, 0x52, 0x45, 0x48, 0x41, 0x53, 0x48, 0x5f, 0x4c,
+	0x55, 0x41, 0x00, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x00, 0x00, 0x09, 0x00, 0x62, 0x00,
+	0x01, 0x08, 0x02, 0x02, 0x00, 0x09, 0x22, 0xce, 0x05, 0x00, 0x2d, 0x01, 0x00, 0x00, 0x39, 0x01,
+	0x00, 0x01, 0x2d, 0x03, 0x01, 0x00, 0x29, 0x04, 0x08, 0x00, 0x27, 0x05, 0x01, 0x00, 0x29, 0x06,
+	0x02, 0x00, 0x12, 0x07, 0x00, 0x00, 0x42, 0x01, 0x06, 0x01, 0x4b, 0x00, 0x01, 0x00, 0x01, 0xc0,
+	0x05, 0xc0, 0x07, 0x25, 0x73, 0x0e, 0x6c, 0x6f, 0x67, 0x5f, 0x77, 0x61, 0x72, 0x6e, 0x66, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x50, 0x52, 0x45, 0x48, 0x41, 0x53,
+	0x48, 0x5f, 0x4c, 0x55, 0x41, 0x00, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x00, 0x00, 0x0a,
+	0x00, 0x63, 0x00, 0x01, 0x08, 0x02, 0x02, 0x00, 0x09, 0x22, 0xcf, 0x05, 0x00, 0x2d, 0x01, 0x00,
+	0x00, 0x39, 0x01, 0x00, 0x01, 0x2d, 0x03, 0x01, 0x00, 0x29, 0x04, 0x0f, 0x00, 0x27, 0x05, 0x01,
+	0x00, 0x29, 0x06, 0x02, 0x00, 0x12, 0x07, 0x00, 0x00, 0x42, 0x01, 0x06, 0x01, 0x4b, 0x00, 0x01,
+	0x00, 0x01, 0xc0, 0x05, 0xc0, 0x07, 0x25, 0x73, 0x0f, 0x6c, 0x6f, 0x67, 0x5f, 0x65, 0x72, 0x72,
+	0x6f, 0x72, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x50, 0x52,
+	0x45, 0x48, 0x41, 0x53, 0x48, 0x5f, 0x4c, 0x55, 0x41, 0x00, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67,
+	0x65, 0x00, 0x00, 0x0a, 0x00, 0x63, 0x00, 0x01, 0x08, 0x02, 0x02, 0x00, 0x09, 0x22, 0xd0, 0x05,
+	0x00, 0x2d, 0x01, 0x00, 0x00, 0x39, 0x01, 0x00, 0x01, 0x2d, 0x03, 0x01, 0x00, 0x29, 0x04, 0x0f,
+	0x00, 0x27, 0x05, 0x01, 0x00, 0x29, 0x06, 0x02, 0x00, 0x12, 0x07, 0x00, 0x00, 0x42, 0x01, 0x06,
+	0x01, 0x4b, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x05, 0xc0, 0x07, 0x25, 0x73, 0x0f, 0x6c, 0x6f, 0x67,
+	0x5f, 0x70, 0x61, 0x6e, 0x69, 0x63, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x43, 0x00, 0x50, 0x52, 0x45, 0x48, 0x41, 0x53, 0x48, 0x5f, 0x4c, 0x55, 0x41, 0x00, 0x6d, 0x65,
+	0x73, 0x73, 0x61, 0x67, 0x65, 0x00, 0x00, 0x0a, 0x00, 0x36, 0x00, 0x01, 0x04, 0x01, 0x01, 0x00,
+	0x04, 0x0d, 0xd2, 0x05, 0x00, 0x2d, 0x01, 0x00, 0x00, 0x39, 0x01, 0x00, 0x01, 0x12, 0x03, 0x00,
+	0x00, 0x44, 0x01, 0x02, 0x00, 0x01, 0xc0, 0x10, 0x74, 0x79, 0x70, 0x65, 0x5f, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x05, 0x00,
+	0x37, 0x00, 0x01, 0x04, 0x01, 0x01, 0x00, 0x04, 0x0d, 0xd3, 0x05, 0x00, 0x2d, 0x01, 0x00, 0x00,
+	0x39, 0x01, 0x00, 0x01, 0x12, 0x03, 0x00, 0x00, 0x44, 0x01, 0x02, 0x00, 0x01, 0xc0, 0x11, 0x74,
+	0x79, 0x70, 0x65, 0x5f, 0x73, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x00, 0x00, 0x00, 0x00, 0x43,
+	0x00, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x05, 0x00, 0xec, 0xf5, 0x01, 0x07, 0x00, 0x0f, 0x00, 0x3c,
+	0x00, 0x77, 0x9b, 0x04, 0x00, 0xfd, 0x06, 0x36, 0x00, 0x00, 0x00, 0x27, 0x02, 0x01, 0x00, 0x42,
+	0x00, 0x02, 0x02, 0x39, 0x01, 0x02, 0x00, 0x39, 0x02, 0x03, 0x00, 0x27, 0x04, 0x04, 0x00, 0x42,
+	0x02, 0x02, 0x01, 0x39, 0x02, 0x05, 0x01, 0x42, 0x02, 0x01, 0x01, 0x39, 0x02, 0x03, 0x00, 0x27,
+	0x04, 0x06, 0x00, 0x42, 0x02, 0x02, 0x01, 0x39, 0x02, 0x07, 0x01, 0x42, 0x02, 0x01, 0x02, 0x29,
+	0x03, 0x04, 0x00, 0x01, 0x03, 0x02, 0x00, 0x58, 0x02, 0x04, 0x80, 0x39, 0x02, 0x03, 0x00, 0x27,
+	0x04, 0x08, 0x00, 0x42, 0x02, 0x02, 0x01, 0x58, 0x02, 0x03, 0x80, 0x39, 0x02, 0x03, 0x00, 0x27,
+	0x04, 0x09, 0x00, 0x42, 0x02, 0x02, 0x01, 0x39, 0x02, 0x0a, 0x01, 0x42, 0x02, 0x01, 0x02, 0x29,
+	0x03, 0x04, 0x00, 0x01, 0x03, 0x02, 0x00, 0x58, 0x02, 0x06, 0x80, 0x39, 0x02, 0x03, 0x00, 0x27,
+	0x04, 0x0b, 0x00, 0x42, 0x02, 0x02, 0x01, 0x28, 0x02, 0x0c, 0x00, 0x37, 0x02, 0x0d, 0x00, 0x58,
+	0x02, 0x05, 0x80, 0x39, 0x02, 0x03, 0x00, 0x27, 0x04, 0x0e, 0x00, 0x42, 0x02, 0x02, 0x01, 0x29,
+	0x02, 0x00, 0x00, 0x37, 0x02, 0x0d, 0x00, 0x39, 0x02, 0x0f, 0x01, 0x42, 0x02, 0x01, 0x02, 0x29,
+	0x03, 0x02, 0x00, 0x01, 0x03, 0x02, 0x00, 0x58, 0x02, 0x04, 0x80, 0x39, 0x02, 0x03, 0x00, 0x27,
+	0x04, 0x10, 0x00, 0x42, 0x02, 0x02, 0x01, 0x58, 0x02, 0x03, 0x80, 0x39, 0x02, 0x03, 0x00, 0x27,
+	0x04, 0x11, 0x00, 0x42, 0x02, 0x02, 0x01, 0x39, 0x02, 0x03, 0x00, 0x27, 0x04, 0x12, 0x00, 0x42,
+	0x02, 0x02, 0x01, 0x36, 0x02, 0x13, 0x00, 0x0e, 0x00, 0x02, 0x00, 0x58, 0x02, 0x1e, 0x80, 0x2b,
+	0x02, 0x00, 0x00, 0x35, 0x03, 0x15, 0x00, 0x33, 0x04, 0x14, 0x00, 0x3d, 0x04, 0x16, 0x03, 0x33,
+	0x04, 0x17, 0x00, 0x3d, 0x04, 0x18, 0x03, 0x33, 0x04, 0x19, 0x00, 0x3d, 0x04, 0x1a, 0x03, 0x33,
+	0x04, 0x1b, 0x00, 0x3d, 0x04, 0x1c, 0x03, 0x33, 0x04, 0x1d, 0x00, 0x3d, 0x04, 0x1e, 0x03, 0x39,
+	0x04, 0x1f, 0x00, 0x27, 0x06, 0x20, 0x00, 0x12, 0x07, 0x03, 0x00, 0x42, 0x04, 0x03, 0x02, 0x2b,
+	0x05, 0x00, 0x00, 0x35, 0x06, 0x21, 0x00, 0x39, 0x07, 0x16, 0x03, 0x3d, 0x07, 0x16, 0x06, 0x39,
+	0x07, 0x18, 0x03, 0x3d, 0x07, 0x18, 0x06, 0x39, 0x07, 0x1a, 0x03, 0x3d, 0x07, 0x1a, 0x06, 0x39,
+	0x07, 0x1c, 0x03, 0x3d, 0x07, 0x1c, 0x06, 0x39, 0x07, 0x1f, 0x00, 0x27, 0x09, 0x22, 0x00, 0x12,
+	0x0a, 0x06, 0x00, 0x42, 0x07, 0x03, 0x02, 0x33, 0x02, 0x23, 0x00, 0x33, 0x03, 0x24, 0x00, 0x33,
+	0x04, 0x25, 0x00, 0x12, 0x05, 0x02, 0x00, 0x27, 0x07, 0x26, 0x00, 0x42, 0x05, 0x02, 0x02, 0x33,
+	0x06, 0x27, 0x00, 0x33, 0x07, 0x28, 0x00, 0x33, 0x08, 0x29, 0x00, 0x33, 0x09, 0x2a, 0x00, 0x33,
+	0x0a, 0x2b, 0x00, 0x33, 0x0b, 0x2c, 0x00, 0x33, 0x0c, 0x2d, 0x00, 0x29, 0x0d, 0x01, 0x00, 0x37,
+	0x0d, 0x13, 0x00, 0x35, 0x0d, 0x2e, 0x00, 0x3d, 0x05, 0x2f, 0x0d, 0x35, 0x0e, 0x30, 0x00, 0x3d,
+	0x06, 0x31, 0x0e, 0x3d, 0x07, 0x32, 0x0e, 0x3d, 0x08, 0x33, 0x0e, 0x3d, 0x09, 0x34, 0x0e, 0x3d,
+	0x0a, 0x35, 0x0e, 0x3d, 0x0e, 0x36, 0x0d, 0x3d, 0x0b, 0x37, 0x0d, 0x3d, 0x0c, 0x38, 0x0d, 0x3d,
+	0x02, 0x39, 0x0d, 0x3d, 0x03, 0x3a, 0x0d, 0x3d, 0x04, 0x3b, 0x0d, 0x32, 0x00, 0x00, 0x80, 0x4c,
+	0x0d, 0x02, 0x00, 0x1a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x61, 0x62, 0x6c, 0x65,
+	0x5f, 0x74, 0x6f, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x1a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x74, 0x6f, 0x5f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x09,
+	0x68, 0x61, 0x73, 0x68, 0x0c, 0x74, 0x6f, 0x73, 0x73, 0x69, 0x7a, 0x65, 0x0b, 0x74, 0x6f, 0x73,
+	0x69, 0x7a, 0x65, 0x08, 0x6c, 0x6f, 0x67, 0x0a, 0x70, 0x61, 0x6e, 0x69, 0x63, 0x0a, 0x65, 0x72,
+	0x72, 0x6f, 0x72, 0x09, 0x77, 0x61, 0x72, 0x6e, 0x09, 0x69, 0x6e, 0x66, 0x6f, 0x0a, 0x64, 0x65,
+	0x62, 0x75, 0x67, 0x01, 0x00, 0x00, 0x0d, 0x48, 0x41, 0x53, 0x48, 0x5f, 0x4c, 0x55, 0x41, 0x01,
+	0x00, 0x7a, 0x1e, 0x44, 0x45, 0x56, 0x49, 0x43, 0x45, 0x4f, 0x52, 0x49, 0x45, 0x4e, 0x54, 0x41,
+	0x54, 0x49, 0x4f, 0x4e, 0x5f, 0x55, 0x4e, 0x4b, 0x4e, 0x4f, 0x57, 0x4e, 0x03, 0x00, 0x16, 0x41,
+	0x52, 0x43, 0x48, 0x49, 0x54, 0x45, 0x43, 0x54, 0x55, 0x52, 0x45, 0x5f, 0x4d, 0x49, 0x50, 0x53,
+	0x03, 0x09, 0x18, 0x41, 0x52, 0x43, 0x48, 0x49, 0x54, 0x45, 0x43, 0x54, 0x55, 0x52, 0x45, 0x5f,
+	0x58, 0x38, 0x36, 0x5f, 0x36, 0x34, 0x03, 0x01, 0x14, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x54,
+	0x59, 0x50, 0x45, 0x5f, 0x50, 0x49, 0x50, 0x45, 0x03, 0x06, 0x14, 0x53, 0x54, 0x52, 0x45, 0x41,
+	0x4d, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x46, 0x49, 0x4c, 0x45, 0x03, 0x02, 0x18, 0x50, 0x52, 0x4f,
+	0x43, 0x45, 0x53, 0x53, 0x5f, 0x57, 0x41, 0x49, 0x54, 0x5f, 0x46, 0x41, 0x49, 0x4c, 0x45, 0x44,
+	0x03, 0xf3, 0xff, 0xff, 0xff, 0x07, 0x15, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x4c, 0x45, 0x56, 0x45,
+	0x4c, 0x5f, 0x50, 0x41, 0x4e, 0x49, 0x43, 0x03, 0x05, 0x1d, 0x50, 0x52, 0x4f, 0x43, 0x45, 0x53,
+	0x53, 0x5f, 0x57, 0x41, 0x49, 0x54, 0x5f, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x52, 0x55, 0x50, 0x54,
+	0x45, 0x44, 0x03, 0xf2, 0xff, 0xff, 0xff, 0x07, 0x19, 0x50, 0x52, 0x4f, 0x43, 0x45, 0x53, 0x53,
+	0x5f, 0x53, 0x54, 0x49, 0x4c, 0x4c, 0x5f, 0x41, 0x43, 0x54, 0x49, 0x56, 0x45, 0x03, 0xff, 0xff,
+	0xff, 0xff, 0x07, 0x20, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x5f, 0x50, 0x52, 0x49, 0x4f, 0x52,
+	0x49, 0x54, 0x59, 0x5f, 0x42, 0x45, 0x4c, 0x4f, 0x57, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x03,
+	0x01, 0x13, 0x57, 0x41, 0x52, 0x4e, 0x49, 0x4e, 0x47, 0x5f, 0x4d, 0x45, 0x4d, 0x4f, 0x52, 0x59,
+	0x03, 0x03, 0x21, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x5f, 0x50, 0x52, 0x49, 0x4f, 0x52, 0x49,
+	0x54, 0x59, 0x5f, 0x54, 0x49, 0x4d, 0x45, 0x43, 0x52, 0x49, 0x54, 0x49, 0x43, 0x41, 0x4c, 0x03,
+	0x05, 0x23, 0x44, 0x45, 0x56, 0x49, 0x43, 0x45, 0x4f, 0x52, 0x49, 0x45, 0x4e, 0x54, 0x41, 0x54,
+	0x49, 0x4f, 0x4e, 0x5f, 0x4c, 0x41, 0x4e, 0x44, 0x53, 0x43, 0x41, 0x50, 0x45, 0x5f, 0x43, 0x57,
+	0x03, 0x04, 0x1e, 0x46, 0x4f, 0x55, 0x4e, 0x44, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x45, 0x56, 0x45,
+	0x4e, 0x54, 0x5f, 0x54, 0x45, 0x52, 0x4d, 0x49, 0x4e, 0x41, 0x54, 0x45, 0x03, 0x02, 0x18, 0x53,
+	0x54, 0x52, 0x45, 0x41, 0x4d, 0x5f, 0x53, 0x45, 0x45, 0x4b, 0x5f, 0x43, 0x55, 0x52, 0x52, 0x45,
+	0x4e, 0x54, 0x03, 0x01, 0x15, 0x57, 0x41, 0x52, 0x4e, 0x49, 0x4e, 0x47, 0x5f, 0x52, 0x45, 0x53,
+	0x4f, 0x55, 0x52, 0x43, 0x45, 0x03, 0x09, 0x15, 0x52, 0x41, 0x44, 0x49, 0x58, 0x53, 0x4f, 0x52,
+	0x54, 0x5f, 0x55, 0x49, 0x4e, 0x54, 0x33, 0x32, 0x03, 0x01, 0x26, 0x50, 0x52, 0x4f, 0x43, 0x45,
+	0x53, 0x53, 0x5f, 0x4d, 0x41, 0x43, 0x4f, 0x53, 0x5f, 0x55, 0x53, 0x45, 0x5f, 0x4f, 0x50, 0x45,
+	0x4e, 0x41, 0x50, 0x50, 0x4c, 0x49, 0x43, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x03, 0x10, 0x19, 0x41,
+	0x52, 0x43, 0x48, 0x49, 0x54, 0x45, 0x43, 0x54, 0x55, 0x52, 0x45, 0x5f, 0x41, 0x52, 0x4d, 0x38,
+	0x5f, 0x36, 0x34, 0x03, 0x08, 0x16, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x5f, 0x53, 0x45, 0x45,
+	0x4b, 0x5f, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x03, 0x00, 0x1f, 0x44, 0x45, 0x56, 0x49, 0x43, 0x45,
+	0x4f, 0x52, 0x49, 0x45, 0x4e, 0x54, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x5f, 0x50, 0x4f, 0x52, 0x54,
+	0x52, 0x41, 0x49, 0x54, 0x03, 0x01, 0x0e, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x5f, 0x49, 0x4e,
+	0x03, 0x01, 0x12, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x5f, 0x42, 0x49, 0x4e, 0x41, 0x52, 0x59,
+	0x03, 0x80, 0x02, 0x18, 0x41, 0x52, 0x43, 0x48, 0x49, 0x54, 0x45, 0x43, 0x54, 0x55, 0x52, 0x45,
+	0x5f, 0x50, 0x50, 0x43, 0x5f, 0x36, 0x34, 0x03, 0x03, 0x1b, 0x46, 0x4f, 0x55, 0x4e, 0x44, 0x41,
+	0x54, 0x49, 0x4f, 0x4e, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45,
+	0x03, 0x04, 0x16, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x4d, 0x45,
+	0x4d, 0x4f, 0x52, 0x59, 0x03, 0x01, 0x1d, 0x57, 0x41, 0x52, 0x4e, 0x49, 0x4e, 0x47, 0x5f, 0x53,
+	0x59, 0x53, 0x54, 0x45, 0x4d, 0x5f, 0x43, 0x41, 0x4c, 0x4c, 0x5f, 0x46, 0x41, 0x49, 0x4c, 0x03,
+	0x06, 0x18, 0x42, 0x59, 0x54, 0x45, 0x4f, 0x52, 0x44, 0x45, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x45,
+	0x4e, 0x44, 0x49, 0x41, 0x4e, 0x03, 0x01, 0x11, 0x50, 0x4c, 0x41, 0x54, 0x46, 0x4f, 0x52, 0x4d,
+	0x5f, 0x42, 0x53, 0x44, 0x03, 0x06, 0x15, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x4c, 0x45, 0x56, 0x45,
+	0x4c, 0x5f, 0x44, 0x45, 0x42, 0x55, 0x47, 0x03, 0x01, 0x25, 0x50, 0x52, 0x4f, 0x43, 0x45, 0x53,
+	0x53, 0x5f, 0x57, 0x49, 0x4e, 0x44, 0x4f, 0x57, 0x53, 0x5f, 0x55, 0x53, 0x45, 0x5f, 0x53, 0x48,
+	0x45, 0x4c, 0x4c, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x45, 0x03, 0x08, 0x15, 0x4d, 0x45, 0x4d,
+	0x4f, 0x52, 0x59, 0x5f, 0x54, 0x45, 0x4d, 0x50, 0x4f, 0x52, 0x41, 0x52, 0x59, 0x03, 0x01, 0x1a,
+	0x46, 0x4f, 0x55, 0x4e, 0x44, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f,
+	0x50, 0x41, 0x55, 0x53, 0x45, 0x03, 0x03, 0x22, 0x46, 0x4f, 0x55, 0x4e, 0x44, 0x41, 0x54, 0x49,
+	0x4f, 0x4e, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x46, 0x49, 0x4c, 0x45, 0x5f, 0x4d, 0x4f, 0x44,
+	0x49, 0x46, 0x49, 0x45, 0x44, 0x03, 0x09, 0x15, 0x50, 0x52, 0x4f, 0x43, 0x45, 0x53, 0x53, 0x5f,
+	0x44, 0x45, 0x54, 0x41, 0x43, 0x48, 0x45, 0x44, 0x03, 0x01, 0x14, 0x53, 0x54, 0x52, 0x45, 0x41,
+	0x4d, 0x5f, 0x53, 0x45, 0x45, 0x4b, 0x5f, 0x45, 0x4e, 0x44, 0x03, 0x02, 0x15, 0x52, 0x41, 0x44,
+	0x49, 0x58, 0x53, 0x4f, 0x52, 0x54, 0x5f, 0x55, 0x49, 0x4e, 0x54, 0x36, 0x34, 0x03, 0x03, 0x15,
+	0x41, 0x52, 0x43, 0x48, 0x49, 0x54, 0x45, 0x43, 0x54, 0x55, 0x52, 0x45, 0x5f, 0x50, 0x50, 0x43,
+	0x03, 0x02, 0x1a, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x5f, 0x4e, 0x4f, 0x54, 0x5f, 0x49, 0x4d, 0x50,
+	0x4c, 0x45, 0x4d, 0x45, 0x4e, 0x54, 0x45, 0x44, 0x03, 0x03, 0x16, 0x45, 0x52, 0x52, 0x4f, 0x52,
+	0x5f, 0x4d, 0x45, 0x4d, 0x4f, 0x52, 0x59, 0x5f, 0x4c, 0x45, 0x41, 0x4b, 0x03, 0x05, 0x1b, 0x42,
+	0x59, 0x54, 0x45, 0x4f, 0x52, 0x44, 0x45, 0x52, 0x5f, 0x4c, 0x49, 0x54, 0x54, 0x4c, 0x45, 0x45,
+	0x4e, 0x44, 0x49, 0x41, 0x4e, 0x03, 0x00, 0x17, 0x57, 0x41, 0x52, 0x4e, 0x49, 0x4e, 0x47, 0x5f,
+	0x53, 0x55, 0x53, 0x50, 0x49, 0x43, 0x49, 0x4f, 0x55, 0x53, 0x03, 0x05, 0x1b, 0x45, 0x52, 0x52,
+	0x4f, 0x52, 0x5f, 0x55, 0x4e, 0x4b, 0x4e, 0x4f, 0x57, 0x4e, 0x5f, 0x52, 0x45, 0x53, 0x4f, 0x55,
+	0x52, 0x43, 0x45, 0x03, 0x0c, 0x1c, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x5f, 0x50, 0x52, 0x49,
+	0x4f, 0x52, 0x49, 0x54, 0x59, 0x5f, 0x48, 0x49, 0x47, 0x48, 0x45, 0x53, 0x54, 0x03, 0x04, 0x19,
+	0x41, 0x52, 0x43, 0x48, 0x49, 0x54, 0x45, 0x43, 0x54, 0x55, 0x52, 0x45, 0x5f, 0x47, 0x45, 0x4e,
+	0x45, 0x52, 0x49, 0x43, 0x03, 0x0b, 0x15, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x5f, 0x44, 0x45, 0x50,
+	0x52, 0x45, 0x43, 0x41, 0x54, 0x45, 0x44, 0x03, 0x0d, 0x11, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x5f,
+	0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x03, 0x0f, 0x14, 0x52, 0x41, 0x44, 0x49, 0x58, 0x53, 0x4f,
+	0x52, 0x54, 0x5f, 0x49, 0x4e, 0x54, 0x33, 0x32, 0x03, 0x00, 0x15, 0x57, 0x41, 0x52, 0x4e, 0x49,
+	0x4e, 0x47, 0x5f, 0x44, 0x45, 0x41, 0x44, 0x4c, 0x4f, 0x43, 0x4b, 0x03, 0x07, 0x21, 0x46, 0x4f,
+	0x55, 0x4e, 0x44, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x46, 0x49,
+	0x4c, 0x45, 0x5f, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x44, 0x03, 0x08, 0x15, 0x45, 0x52, 0x52,
+	0x4f, 0x52, 0x4c, 0x45, 0x56, 0x45, 0x4c, 0x5f, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x03, 0x04, 0x13,
+	0x50, 0x4c, 0x41, 0x54, 0x46, 0x4f, 0x52, 0x4d, 0x5f, 0x4c, 0x49, 0x4e, 0x55, 0x58, 0x03, 0x01,
+	0x20, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x5f, 0x50, 0x52, 0x49, 0x4f, 0x52, 0x49, 0x54, 0x59,
+	0x5f, 0x41, 0x42, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x03, 0x03, 0x18, 0x45,
+	0x52, 0x52, 0x4f, 0x52, 0x5f, 0x41, 0x43, 0x43, 0x45, 0x53, 0x53, 0x5f, 0x44, 0x45, 0x4e, 0x49,
+	0x45, 0x44, 0x03, 0x08, 0x19, 0x41, 0x52, 0x43, 0x48, 0x49, 0x54, 0x45, 0x43, 0x54, 0x55, 0x52,
+	0x45, 0x5f, 0x4d, 0x49, 0x50, 0x53, 0x5f, 0x36, 0x34, 0x03, 0x0a, 0x11, 0x45, 0x52, 0x52, 0x4f,
+	0x52, 0x5f, 0x41, 0x53, 0x53, 0x45, 0x52, 0x54, 0x03, 0x0e, 0x19, 0x50, 0x52, 0x4f, 0x43, 0x45,
+	0x53, 0x53, 0x5f, 0x49, 0x4e, 0x56, 0x41, 0x4c, 0x49, 0x44, 0x5f, 0x41, 0x52, 0x47, 0x53, 0x03,
+	0xf0, 0xff, 0xff, 0xff, 0x07, 0x1e, 0x50, 0x52, 0x4f, 0x43, 0x45, 0x53, 0x53, 0x5f, 0x54, 0x45,
+	0x52, 0x4d, 0x49, 0x4e, 0x41, 0x54, 0x45, 0x44, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x4c, 0x03,
+	0xf1, 0xff, 0xff, 0xff, 0x07, 0x19, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x54, 0x59, 0x50, 0x45,
+	0x5f, 0x53, 0x54, 0x44, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x03, 0x07, 0x16, 0x45, 0x52, 0x52,
+	0x4f, 0x52, 0x5f, 0x55, 0x4e, 0x53, 0x55, 0x50, 0x50, 0x4f, 0x52, 0x54, 0x45, 0x44, 0x03, 0x02,
+	0x14, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x44, 0x45, 0x4c, 0x41, 0x59,
+	0x03, 0x01, 0x11, 0x50, 0x4c, 0x41, 0x54, 0x46, 0x4f, 0x52, 0x4d, 0x5f, 0x49, 0x4f, 0x53, 0x03,
+	0x03, 0x13, 0x50, 0x4c, 0x41, 0x54, 0x46, 0x4f, 0x52, 0x4d, 0x5f, 0x54, 0x49, 0x5a, 0x45, 0x4e,
+	0x03, 0x07, 0x1a, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x52, 0x49,
+	0x4e, 0x47, 0x42, 0x55, 0x46, 0x46, 0x45, 0x52, 0x03, 0x04, 0x18, 0x45, 0x52, 0x52, 0x4f, 0x52,
+	0x5f, 0x4f, 0x55, 0x54, 0x5f, 0x4f, 0x46, 0x5f, 0x4d, 0x45, 0x4d, 0x4f, 0x52, 0x59, 0x03, 0x04,
+	0x27, 0x46, 0x4f, 0x55, 0x4e, 0x44, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x45, 0x56, 0x45, 0x4e, 0x54,
+	0x5f, 0x44, 0x45, 0x56, 0x49, 0x43, 0x45, 0x5f, 0x4f, 0x52, 0x49, 0x45, 0x4e, 0x54, 0x41, 0x54,
+	0x49, 0x4f, 0x4e, 0x03, 0x0b, 0x13, 0x57, 0x41, 0x52, 0x4e, 0x49, 0x4e, 0x47, 0x5f, 0x53, 0x43,
+	0x52, 0x49, 0x50, 0x54, 0x03, 0x08, 0x17, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x54, 0x59, 0x50,
+	0x45, 0x5f, 0x49, 0x4e, 0x56, 0x41, 0x4c, 0x49, 0x44, 0x03, 0x00, 0x16, 0x41, 0x52, 0x43, 0x48,
+	0x49, 0x54, 0x45, 0x43, 0x54, 0x55, 0x52, 0x45, 0x5f, 0x41, 0x52, 0x4d, 0x38, 0x03, 0x07, 0x18,
+	0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x5f, 0x50, 0x52, 0x49, 0x4f, 0x52, 0x49, 0x54, 0x59, 0x5f,
+	0x4c, 0x4f, 0x57, 0x03, 0x00, 0x14, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x43, 0x49, 0x50, 0x48, 0x45,
+	0x52, 0x5f, 0x43, 0x42, 0x43, 0x03, 0x01, 0x14, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x43, 0x49, 0x50,
+	0x48, 0x45, 0x52, 0x5f, 0x45, 0x43, 0x42, 0x03, 0x00, 0x17, 0x50, 0x52, 0x4f, 0x43, 0x45, 0x53,
+	0x53, 0x5f, 0x53, 0x54, 0x44, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x53, 0x03, 0x04, 0x11, 0x53,
+	0x54, 0x52, 0x45, 0x41, 0x4d, 0x5f, 0x41, 0x54, 0x45, 0x4e, 0x44, 0x03, 0x40, 0x1b, 0x45, 0x52,
+	0x52, 0x4f, 0x52, 0x5f, 0x4d, 0x45, 0x4d, 0x4f, 0x52, 0x59, 0x5f, 0x41, 0x4c, 0x49, 0x47, 0x4e,
+	0x4d, 0x45, 0x4e, 0x54, 0x03, 0x06, 0x16, 0x41, 0x52, 0x43, 0x48, 0x49, 0x54, 0x45, 0x43, 0x54,
+	0x55, 0x52, 0x45, 0x5f, 0x41, 0x52, 0x4d, 0x37, 0x03, 0x06, 0x17, 0x45, 0x52, 0x52, 0x4f, 0x52,
+	0x4c, 0x45, 0x56, 0x45, 0x4c, 0x5f, 0x57, 0x41, 0x52, 0x4e, 0x49, 0x4e, 0x47, 0x03, 0x03, 0x15,
+	0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x41, 0x53, 0x53, 0x45, 0x54,
+	0x03, 0x05, 0x16, 0x41, 0x52, 0x43, 0x48, 0x49, 0x54, 0x45, 0x43, 0x54, 0x55, 0x52, 0x45, 0x5f,
+	0x41, 0x52, 0x4d, 0x35, 0x03, 0x04, 0x16, 0x41, 0x52, 0x43, 0x48, 0x49, 0x54, 0x45, 0x43, 0x54,
+	0x55, 0x52, 0x45, 0x5f, 0x41, 0x52, 0x4d, 0x36, 0x03, 0x05, 0x15, 0x50, 0x4c, 0x41, 0x54, 0x46,
+	0x4f, 0x52, 0x4d, 0x5f, 0x57, 0x49, 0x4e, 0x44, 0x4f, 0x57, 0x53, 0x03, 0x00, 0x10, 0x53, 0x54,
+	0x52, 0x45, 0x41, 0x4d, 0x5f, 0x53, 0x59, 0x4e, 0x43, 0x03, 0x80, 0x04, 0x14, 0x45, 0x52, 0x52,
+	0x4f, 0x52, 0x4c, 0x45, 0x56, 0x45, 0x4c, 0x5f, 0x4e, 0x4f, 0x4e, 0x45, 0x03, 0x00, 0x0f, 0x45,
+	0x52, 0x52, 0x4f, 0x52, 0x5f, 0x4e, 0x4f, 0x4e, 0x45, 0x03, 0x00, 0x1a, 0x57, 0x41, 0x52, 0x4e,
+	0x49, 0x4e, 0x47, 0x5f, 0x49, 0x4e, 0x56, 0x41, 0x4c, 0x49, 0x44, 0x5f, 0x56, 0x41, 0x4c, 0x55,
+	0x45, 0x03, 0x02, 0x24, 0x44, 0x45, 0x56, 0x49, 0x43, 0x45, 0x4f, 0x52, 0x49, 0x45, 0x4e, 0x54,
+	0x41, 0x54, 0x49, 0x4f, 0x4e, 0x5f, 0x4c, 0x41, 0x4e, 0x44, 0x53, 0x43, 0x41, 0x50, 0x45, 0x5f,
+	0x43, 0x43, 0x57, 0x03, 0x03, 0x17, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x5f, 0x55, 0x4e, 0x4b, 0x4e,
+	0x4f, 0x57, 0x4e, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x03, 0x0b, 0x13, 0x50, 0x4c, 0x41, 0x54, 0x46,
+	0x4f, 0x52, 0x4d, 0x5f, 0x4d, 0x41, 0x43, 0x4f, 0x53, 0x03, 0x02, 0x18, 0x57, 0x41, 0x52, 0x4e,
+	0x49, 0x4e, 0x47, 0x5f, 0x50, 0x45, 0x52, 0x46, 0x4f, 0x52, 0x4d, 0x41, 0x4e, 0x43, 0x45, 0x03,
+	0x00, 0x18, 0x57, 0x41, 0x52, 0x4e, 0x49, 0x4e, 0x47, 0x5f, 0x55, 0x4e, 0x53, 0x55, 0x50, 0x50,
+	0x4f, 0x52, 0x54, 0x45, 0x44, 0x03, 0x04, 0x17, 0x57, 0x41, 0x52, 0x4e, 0x49, 0x4e, 0x47, 0x5f,
+	0x44, 0x45, 0x50, 0x52, 0x45, 0x43, 0x41, 0x54, 0x45, 0x44, 0x03, 0x01, 0x14, 0x42, 0x4c, 0x4f,
+	0x43, 0x4b, 0x43, 0x49, 0x50, 0x48, 0x45, 0x52, 0x5f, 0x43, 0x46, 0x42, 0x03, 0x02, 0x0f, 0x53,
+	0x54, 0x52, 0x45, 0x41, 0x4d, 0x5f, 0x4f, 0x55, 0x54, 0x03, 0x02, 0x1f, 0x46, 0x4f, 0x55, 0x4e,
+	0x44, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x46, 0x4f, 0x43, 0x55,
+	0x53, 0x5f, 0x47, 0x41, 0x49, 0x4e, 0x03, 0x05, 0x16, 0x52, 0x41, 0x44, 0x49, 0x58, 0x53, 0x4f,
+	0x52, 0x54, 0x5f, 0x46, 0x4c, 0x4f, 0x41, 0x54, 0x33, 0x32, 0x03, 0x04, 0x16, 0x4d, 0x45, 0x4d,
+	0x4f, 0x52, 0x59, 0x5f, 0x50, 0x45, 0x52, 0x53, 0x49, 0x53, 0x54, 0x45, 0x4e, 0x54, 0x03, 0x00,
+	0x1b, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x5f, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4d, 0x5f, 0x43, 0x41,
+	0x4c, 0x4c, 0x5f, 0x46, 0x41, 0x49, 0x4c, 0x03, 0x0a, 0x14, 0x50, 0x52, 0x4f, 0x43, 0x45, 0x53,
+	0x53, 0x5f, 0x43, 0x4f, 0x4e, 0x53, 0x4f, 0x4c, 0x45, 0x03, 0x02, 0x1c, 0x4d, 0x45, 0x4d, 0x4f,
+	0x52, 0x59, 0x5f, 0x5a, 0x45, 0x52, 0x4f, 0x5f, 0x49, 0x4e, 0x49, 0x54, 0x49, 0x41, 0x4c, 0x49,
+	0x5a, 0x45, 0x44, 0x03, 0x08, 0x1b, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x5f, 0x50, 0x52, 0x49,
+	0x4f, 0x52, 0x49, 0x54, 0x59, 0x5f, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x03, 0x02, 0x1f, 0x46,
+	0x4f, 0x55, 0x4e, 0x44, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x46,
+	0x4f, 0x43, 0x55, 0x53, 0x5f, 0x4c, 0x4f, 0x53, 0x54, 0x03, 0x06, 0x1a, 0x46, 0x4f, 0x55, 0x4e,
+	0x44, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x53, 0x54, 0x41, 0x52,
+	0x54, 0x03, 0x01, 0x27, 0x44, 0x45, 0x56, 0x49, 0x43, 0x45, 0x4f, 0x52, 0x49, 0x45, 0x4e, 0x54,
+	0x41, 0x54, 0x49, 0x4f, 0x4e, 0x5f, 0x50, 0x4f, 0x52, 0x54, 0x52, 0x41, 0x49, 0x54, 0x5f, 0x46,
+	0x4c, 0x49, 0x50, 0x50, 0x45, 0x44, 0x03, 0x02, 0x19, 0x50, 0x4c, 0x41, 0x54, 0x46, 0x4f, 0x52,
+	0x4d, 0x5f, 0x52, 0x41, 0x53, 0x50, 0x42, 0x45, 0x52, 0x52, 0x59, 0x50, 0x49, 0x03, 0x05, 0x1b,
+	0x45, 0x52, 0x52, 0x4f, 0x52, 0x5f, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x4e, 0x41, 0x4c, 0x5f, 0x46,
+	0x41, 0x49, 0x4c, 0x55, 0x52, 0x45, 0x03, 0x07, 0x14, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x43, 0x49,
+	0x50, 0x48, 0x45, 0x52, 0x5f, 0x4f, 0x46, 0x42, 0x03, 0x03, 0x27, 0x46, 0x4f, 0x55, 0x4e, 0x44,
+	0x41, 0x54, 0x49, 0x4f, 0x4e, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x4c, 0x4f, 0x57, 0x5f, 0x4d,
+	0x45, 0x4d, 0x4f, 0x52, 0x59, 0x5f, 0x57, 0x41, 0x52, 0x4e, 0x49, 0x4e, 0x47, 0x03, 0x0a, 0x14,
+	0x45, 0x52, 0x52, 0x4f, 0x52, 0x5f, 0x45, 0x58, 0x43, 0x45, 0x50, 0x54, 0x49, 0x4f, 0x4e, 0x03,
+	0x09, 0x15, 0x41, 0x52, 0x43, 0x48, 0x49, 0x54, 0x45, 0x43, 0x54, 0x55, 0x52, 0x45, 0x5f, 0x58,
+	0x38, 0x36, 0x03, 0x00, 0x12, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x5f, 0x43, 0x52, 0x45, 0x41,
+	0x54, 0x45, 0x03, 0x20, 0x1d, 0x44, 0x45, 0x56, 0x49, 0x43, 0x45, 0x4f, 0x52, 0x49, 0x45, 0x4e,
+	0x54, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x5f, 0x46, 0x41, 0x43, 0x45, 0x55, 0x50, 0x03, 0x05, 0x16,
+	0x52, 0x41, 0x44, 0x49, 0x58, 0x53, 0x4f, 0x52, 0x54, 0x5f, 0x46, 0x4c, 0x4f, 0x41, 0x54, 0x36,
+	0x34, 0x03, 0x05, 0x14, 0x52, 0x41, 0x44, 0x49, 0x58, 0x53, 0x4f, 0x52, 0x54, 0x5f, 0x49, 0x4e,
+	0x54, 0x36, 0x34, 0x03, 0x02, 0x15, 0x50, 0x52, 0x4f, 0x43, 0x45, 0x53, 0x53, 0x5f, 0x41, 0x54,
+	0x54, 0x41, 0x43, 0x48, 0x45, 0x44, 0x03, 0x00, 0x1f, 0x44, 0x45, 0x56, 0x49, 0x43, 0x45, 0x4f,
+	0x52, 0x49, 0x45, 0x4e, 0x54, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x5f, 0x46, 0x41, 0x43, 0x45, 0x44,
+	0x4f, 0x57, 0x4e, 0x03, 0x06, 0x16, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x54, 0x59, 0x50, 0x45,
+	0x5f, 0x53, 0x4f, 0x43, 0x4b, 0x45, 0x54, 0x03, 0x03, 0x14, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x4c,
+	0x45, 0x56, 0x45, 0x4c, 0x5f, 0x49, 0x4e, 0x46, 0x4f, 0x03, 0x02, 0x18, 0x45, 0x52, 0x52, 0x4f,
+	0x52, 0x5f, 0x49, 0x4e, 0x56, 0x41, 0x4c, 0x49, 0x44, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x03,
+	0x01, 0x12, 0x4d, 0x45, 0x4d, 0x4f, 0x52, 0x59, 0x5f, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x03,
+	0x02, 0x14, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x5f, 0x54, 0x52, 0x55, 0x4e, 0x43, 0x41, 0x54,
+	0x45, 0x03, 0x10, 0x21, 0x46, 0x4f, 0x55, 0x4e, 0x44, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x45, 0x56,
+	0x45, 0x4e, 0x54, 0x5f, 0x46, 0x49, 0x4c, 0x45, 0x5f, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x44,
+	0x03, 0x07, 0x15, 0x50, 0x4c, 0x41, 0x54, 0x46, 0x4f, 0x52, 0x4d, 0x5f, 0x41, 0x4e, 0x44, 0x52,
+	0x4f, 0x49, 0x44, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6c, 0x75, 0x61,
+	0x00, 0x00, 0x00, 0x13, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x5f, 0x74, 0x01, 0x00, 0x00, 0x0d, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x0d, 0x6d,
+	0x65, 0x74, 0x61, 0x74, 0x79, 0x70, 0x65, 0x09, 0x5f, 0x5f, 0x67, 0x63, 0x00, 0x0f, 0x5f, 0x5f,
+	0x74, 0x6f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x0a, 0x5f, 0x5f, 0x6c, 0x65, 0x6e, 0x00,
+	0x09, 0x5f, 0x5f, 0x65, 0x71, 0x00, 0x0d, 0x5f, 0x5f, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x01,
+	0x00, 0x00, 0x00, 0x1e, 0x5f, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f,
+	0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x87, 0xd3, 0x01,
+	0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
+	0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x20, 0x61, 0x70,
+	0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70,
+	0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x62, 0x69, 0x74, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x20, 0x62, 0x6c, 0x6f, 0x77, 0x66, 0x69, 0x73, 0x68, 0x5f, 0x74, 0x20, 0x62,
+	0x6c, 0x6f, 0x77, 0x66, 0x69, 0x73, 0x68, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64,
+	0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x62, 0x65, 0x61, 0x63, 0x6f, 0x6e,
+	0x5f, 0x74, 0x20, 0x62, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70,
+	0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6f,
+	0x72, 0x5f, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x5f, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x5f,
+	0x66, 0x72, 0x61, 0x6d, 0x65, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x5f, 0x63, 0x6f,
+	0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x5f, 0x63, 0x6f,
+	0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x20,
+	0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x62, 0x6c,
+	0x6f, 0x63, 0x6b, 0x5f, 0x74, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x62, 0x6c, 0x6f, 0x63,
+	0x6b, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d,
+	0x5f, 0x74, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f,
+	0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x20, 0x66, 0x73, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x70, 0x61, 0x79, 0x6c, 0x6f,
+	0x61, 0x64, 0x5f, 0x74, 0x20, 0x66, 0x73, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x70, 0x61,
+	0x79, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f,
+	0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x6e,
+	0x6f, 0x64, 0x65, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x20,
+	0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64,
+	0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61,
+	0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x74, 0x20, 0x68, 0x61,
+	0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f,
+	0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x65, 0x6e,
+	0x74, 0x72, 0x79, 0x5f, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x36,
+	0x34, 0x5f, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64,
+	0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61,
+	0x62, 0x6c, 0x65, 0x5f, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f,
+	0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x74, 0x20,
+	0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x74, 0x3b, 0x0a, 0x74,
+	0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x68, 0x61,
+	0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68,
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64,
+	0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x74,
+	0x6f, 0x6b, 0x65, 0x6e, 0x5f, 0x74, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65,
+	0x6e, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x20, 0x6d, 0x64, 0x35, 0x5f, 0x74, 0x20, 0x6d, 0x64, 0x35, 0x5f, 0x74, 0x3b,
+	0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
+	0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f, 0x74,
+	0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f,
+	0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f,
+	0x74, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f,
+	0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x65, 0x72,
+	0x5f, 0x74, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x65,
+	0x72, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x20, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x5f, 0x74, 0x20, 0x6d, 0x75, 0x74, 0x65,
+	0x78, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x5f,
+	0x74, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x5f, 0x74, 0x3b,
+	0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
+	0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x20, 0x6f, 0x62, 0x6a, 0x65,
+	0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f,
+	0x74, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70,
+	0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x72, 0x61, 0x64, 0x69,
+	0x78, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x74, 0x20, 0x72, 0x61, 0x64, 0x69, 0x78, 0x73, 0x6f, 0x72,
+	0x74, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x20, 0x72, 0x65, 0x67, 0x65, 0x78, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x67, 0x65,
+	0x78, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x20, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74,
+	0x20, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x3b, 0x0a, 0x74,
+	0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x73, 0x68,
+	0x61, 0x32, 0x35, 0x36, 0x5f, 0x74, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x5f, 0x74, 0x3b,
+	0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
+	0x73, 0x68, 0x61, 0x35, 0x31, 0x32, 0x5f, 0x74, 0x20, 0x73, 0x68, 0x61, 0x35, 0x31, 0x32, 0x5f,
+	0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x20, 0x73, 0x65, 0x6d, 0x61, 0x70, 0x68, 0x6f, 0x72, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x65,
+	0x6d, 0x61, 0x70, 0x68, 0x6f, 0x72, 0x65, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64,
+	0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d,
+	0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70,
+	0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70,
+	0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x70, 0x69, 0x70, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d,
+	0x5f, 0x70, 0x69, 0x70, 0x65, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66,
+	0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x72,
+	0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x3b,
+	0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x76, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x74, 0x20,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x76, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x74, 0x3b,
+	0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
+	0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f,
+	0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6e,
+	0x66, 0x69, 0x67, 0x5f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x74, 0x3b, 0x0a, 0x0a, 0x74, 0x79, 0x70, 0x65,
+	0x64, 0x65, 0x66, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x6f, 0x62, 0x6a,
+	0x65, 0x63, 0x74, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x75,
+	0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x3b, 0x0a,
+	0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74,
+	0x20, 0x74, 0x69, 0x63, 0x6b, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66,
+	0x20, 0x72, 0x65, 0x61, 0x6c, 0x20, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x74, 0x69, 0x6d, 0x65, 0x5f,
+	0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x31,
+	0x36, 0x5f, 0x74, 0x20, 0x72, 0x61, 0x64, 0x69, 0x78, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x5f, 0x74, 0x3b, 0x0a, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20,
+	0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x7b, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f,
+	0x74, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x32, 0x5d, 0x3b, 0x20, 0x7d, 0x20, 0x75, 0x69, 0x6e,
+	0x74, 0x31, 0x32, 0x38, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20,
+	0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x7b, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f,
+	0x74, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x34, 0x5d, 0x3b, 0x20, 0x7d, 0x20, 0x75, 0x69, 0x6e,
+	0x74, 0x32, 0x35, 0x36, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20,
+	0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x7b, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f,
+	0x74, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x38, 0x5d, 0x3b, 0x20, 0x7d, 0x20, 0x75, 0x69, 0x6e,
+	0x74, 0x35, 0x31, 0x32, 0x5f, 0x74, 0x3b, 0x0a, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66,
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x32, 0x38, 0x5f, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f,
+	0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x31,
+	0x32, 0x38, 0x5f, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x3b, 0x0a,
+	0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
+	0x7b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x20, 0x73, 0x74, 0x72, 0x3b, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x7d, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20,
+	0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x7b, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x20, 0x73, 0x74, 0x72, 0x3b, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x7d, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x3b, 0x0a, 0x0a, 0x74, 0x79, 0x70, 0x65,
+	0x64, 0x65, 0x66, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x28, 0x2a, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72,
+	0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x5f, 0x66, 0x6e, 0x29, 0x28, 0x69, 0x6e, 0x74,
+	0x2c, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20,
+	0x69, 0x6e, 0x74, 0x20, 0x28, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x5f, 0x68, 0x61,
+	0x6e, 0x64, 0x6c, 0x65, 0x72, 0x5f, 0x66, 0x6e, 0x29, 0x28, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74,
+	0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61,
+	0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c,
+	0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x28, 0x2a, 0x20, 0x6c, 0x6f, 0x67, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c,
+	0x65, 0x72, 0x5f, 0x66, 0x6e, 0x29, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c,
+	0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65,
+	0x64, 0x65, 0x66, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x28, 0x2a, 0x20, 0x6f, 0x62, 0x6a, 0x65,
+	0x63, 0x74, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x5f, 0x66, 0x6e,
+	0x20, 0x29, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74, 0x2c, 0x20, 0x76, 0x6f, 0x69,
+	0x64, 0x2a, 0x29, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x28, 0x2a, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x77, 0x72, 0x69,
+	0x74, 0x65, 0x5f, 0x66, 0x6e, 0x20, 0x29, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x75,
+	0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65,
+	0x66, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x28, 0x2a, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c,
+	0x65, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x66, 0x6e, 0x20, 0x29, 0x28, 0x76, 0x6f, 0x69, 0x64,
+	0x2a, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x74, 0x79,
+	0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20,
+	0x28, 0x2a, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 0x5f, 0x66,
+	0x6e, 0x20, 0x29, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+	0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20,
+	0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20, 0x28, 0x2a, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f,
+	0x66, 0x6e, 0x20, 0x29, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x29, 0x3b, 0x0a, 0x74, 0x79, 0x70,
+	0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x5f, 0x74, 0x20, 0x28, 0x2a, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x6d, 0x61,
+	0x70, 0x5f, 0x66, 0x6e, 0x29, 0x28, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x61, 0x6c, 0x6c, 0x6f,
+	0x63, 0x61, 0x74, 0x65, 0x5f, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x28, 0x75, 0x6e, 0x73,
+	0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x2a, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65,
+	0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+	0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64,
+	0x2a, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20,
+	0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x70, 0x6f,
+	0x69, 0x6e, 0x74, 0x65, 0x72, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64,
+	0x2a, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x5f,
+	0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f,
+	0x69, 0x64, 0x2a, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x29,
+	0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74,
+	0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64,
+	0x2a, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x5f,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69,
+	0x64, 0x2a, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28,
+	0x76, 0x6f, 0x69, 0x64, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x5f,
+	0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x5f, 0x66, 0x6e, 0x20, 0x61, 0x73, 0x73, 0x65, 0x72,
+	0x74, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x5f, 0x73, 0x65, 0x74,
+	0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x28, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x5f,
+	0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x5f, 0x66, 0x6e, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74,
+	0x20, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x28, 0x75,
+	0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x5f, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20,
+	0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x0a,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x5f, 0x65, 0x6e,
+	0x63, 0x6f, 0x64, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x20, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x5f, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x62, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x74, 0x2a, 0x20, 0x62,
+	0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x76,
+	0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x65, 0x61, 0x63, 0x6f,
+	0x6e, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x62, 0x65, 0x61,
+	0x63, 0x6f, 0x6e, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x65,
+	0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x62, 0x65,
+	0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62,
+	0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65,
+	0x28, 0x62, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74,
+	0x20, 0x62, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x77, 0x61, 0x69, 0x74, 0x28, 0x62, 0x65, 0x61,
+	0x63, 0x6f, 0x6e, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x65, 0x61,
+	0x63, 0x6f, 0x6e, 0x5f, 0x74, 0x72, 0x79, 0x5f, 0x77, 0x61, 0x69, 0x74, 0x28, 0x62, 0x65, 0x61,
+	0x63, 0x6f, 0x6e, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+	0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x65, 0x61, 0x63,
+	0x6f, 0x6e, 0x5f, 0x66, 0x69, 0x72, 0x65, 0x28, 0x62, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74,
+	0x2a, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x61, 0x6c, 0x6c, 0x6f,
+	0x63, 0x61, 0x74, 0x65, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x76, 0x6f, 0x69, 0x64,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29,
+	0x3b, 0x0a, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x20, 0x62,
+	0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74,
+	0x65, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x62,
+	0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x69, 0x6e, 0x69,
+	0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x62,
+	0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x76, 0x6f, 0x69,
+	0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65,
+	0x72, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x5f, 0x73, 0x74, 0x72,
+	0x65, 0x61, 0x6d, 0x28, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a,
+	0x2c, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x66, 0x69, 0x6e,
+	0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x62, 0x69,
+	0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x33, 0x32, 0x28, 0x62,
+	0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73,
+	0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74,
+	0x36, 0x34, 0x5f, 0x74, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x72,
+	0x65, 0x61, 0x64, 0x36, 0x34, 0x28, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74,
+	0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x32, 0x38, 0x5f, 0x74, 0x20, 0x62, 0x69, 0x74,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x31, 0x32, 0x38, 0x28, 0x62,
+	0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73,
+	0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61,
+	0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f,
+	0x72, 0x65, 0x61, 0x64, 0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x32, 0x28, 0x62, 0x69, 0x74,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61,
+	0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f,
+	0x72, 0x65, 0x61, 0x64, 0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x36, 0x34, 0x28, 0x62, 0x69, 0x74,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65,
+	0x33, 0x32, 0x28, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+	0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62,
+	0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x36, 0x34,
+	0x28, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75,
+	0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+	0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x69, 0x74,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x31, 0x32, 0x38, 0x28,
+	0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x69,
+	0x6e, 0x74, 0x31, 0x32, 0x38, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+	0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x69, 0x74,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x66, 0x6c, 0x6f,
+	0x61, 0x74, 0x33, 0x32, 0x28, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74,
+	0x2a, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x77, 0x72,
+	0x69, 0x74, 0x65, 0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x36, 0x34, 0x28, 0x62, 0x69, 0x74, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x36,
+	0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75,
+	0x66, 0x66, 0x65, 0x72, 0x5f, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x28,
+	0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x62, 0x6f,
+	0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x5f, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28,
+	0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x62, 0x6f,
+	0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x5f, 0x64, 0x69, 0x73, 0x63, 0x61, 0x72, 0x64, 0x5f, 0x72, 0x65, 0x61, 0x64,
+	0x28, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x69, 0x74, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x64,
+	0x69, 0x73, 0x63, 0x61, 0x72, 0x64, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x62, 0x69, 0x74,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x75, 0x69, 0x6e,
+	0x74, 0x31, 0x36, 0x5f, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x5f,
+	0x73, 0x77, 0x61, 0x70, 0x31, 0x36, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x74, 0x29,
+	0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x6f,
+	0x72, 0x64, 0x65, 0x72, 0x5f, 0x73, 0x77, 0x61, 0x70, 0x33, 0x32, 0x28, 0x75, 0x69, 0x6e, 0x74,
+	0x33, 0x32, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x20,
+	0x62, 0x79, 0x74, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x5f, 0x73, 0x77, 0x61, 0x70, 0x36, 0x34,
+	0x28, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x62, 0x79, 0x74, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x5f, 0x73, 0x77, 0x61, 0x70, 0x28,
+	0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x74, 0x20, 0x62,
+	0x79, 0x74, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x65, 0x6e, 0x64, 0x69,
+	0x61, 0x6e, 0x31, 0x36, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x6f, 0x72, 0x64,
+	0x65, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x65, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x33, 0x32, 0x28, 0x75,
+	0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34,
+	0x5f, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x69, 0x67,
+	0x65, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x36, 0x34, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x6f, 0x72, 0x64,
+	0x65, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x65, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x28, 0x76, 0x6f, 0x69,
+	0x64, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65,
+	0x6f, 0x72, 0x64, 0x65, 0x72, 0x5f, 0x6c, 0x69, 0x74, 0x74, 0x6c, 0x65, 0x65, 0x6e, 0x64, 0x69,
+	0x61, 0x6e, 0x31, 0x36, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x6f, 0x72, 0x64,
+	0x65, 0x72, 0x5f, 0x6c, 0x69, 0x74, 0x74, 0x6c, 0x65, 0x65, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x33,
+	0x32, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e,
+	0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x5f,
+	0x6c, 0x69, 0x74, 0x74, 0x6c, 0x65, 0x65, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x36, 0x34, 0x28, 0x75,
+	0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62,
+	0x79, 0x74, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x5f, 0x6c, 0x69, 0x74, 0x74, 0x6c, 0x65, 0x65,
+	0x6e, 0x64, 0x69, 0x61, 0x6e, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x62, 0x6c, 0x6f,
+	0x77, 0x66, 0x69, 0x73, 0x68, 0x5f, 0x74, 0x2a, 0x20, 0x62, 0x6c, 0x6f, 0x77, 0x66, 0x69, 0x73,
+	0x68, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+	0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x6c, 0x6f, 0x77, 0x66, 0x69, 0x73, 0x68, 0x5f,
+	0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x62, 0x6c, 0x6f, 0x77, 0x66,
+	0x69, 0x73, 0x68, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x6c,
+	0x6f, 0x77, 0x66, 0x69, 0x73, 0x68, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a,
+	0x65, 0x28, 0x62, 0x6c, 0x6f, 0x77, 0x66, 0x69, 0x73, 0x68, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x6c, 0x6f, 0x77, 0x66, 0x69,
+	0x73, 0x68, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x62, 0x6c, 0x6f, 0x77,
+	0x66, 0x69, 0x73, 0x68, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62,
+	0x6c, 0x6f, 0x77, 0x66, 0x69, 0x73, 0x68, 0x5f, 0x65, 0x6e, 0x63, 0x72, 0x79, 0x70, 0x74, 0x28,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x62, 0x6c, 0x6f, 0x77, 0x66, 0x69, 0x73, 0x68, 0x5f, 0x74,
+	0x2a, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29,
+	0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x6c, 0x6f, 0x77, 0x66, 0x69, 0x73, 0x68, 0x5f,
+	0x64, 0x65, 0x63, 0x72, 0x79, 0x70, 0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x62, 0x6c,
+	0x6f, 0x77, 0x66, 0x69, 0x73, 0x68, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x75,
+	0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x65, 0x61,
+	0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64,
+	0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c,
+	0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d,
+	0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x76, 0x6f,
+	0x69, 0x64, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+	0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a,
+	0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x5f, 0x74, 0x2a, 0x20, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65,
+	0x6e, 0x74, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x28,
+	0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e,
+	0x74, 0x5f, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x6e, 0x61, 0x6d,
+	0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d,
+	0x65, 0x6e, 0x74, 0x5f, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x64,
+	0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x65,
+	0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x65, 0x78, 0x65, 0x63, 0x75,
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+	0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74,
+	0x20, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x69, 0x6e, 0x69,
+	0x74, 0x69, 0x61, 0x6c, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x69, 0x72,
+	0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x65, 0x6e, 0x76,
+	0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+	0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f,
+	0x72, 0x79, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x65,
+	0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x63,
+	0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x5f, 0x64,
+	0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x65, 0x6e,
+	0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x68, 0x6f, 0x6d, 0x65, 0x5f, 0x64,
+	0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x65,
+	0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x65, 0x6d, 0x70, 0x6f,
+	0x72, 0x61, 0x72, 0x79, 0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x76,
+	0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x5f, 0x74, 0x20, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74,
+	0x5f, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x0a, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+	0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x5f, 0x72, 0x65, 0x70, 0x6f,
+	0x72, 0x74, 0x28, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74,
+	0x5f, 0x70, 0x75, 0x73, 0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x5f, 0x63, 0x6f, 0x6e, 0x74,
+	0x65, 0x78, 0x74, 0x5f, 0x70, 0x6f, 0x70, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78,
+	0x74, 0x5f, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x5f, 0x63, 0x6f,
+	0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x63, 0x68, 0x61,
+	0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x65, 0x72, 0x72,
+	0x6f, 0x72, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f, 0x74, 0x2a, 0x20, 0x65, 0x72,
+	0x72, 0x6f, 0x72, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x28, 0x76, 0x6f, 0x69, 0x64,
+	0x29, 0x3b, 0x0a, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72,
+	0x5f, 0x66, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x65, 0x72,
+	0x6c, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x65, 0x72,
+	0x72, 0x6f, 0x72, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x28,
+	0x65, 0x72, 0x72, 0x6f, 0x72, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x5f, 0x66, 0x6e,
+	0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x70,
+	0x6f, 0x73, 0x74, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d,
+	0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x74, 0x2c, 0x20, 0x6f,
+	0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74, 0x2c, 0x20, 0x74, 0x69, 0x63, 0x6b, 0x5f, 0x74, 0x2c,
+	0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x3b, 0x0a, 0x65, 0x76, 0x65, 0x6e,
+	0x74, 0x5f, 0x74, 0x2a, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x28,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x62, 0x6c, 0x6f, 0x63,
+	0x6b, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x70, 0x61,
+	0x79, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x65, 0x76, 0x65, 0x6e,
+	0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x65, 0x76, 0x65, 0x6e,
+	0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74,
+	0x65, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x64, 0x65, 0x61,
+	0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74,
+	0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x65,
+	0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+	0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72,
+	0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x65, 0x76, 0x65, 0x6e,
+	0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x65, 0x76,
+	0x65, 0x6e, 0x74, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x74, 0x2a, 0x20, 0x65, 0x76, 0x65,
+	0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73,
+	0x73, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x62, 0x65, 0x61, 0x63, 0x6f, 0x6e,
+	0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a,
+	0x2c, 0x20, 0x62, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x66, 0x73, 0x5f, 0x6f, 0x70, 0x65, 0x6e,
+	0x5f, 0x66, 0x69, 0x6c, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+	0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x66,
+	0x73, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c,
+	0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x66, 0x73, 0x5f, 0x72,
+	0x65, 0x6d, 0x6f, 0x76, 0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x66, 0x73, 0x5f, 0x69, 0x73, 0x5f, 0x66, 0x69, 0x6c, 0x65,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x66, 0x73, 0x5f, 0x6d,
+	0x61, 0x6b, 0x65, 0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x66, 0x73, 0x5f, 0x72, 0x65, 0x6d, 0x6f,
+	0x76, 0x65, 0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x66, 0x73, 0x5f, 0x69, 0x73, 0x5f, 0x64, 0x69,
+	0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x74, 0x69,
+	0x63, 0x6b, 0x5f, 0x74, 0x20, 0x66, 0x73, 0x5f, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x6d, 0x6f, 0x64,
+	0x69, 0x66, 0x69, 0x65, 0x64, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x66, 0x73, 0x5f, 0x74, 0x6f, 0x75, 0x63, 0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x66, 0x73, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x32, 0x38, 0x5f, 0x74, 0x20, 0x66,
+	0x73, 0x5f, 0x6d, 0x64, 0x35, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x5f, 0x74, 0x2a, 0x20, 0x66, 0x73, 0x5f, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e,
+	0x67, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f,
+	0x74, 0x2a, 0x20, 0x66, 0x73, 0x5f, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x5f, 0x66,
+	0x69, 0x6c, 0x65, 0x73, 0x5f, 0x72, 0x65, 0x67, 0x65, 0x78, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20,
+	0x72, 0x65, 0x67, 0x65, 0x78, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b,
+	0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x2a, 0x20, 0x66, 0x73, 0x5f, 0x66, 0x69,
+	0x6c, 0x65, 0x73, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x5f, 0x74, 0x2a, 0x20, 0x66, 0x73, 0x5f, 0x73, 0x75, 0x62, 0x64, 0x69, 0x72, 0x73, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x66, 0x73, 0x5f, 0x6d, 0x6f, 0x6e,
+	0x69, 0x74, 0x6f, 0x72, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x66, 0x73, 0x5f, 0x75, 0x6e, 0x6d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x28, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x66, 0x73, 0x5f,
+	0x74, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x61, 0x72, 0x79, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x28, 0x76,
+	0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x66, 0x73, 0x5f, 0x65, 0x76,
+	0x65, 0x6e, 0x74, 0x5f, 0x70, 0x6f, 0x73, 0x74, 0x28, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x5f, 0x74, 0x20, 0x66, 0x73, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x70, 0x61, 0x74, 0x68,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x2a, 0x29,
+	0x3b, 0x0a, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74,
+	0x2a, 0x20, 0x66, 0x73, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61,
+	0x6d, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+	0x6e, 0x5f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x76,
+	0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x68,
+	0x61, 0x73, 0x68, 0x5f, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20,
+	0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x6f, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x68,
+	0x61, 0x73, 0x68, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70,
+	0x5f, 0x74, 0x2a, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x61, 0x6c, 0x6c, 0x6f,
+	0x63, 0x61, 0x74, 0x65, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d,
+	0x61, 0x70, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x68, 0x61,
+	0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69,
+	0x7a, 0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x66, 0x69, 0x6e,
+	0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70,
+	0x5f, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x28, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64,
+	0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61,
+	0x70, 0x5f, 0x65, 0x72, 0x61, 0x73, 0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x2a, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75,
+	0x70, 0x28, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x68, 0x61,
+	0x73, 0x68, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x68, 0x61, 0x73, 0x68,
+	0x6d, 0x61, 0x70, 0x5f, 0x68, 0x61, 0x73, 0x5f, 0x6b, 0x65, 0x79, 0x28, 0x68, 0x61, 0x73, 0x68,
+	0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f,
+	0x73, 0x69, 0x7a, 0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a, 0x20,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f,
+	0x63, 0x6c, 0x65, 0x61, 0x72, 0x28, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x0a, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x74, 0x2a,
+	0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
+	0x61, 0x74, 0x65, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x64, 0x65, 0x61, 0x6c,
+	0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65,
+	0x5f, 0x74, 0x2a, 0x20, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73, 0x68,
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65,
+	0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73,
+	0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28,
+	0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x73, 0x65,
+	0x74, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20,
+	0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x5f, 0x74, 0x2c,
+	0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c,
+	0x65, 0x5f, 0x65, 0x72, 0x61, 0x73, 0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c,
+	0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f,
+	0x69, 0x6e, 0x74, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c,
+	0x65, 0x5f, 0x69, 0x6e, 0x74, 0x5f, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c,
+	0x65, 0x5f, 0x67, 0x65, 0x74, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x69, 0x6e,
+	0x74, 0x5f, 0x74, 0x20, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x68, 0x61,
+	0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x68, 0x61, 0x73,
+	0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x63, 0x6c, 0x65, 0x61, 0x72,
+	0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a,
+	0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x74, 0x2a, 0x20, 0x68,
+	0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
+	0x61, 0x74, 0x65, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x64, 0x65,
+	0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62,
+	0x6c, 0x65, 0x33, 0x32, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68,
+	0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69,
+	0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33,
+	0x32, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f,
+	0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62,
+	0x6c, 0x65, 0x33, 0x32, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68,
+	0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x73, 0x65, 0x74, 0x28, 0x68,
+	0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75,
+	0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62,
+	0x6c, 0x65, 0x33, 0x32, 0x5f, 0x65, 0x72, 0x61, 0x73, 0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74,
+	0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33,
+	0x32, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x68,
+	0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x67, 0x65, 0x74, 0x28, 0x68,
+	0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75,
+	0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x73, 0x69, 0x7a,
+	0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c,
+	0x65, 0x33, 0x32, 0x5f, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61,
+	0x62, 0x6c, 0x65, 0x33, 0x32, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x68, 0x61, 0x73, 0x68, 0x74,
+	0x61, 0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x74, 0x2a, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61,
+	0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73,
+	0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
+	0x61, 0x74, 0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61,
+	0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65,
+	0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68,
+	0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c,
+	0x69, 0x7a, 0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61,
+	0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x73, 0x65, 0x74, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61,
+	0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34,
+	0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f,
+	0x65, 0x72, 0x61, 0x73, 0x65, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x36,
+	0x34, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61,
+	0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x67, 0x65, 0x74, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61,
+	0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68,
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x68, 0x61, 0x73,
+	0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x36, 0x34, 0x5f, 0x63,
+	0x6c, 0x65, 0x61, 0x72, 0x28, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x36, 0x34,
+	0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x6a, 0x73,
+	0x6f, 0x6e, 0x5f, 0x70, 0x61, 0x72, 0x73, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x6a, 0x73,
+	0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x6a, 0x73,
+	0x6f, 0x6e, 0x5f, 0x70, 0x61, 0x72, 0x73, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x6a, 0x73,
+	0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x5f, 0x74, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x5f,
+	0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6a, 0x73,
+	0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x6a, 0x73, 0x6f,
+	0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x75,
+	0x6e, 0x65, 0x73, 0x63, 0x61, 0x70, 0x65, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61,
+	0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72,
+	0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x65, 0x73, 0x63, 0x61, 0x70,
+	0x65, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c,
+	0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74,
+	0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74, 0x20, 0x6c, 0x69, 0x62,
+	0x72, 0x61, 0x72, 0x79, 0x5f, 0x72, 0x65, 0x66, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79,
+	0x5f, 0x75, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79,
+	0x5f, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74,
+	0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x5f, 0x6e,
+	0x61, 0x6d, 0x65, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62,
+	0x6f, 0x6f, 0x6c, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x5f, 0x76, 0x61, 0x6c, 0x69,
+	0x64, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x6c, 0x6f, 0x67, 0x5f, 0x64, 0x65, 0x62, 0x75, 0x67, 0x66, 0x28, 0x68, 0x61,
+	0x73, 0x68, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6c, 0x6f, 0x67, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x66, 0x28,
+	0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6c, 0x6f, 0x67, 0x5f, 0x77, 0x61, 0x72, 0x6e,
+	0x66, 0x28, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6c,
+	0x6f, 0x67, 0x5f, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x66, 0x28, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74,
+	0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61,
+	0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29,
+	0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6c, 0x6f, 0x67, 0x5f, 0x70, 0x61, 0x6e, 0x69, 0x63,
+	0x66, 0x28, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6c,
+	0x6f, 0x67, 0x5f, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x73, 0x74, 0x64, 0x6f, 0x75, 0x74,
+	0x28, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6c, 0x6f, 0x67,
+	0x5f, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x28, 0x62,
+	0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6c, 0x6f, 0x67, 0x5f, 0x73,
+	0x65, 0x74, 0x5f, 0x73, 0x75, 0x70, 0x70, 0x72, 0x65, 0x73, 0x73, 0x28, 0x68, 0x61, 0x73, 0x68,
+	0x5f, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x6f,
+	0x67, 0x5f, 0x73, 0x75, 0x70, 0x70, 0x72, 0x65, 0x73, 0x73, 0x28, 0x68, 0x61, 0x73, 0x68, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6c, 0x6f, 0x67, 0x5f, 0x73, 0x75, 0x70,
+	0x70, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x28, 0x76, 0x6f, 0x69, 0x64,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6c, 0x6f, 0x67, 0x5f, 0x65, 0x72, 0x72, 0x6f,
+	0x72, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x28, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74,
+	0x2c, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x6c, 0x6f, 0x67, 0x5f, 0x68, 0x61, 0x6e, 0x64,
+	0x6c, 0x65, 0x72, 0x5f, 0x66, 0x6e, 0x20, 0x6c, 0x6f, 0x67, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c,
+	0x65, 0x72, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6c,
+	0x6f, 0x67, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x28, 0x6c,
+	0x6f, 0x67, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x5f, 0x66, 0x6e, 0x29, 0x3b, 0x0a,
+	0x0a, 0x6d, 0x64, 0x35, 0x5f, 0x74, 0x2a, 0x20, 0x6d, 0x64, 0x35, 0x5f, 0x61, 0x6c, 0x6c, 0x6f,
+	0x63, 0x61, 0x74, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x6d, 0x64, 0x35, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28,
+	0x6d, 0x64, 0x35, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x64,
+	0x35, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x6d, 0x64, 0x35,
+	0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x64, 0x35, 0x5f, 0x66,
+	0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x6d, 0x64, 0x35, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x6d, 0x64, 0x35, 0x5f, 0x74, 0x2a, 0x20, 0x6d, 0x64, 0x35, 0x5f, 0x64, 0x69, 0x67, 0x65,
+	0x73, 0x74, 0x28, 0x6d, 0x64, 0x35, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x64, 0x35, 0x5f, 0x64, 0x69, 0x67, 0x65, 0x73, 0x74,
+	0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x6d, 0x64, 0x35, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x6d, 0x64, 0x35, 0x5f,
+	0x67, 0x65, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x65, 0x73, 0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x6d, 0x64, 0x35, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x32, 0x38,
+	0x5f, 0x74, 0x20, 0x6d, 0x64, 0x35, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x65, 0x73,
+	0x74, 0x5f, 0x72, 0x61, 0x77, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6d, 0x64, 0x35, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20, 0x6d, 0x65, 0x6d, 0x6f,
+	0x72, 0x79, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x75, 0x69, 0x6e, 0x74,
+	0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x6e,
+	0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69,
+	0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x2a,
+	0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61,
+	0x74, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+	0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x65, 0x6d, 0x6f,
+	0x72, 0x79, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x76, 0x6f,
+	0x69, 0x64, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
+	0x79, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f, 0x70, 0x75, 0x73, 0x68, 0x28, 0x68,
+	0x61, 0x73, 0x68, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x65, 0x6d,
+	0x6f, 0x72, 0x79, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f, 0x70, 0x6f, 0x70, 0x28,
+	0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x20, 0x6d, 0x65,
+	0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x28, 0x76, 0x6f, 0x69,
+	0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x5f, 0x74, 0x2a, 0x20, 0x6d, 0x75,
+	0x74, 0x65, 0x78, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x5f, 0x64, 0x65,
+	0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x5f, 0x74, 0x20, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x6d, 0x75,
+	0x74, 0x65, 0x78, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6d, 0x75,
+	0x74, 0x65, 0x78, 0x5f, 0x74, 0x72, 0x79, 0x5f, 0x6c, 0x6f, 0x63, 0x6b, 0x28, 0x6d, 0x75, 0x74,
+	0x65, 0x78, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6d, 0x75, 0x74,
+	0x65, 0x78, 0x5f, 0x6c, 0x6f, 0x63, 0x6b, 0x28, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x5f, 0x75, 0x6e,
+	0x6c, 0x6f, 0x63, 0x6b, 0x28, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a,
+	0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x5f, 0x77, 0x61, 0x69, 0x74, 0x28,
+	0x6d, 0x75, 0x74, 0x65, 0x78, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+	0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x75,
+	0x74, 0x65, 0x78, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x28, 0x6d, 0x75, 0x74, 0x65, 0x78,
+	0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70,
+	0x5f, 0x74, 0x2a, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x61, 0x6c,
+	0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x64,
+	0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74,
+	0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6f, 0x62,
+	0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69,
+	0x7a, 0x65, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6f,
+	0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a,
+	0x65, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61,
+	0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6f, 0x62, 0x6a,
+	0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x6f, 0x62, 0x6a, 0x65,
+	0x63, 0x74, 0x5f, 0x74, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x72,
+	0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70,
+	0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63,
+	0x74, 0x6d, 0x61, 0x70, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74,
+	0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61,
+	0x70, 0x5f, 0x73, 0x65, 0x74, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74, 0x2c, 0x20, 0x76, 0x6f,
+	0x69, 0x64, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20, 0x6f, 0x62, 0x6a, 0x65,
+	0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x72, 0x61, 0x77, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70,
+	0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x2a, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x6f,
+	0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x72, 0x65, 0x66, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6f,
+	0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x6f, 0x62, 0x6a,
+	0x65, 0x63, 0x74, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6f, 0x62, 0x6a,
+	0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x75, 0x6e,
+	0x72, 0x65, 0x66, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74,
+	0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74,
+	0x2c, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
+	0x61, 0x74, 0x65, 0x5f, 0x66, 0x6e, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20, 0x6f,
+	0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x28,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x6d, 0x61, 0x70, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x70,
+	0x61, 0x74, 0x68, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x6e, 0x61,
+	0x6d, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x62, 0x61, 0x73,
+	0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x5f, 0x77, 0x69, 0x74, 0x68,
+	0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20,
+	0x70, 0x61, 0x74, 0x68, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73,
+	0x69, 0x6f, 0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x66, 0x69,
+	0x6c, 0x65, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x70, 0x61, 0x74,
+	0x68, 0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x5f, 0x6e, 0x61, 0x6d, 0x65,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x73, 0x75, 0x62, 0x70, 0x61,
+	0x74, 0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x70, 0x61, 0x74,
+	0x68, 0x5f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20,
+	0x70, 0x61, 0x74, 0x68, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x70, 0x5f, 0x70, 0x72, 0x6f, 0x74, 0x6f,
+	0x63, 0x6f, 0x6c, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x5f, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65,
+	0x5f, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e,
+	0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68,
+	0x5f, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61,
+	0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29,
+	0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x5f,
+	0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f,
+	0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x70, 0x72, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x3b,
+	0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x61,
+	0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x63, 0x6c,
+	0x65, 0x61, 0x6e, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c,
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x69, 0x73, 0x5f, 0x61, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74,
+	0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74,
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x74, 0x65, 0x6d, 0x70, 0x6f,
+	0x72, 0x61, 0x72, 0x79, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20,
+	0x70, 0x69, 0x70, 0x65, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x76, 0x6f,
+	0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x69, 0x70, 0x65, 0x5f, 0x69,
+	0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d,
+	0x5f, 0x70, 0x69, 0x70, 0x65, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x70, 0x69, 0x70, 0x65, 0x5f, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x28,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x70, 0x69, 0x70, 0x65, 0x5f, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x5f, 0x77, 0x72, 0x69, 0x74,
+	0x65, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x70,
+	0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73,
+	0x73, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+	0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x64,
+	0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73,
+	0x73, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x63,
+	0x65, 0x73, 0x73, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x70,
+	0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a,
+	0x65, 0x28, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x73, 0x65, 0x74, 0x5f,
+	0x77, 0x6f, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72,
+	0x79, 0x28, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73,
+	0x5f, 0x73, 0x65, 0x74, 0x5f, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f,
+	0x70, 0x61, 0x74, 0x68, 0x28, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x63,
+	0x65, 0x73, 0x73, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+	0x73, 0x28, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x66,
+	0x6c, 0x61, 0x67, 0x73, 0x28, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x73, 0x65, 0x74,
+	0x5f, 0x76, 0x65, 0x72, 0x62, 0x28, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a,
+	0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f,
+	0x63, 0x65, 0x73, 0x73, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x65, 0x78, 0x69, 0x74, 0x5f, 0x63, 0x6f,
+	0x64, 0x65, 0x28, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x6f,
+	0x63, 0x65, 0x73, 0x73, 0x5f, 0x73, 0x70, 0x61, 0x77, 0x6e, 0x28, 0x70, 0x72, 0x6f, 0x63, 0x65,
+	0x73, 0x73, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74,
+	0x2a, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x73, 0x74, 0x64, 0x6f, 0x75, 0x74,
+	0x28, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x74,
+	0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f,
+	0x73, 0x74, 0x64, 0x69, 0x6e, 0x28, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x77,
+	0x61, 0x69, 0x74, 0x28, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x65, 0x78, 0x69,
+	0x74, 0x5f, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x65, 0x78, 0x69, 0x74, 0x28,
+	0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x66,
+	0x69, 0x6c, 0x65, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+	0x5f, 0x73, 0x68, 0x75, 0x74, 0x64, 0x6f, 0x77, 0x6e, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x65, 0x6e,
+	0x61, 0x62, 0x6c, 0x65, 0x28, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x6f, 0x75, 0x74,
+	0x70, 0x75, 0x74, 0x28, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x77, 0x72, 0x69, 0x74,
+	0x65, 0x5f, 0x66, 0x6e, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x66,
+	0x69, 0x6c, 0x65, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x77,
+	0x61, 0x69, 0x74, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x5f,
+	0x65, 0x6e, 0x64, 0x5f, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c,
+	0x65, 0x5f, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+	0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x28, 0x76, 0x6f,
+	0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c,
+	0x65, 0x5f, 0x65, 0x6e, 0x64, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x28, 0x76, 0x6f, 0x69, 0x64,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x5f,
+	0x6c, 0x6f, 0x67, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70,
+	0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x74, 0x72, 0x79, 0x6c, 0x6f, 0x63, 0x6b, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c,
+	0x65, 0x5f, 0x6c, 0x6f, 0x63, 0x6b, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61,
+	0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x75, 0x6e, 0x6c, 0x6f, 0x63, 0x6b,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x66,
+	0x69, 0x6c, 0x65, 0x5f, 0x77, 0x61, 0x69, 0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x73, 0x69, 0x67, 0x6e,
+	0x61, 0x6c, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x72, 0x61, 0x64, 0x69, 0x78, 0x73,
+	0x6f, 0x72, 0x74, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x61, 0x64, 0x69, 0x78, 0x73, 0x6f, 0x72, 0x74,
+	0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x72,
+	0x61, 0x64, 0x69, 0x78, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x61, 0x64, 0x69, 0x78, 0x73, 0x6f, 0x72,
+	0x74, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x72, 0x61, 0x64,
+	0x69, 0x78, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x72, 0x61, 0x64, 0x69, 0x78, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69,
+	0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x72, 0x61, 0x64, 0x69, 0x78, 0x73, 0x6f, 0x72, 0x74, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x72, 0x61, 0x64, 0x69, 0x78, 0x73, 0x6f,
+	0x72, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x72, 0x61, 0x64, 0x69, 0x78, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x66, 0x69, 0x6e, 0x61,
+	0x6c, 0x69, 0x7a, 0x65, 0x28, 0x72, 0x61, 0x64, 0x69, 0x78, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x61, 0x64, 0x69, 0x78, 0x73,
+	0x6f, 0x72, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x61, 0x64,
+	0x69, 0x78, 0x73, 0x6f, 0x72, 0x74, 0x28, 0x72, 0x61, 0x64, 0x69, 0x78, 0x73, 0x6f, 0x72, 0x74,
+	0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a,
+	0x2c, 0x20, 0x72, 0x61, 0x64, 0x69, 0x78, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20,
+	0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x33, 0x32, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a,
+	0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x33,
+	0x32, 0x5f, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74,
+	0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e,
+	0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x36, 0x34, 0x28, 0x76,
+	0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x72,
+	0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x36, 0x34, 0x5f, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x28, 0x75, 0x69,
+	0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x72, 0x65, 0x61, 0x6c, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x5f, 0x6e,
+	0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b,
+	0x0a, 0x72, 0x65, 0x61, 0x6c, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x5f, 0x72, 0x61, 0x6e,
+	0x67, 0x65, 0x28, 0x72, 0x65, 0x61, 0x6c, 0x2c, 0x20, 0x72, 0x65, 0x61, 0x6c, 0x29, 0x3b, 0x0a,
+	0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x33, 0x32,
+	0x5f, 0x67, 0x61, 0x75, 0x73, 0x73, 0x69, 0x61, 0x6e, 0x5f, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x28,
+	0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x72, 0x65, 0x61, 0x6c, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x5f, 0x67,
+	0x61, 0x75, 0x73, 0x73, 0x69, 0x61, 0x6e, 0x5f, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x28, 0x72, 0x65,
+	0x61, 0x6c, 0x2c, 0x20, 0x72, 0x65, 0x61, 0x6c, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x33, 0x32,
+	0x5f, 0x74, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x33, 0x32, 0x5f, 0x74, 0x72, 0x69, 0x61,
+	0x6e, 0x67, 0x6c, 0x65, 0x5f, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x32,
+	0x5f, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x72, 0x65,
+	0x61, 0x6c, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x5f, 0x74, 0x72, 0x69, 0x61, 0x6e, 0x67,
+	0x6c, 0x65, 0x5f, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x28, 0x72, 0x65, 0x61, 0x6c, 0x2c, 0x20, 0x72,
+	0x65, 0x61, 0x6c, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x72,
+	0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x33, 0x32, 0x5f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x65, 0x64,
+	0x28, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x72, 0x65, 0x61, 0x6c, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x72, 0x65, 0x67, 0x65, 0x78, 0x5f,
+	0x74, 0x2a, 0x20, 0x72, 0x65, 0x67, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72, 0x65, 0x67, 0x65,
+	0x78, 0x5f, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x28, 0x72, 0x65, 0x67, 0x65, 0x78, 0x5f, 0x74, 0x2a,
+	0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x67, 0x65, 0x78, 0x5f, 0x64, 0x65, 0x61, 0x6c,
+	0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x72, 0x65, 0x67, 0x65, 0x78, 0x5f, 0x74, 0x2a, 0x29,
+	0x3b, 0x0a, 0x0a, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a,
+	0x20, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x61, 0x6c, 0x6c, 0x6f,
+	0x63, 0x61, 0x74, 0x65, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x64, 0x65,
+	0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x69,
+	0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c,
+	0x69, 0x7a, 0x65, 0x28, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x66, 0x69, 0x6e, 0x61,
+	0x6c, 0x69, 0x7a, 0x65, 0x28, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x72, 0x69, 0x6e, 0x67,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x72, 0x69, 0x6e, 0x67,
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x72, 0x65, 0x73, 0x65,
+	0x74, 0x28, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x29,
+	0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x28, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x72,
+	0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28,
+	0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x72, 0x69,
+	0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x72,
+	0x65, 0x61, 0x64, 0x28, 0x20, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x72, 0x69,
+	0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x77,
+	0x72, 0x69, 0x74, 0x74, 0x65, 0x6e, 0x28, 0x20, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x5f, 0x74, 0x2a, 0x20, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f,
+	0x74, 0x2a, 0x20, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x73, 0x74,
+	0x72, 0x65, 0x61, 0x6d, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65,
+	0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66,
+	0x65, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x5f,
+	0x74, 0x2a, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61,
+	0x74, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73,
+	0x68, 0x61, 0x32, 0x35, 0x36, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65,
+	0x28, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x68, 0x61,
+	0x32, 0x35, 0x36, 0x5f, 0x74, 0x2a, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x5f, 0x64, 0x69,
+	0x67, 0x65, 0x73, 0x74, 0x28, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x5f, 0x74, 0x2a, 0x2c, 0x20,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35,
+	0x36, 0x5f, 0x64, 0x69, 0x67, 0x65, 0x73, 0x74, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a,
+	0x65, 0x28, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x5f, 0x67, 0x65,
+	0x74, 0x5f, 0x64, 0x69, 0x67, 0x65, 0x73, 0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73,
+	0x68, 0x61, 0x32, 0x35, 0x36, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x35,
+	0x36, 0x5f, 0x74, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x64,
+	0x69, 0x67, 0x65, 0x73, 0x74, 0x5f, 0x72, 0x61, 0x77, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x68, 0x61,
+	0x35, 0x31, 0x32, 0x5f, 0x74, 0x2a, 0x20, 0x73, 0x68, 0x61, 0x35, 0x31, 0x32, 0x5f, 0x61, 0x6c,
+	0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x73, 0x68, 0x61, 0x35, 0x31, 0x32, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f,
+	0x63, 0x61, 0x74, 0x65, 0x28, 0x73, 0x68, 0x61, 0x35, 0x31, 0x32, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x73, 0x68, 0x61, 0x35, 0x31, 0x32, 0x5f, 0x74, 0x2a, 0x20, 0x73, 0x68, 0x61, 0x35, 0x31,
+	0x32, 0x5f, 0x64, 0x69, 0x67, 0x65, 0x73, 0x74, 0x28, 0x73, 0x68, 0x61, 0x35, 0x31, 0x32, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73,
+	0x68, 0x61, 0x35, 0x31, 0x32, 0x5f, 0x64, 0x69, 0x67, 0x65, 0x73, 0x74, 0x5f, 0x66, 0x69, 0x6e,
+	0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x73, 0x68, 0x61, 0x35, 0x31, 0x32, 0x5f, 0x74, 0x2a, 0x29,
+	0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x68, 0x61, 0x35, 0x31,
+	0x32, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x65, 0x73, 0x74, 0x28, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x73, 0x68, 0x61, 0x35, 0x31, 0x32, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69,
+	0x6e, 0x74, 0x35, 0x31, 0x32, 0x5f, 0x74, 0x20, 0x73, 0x68, 0x61, 0x35, 0x31, 0x32, 0x5f, 0x67,
+	0x65, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x65, 0x73, 0x74, 0x5f, 0x72, 0x61, 0x77, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x73, 0x68, 0x61, 0x35, 0x31, 0x32, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x65, 0x6d, 0x61, 0x70, 0x68, 0x6f, 0x72, 0x65, 0x5f,
+	0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x73, 0x65, 0x6d, 0x61, 0x70,
+	0x68, 0x6f, 0x72, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+	0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x65, 0x6d,
+	0x61, 0x70, 0x68, 0x6f, 0x72, 0x65, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a,
+	0x65, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x64, 0x28, 0x73, 0x65, 0x6d, 0x61, 0x70, 0x68, 0x6f, 0x72,
+	0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+	0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73,
+	0x65, 0x6d, 0x61, 0x70, 0x68, 0x6f, 0x72, 0x65, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a,
+	0x65, 0x28, 0x73, 0x65, 0x6d, 0x61, 0x70, 0x68, 0x6f, 0x72, 0x65, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x65, 0x6d, 0x61, 0x70, 0x68, 0x6f, 0x72, 0x65, 0x5f,
+	0x77, 0x61, 0x69, 0x74, 0x28, 0x73, 0x65, 0x6d, 0x61, 0x70, 0x68, 0x6f, 0x72, 0x65, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x65, 0x6d, 0x61, 0x70, 0x68, 0x6f,
+	0x72, 0x65, 0x5f, 0x74, 0x72, 0x79, 0x5f, 0x77, 0x61, 0x69, 0x74, 0x28, 0x73, 0x65, 0x6d, 0x61,
+	0x70, 0x68, 0x6f, 0x72, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+	0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x65,
+	0x6d, 0x61, 0x70, 0x68, 0x6f, 0x72, 0x65, 0x5f, 0x70, 0x6f, 0x73, 0x74, 0x28, 0x73, 0x65, 0x6d,
+	0x61, 0x70, 0x68, 0x6f, 0x72, 0x65, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x74, 0x72, 0x61, 0x63, 0x65, 0x5f, 0x63,
+	0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x74, 0x72,
+	0x61, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x28, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20,
+	0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f,
+	0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29,
+	0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x64, 0x65,
+	0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d,
+	0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a,
+	0x65, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x65, 0x6c, 0x6c,
+	0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x73, 0x65, 0x65, 0x6b, 0x28, 0x73, 0x74,
+	0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x2c, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x74, 0x72,
+	0x65, 0x61, 0x6d, 0x5f, 0x65, 0x6f, 0x73, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61,
+	0x6d, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x73,
+	0x65, 0x74, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x28, 0x73, 0x74, 0x72,
+	0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x62, 0x69,
+	0x6e, 0x61, 0x72, 0x79, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20,
+	0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x65, 0x5f, 0x62, 0x69, 0x6e,
+	0x61, 0x72, 0x79, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f,
+	0x6c, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x69, 0x73, 0x5f, 0x62, 0x69, 0x6e, 0x61,
+	0x72, 0x79, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62,
+	0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x69, 0x73, 0x5f, 0x73, 0x65,
+	0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d,
+	0x5f, 0x69, 0x73, 0x5f, 0x72, 0x65, 0x6c, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x73, 0x74, 0x72,
+	0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x74,
+	0x72, 0x65, 0x61, 0x6d, 0x5f, 0x69, 0x73, 0x5f, 0x69, 0x6e, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x28,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c,
+	0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x69, 0x73, 0x5f, 0x73, 0x77, 0x61, 0x70, 0x70,
+	0x65, 0x64, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x69,
+	0x6e, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x6f, 0x72,
+	0x64, 0x65, 0x72, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x74, 0x69, 0x63,
+	0x6b, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x6c, 0x61, 0x73, 0x74, 0x5f,
+	0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74,
+	0x2a, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74,
+	0x72, 0x65, 0x61, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x28, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x3b,
+	0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x72, 0x65, 0x61,
+	0x64, 0x5f, 0x62, 0x6f, 0x6f, 0x6c, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x38, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d,
+	0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x38, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61,
+	0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x5f, 0x74, 0x20, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x38,
+	0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74,
+	0x31, 0x36, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64,
+	0x5f, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x33, 0x32,
+	0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x69,
+	0x6e, 0x74, 0x33, 0x32, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d,
+	0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x28, 0x73, 0x74, 0x72,
+	0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74,
+	0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x69, 0x6e, 0x74,
+	0x36, 0x34, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x75,
+	0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x72,
+	0x65, 0x61, 0x64, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61,
+	0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x32, 0x5f, 0x74,
+	0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x66, 0x6c, 0x6f,
+	0x61, 0x74, 0x33, 0x32, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61,
+	0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x36, 0x34, 0x28, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x62,
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x77,
+	0x72, 0x69, 0x74, 0x65, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61,
+	0x6d, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x62, 0x6f, 0x6f, 0x6c, 0x28, 0x73, 0x74, 0x72,
+	0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65,
+	0x5f, 0x69, 0x6e, 0x74, 0x38, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x69, 0x6e, 0x74, 0x38, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x75, 0x69, 0x6e, 0x74,
+	0x38, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x69, 0x6e,
+	0x74, 0x38, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f,
+	0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x73, 0x74, 0x72,
+	0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x77,
+	0x72, 0x69, 0x74, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61,
+	0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x77, 0x72, 0x69, 0x74,
+	0x65, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65,
+	0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a,
+	0x2c, 0x20, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x75, 0x69,
+	0x6e, 0x74, 0x36, 0x34, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20,
+	0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x66, 0x6c, 0x6f,
+	0x61, 0x74, 0x33, 0x32, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20,
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x66, 0x6c,
+	0x6f, 0x61, 0x74, 0x36, 0x34, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x65, 0x6e, 0x64, 0x6c, 0x28, 0x73, 0x74,
+	0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x66, 0x6f, 0x72, 0x6d,
+	0x61, 0x74, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74,
+	0x72, 0x65, 0x61, 0x6d, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x72, 0x65, 0x61, 0x64,
+	0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x61, 0x76, 0x61, 0x69, 0x6c,
+	0x61, 0x62, 0x6c, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d,
+	0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x32, 0x38, 0x5f, 0x74, 0x20,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x6d, 0x64, 0x35, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61,
+	0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x74, 0x72, 0x75, 0x6e, 0x63, 0x61, 0x74, 0x65, 0x28, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x66, 0x6c, 0x75, 0x73,
+	0x68, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x74,
+	0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x6f,
+	0x70, 0x65, 0x6e, 0x5f, 0x73, 0x74, 0x64, 0x6f, 0x75, 0x74, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+	0x3b, 0x0a, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 0x5f, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x28, 0x76,
+	0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 0x5f, 0x73, 0x74, 0x64, 0x69,
+	0x6e, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74,
+	0x72, 0x65, 0x61, 0x6d, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f,
+	0x6c, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 0x5f, 0x66, 0x6e, 0x29, 0x3b, 0x0a,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 0x5f, 0x66, 0x6e, 0x20, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x5f, 0x68,
+	0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61,
+	0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x61, 0x6c,
+	0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74,
+	0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72,
+	0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x28, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x29,
+	0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65,
+	0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x29, 0x3b,
+	0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x6e, 0x75, 0x6c, 0x6c, 0x28, 0x76, 0x6f, 0x69, 0x64,
+	0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f,
+	0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x28, 0x76,
+	0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x6f,
+	0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x29,
+	0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x5f, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+	0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72,
+	0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x6f, 0x72,
+	0x6d, 0x61, 0x74, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x3b, 0x0a, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x6c, 0x65, 0x6e, 0x67,
+	0x74, 0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x29, 0x3b,
+	0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x67,
+	0x6c, 0x79, 0x70, 0x68, 0x73, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x68, 0x61, 0x73, 0x68,
+	0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x72,
+	0x65, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6c,
+	0x61, 0x63, 0x65, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x61, 0x6c, 0x6c, 0x6f,
+	0x63, 0x61, 0x74, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c,
+	0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x63,
+	0x61, 0x74, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61,
+	0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29,
+	0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x5f, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x70, 0x72, 0x65, 0x70, 0x65,
+	0x6e, 0x64, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x2e,
+	0x2e, 0x2e, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x73, 0x75, 0x62, 0x73, 0x74,
+	0x72, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x73, 0x74,
+	0x72, 0x69, 0x70, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x69, 0x6e,
+	0x64, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72,
+	0x69, 0x6e, 0x67, 0x5f, 0x66, 0x69, 0x6e, 0x64, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x5f, 0x72, 0x66, 0x69, 0x6e, 0x64, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61,
+	0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x72, 0x66, 0x69, 0x6e, 0x64, 0x5f, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x69, 0x6e, 0x64, 0x5f, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x5f, 0x6f, 0x66, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x69, 0x6e, 0x64, 0x5f, 0x6c, 0x61, 0x73, 0x74, 0x5f,
+	0x6f, 0x66, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72,
+	0x69, 0x6e, 0x67, 0x5f, 0x66, 0x69, 0x6e, 0x64, 0x5f, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5f, 0x6e,
+	0x6f, 0x74, 0x5f, 0x6f, 0x66, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x69, 0x6e, 0x64, 0x5f, 0x6c, 0x61, 0x73, 0x74,
+	0x5f, 0x6e, 0x6f, 0x74, 0x5f, 0x6f, 0x66, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x65, 0x6e, 0x64, 0x73, 0x5f, 0x77, 0x69, 0x74, 0x68,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c,
+	0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x5f, 0x6e, 0x6f, 0x63, 0x61, 0x73,
+	0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61,
+	0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f,
+	0x6c, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x5f, 0x73,
+	0x75, 0x62, 0x73, 0x74, 0x72, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x65, 0x71, 0x75,
+	0x61, 0x6c, 0x5f, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x5f, 0x6e, 0x6f, 0x63, 0x61, 0x73, 0x65,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c,
+	0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x70, 0x61,
+	0x74, 0x74, 0x65, 0x72, 0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x73, 0x70, 0x6c,
+	0x69, 0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x74, 0x72,
+	0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x2c, 0x20, 0x62, 0x6f,
+	0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x5f, 0x65, 0x78, 0x70, 0x6c, 0x6f, 0x64, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x62, 0x6f,
+	0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x6d,
+	0x65, 0x72, 0x67, 0x65, 0x5f, 0x76, 0x61, 0x72, 0x67, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f,
+	0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x66, 0x69, 0x6e, 0x64, 0x28,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74,
+	0x65, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
+	0x61, 0x74, 0x65, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a,
+	0x77, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x74, 0x2a, 0x20, 0x77, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x77, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x28, 0x77, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61,
+	0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x77, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f,
+	0x63, 0x61, 0x74, 0x65, 0x28, 0x77, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x77, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x6c,
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x77, 0x63, 0x68, 0x61,
+	0x72, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x77, 0x73, 0x74, 0x72,
+	0x69, 0x6e, 0x67, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x77, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x77, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
+	0x61, 0x74, 0x65, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x77, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x77, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61,
+	0x74, 0x65, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x75, 0x74, 0x66, 0x31, 0x36, 0x28, 0x20, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x74, 0x2a, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f,
+	0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74,
+	0x65, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x75, 0x74, 0x66, 0x33, 0x32, 0x28, 0x20, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74,
+	0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x5f,
+	0x75, 0x74, 0x66, 0x31, 0x36, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x31,
+	0x36, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63,
+	0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x5f, 0x75, 0x74, 0x66, 0x33, 0x32, 0x28, 0x63, 0x68, 0x61,
+	0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x28, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x69, 0x6e,
+	0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+	0x69, 0x6e, 0x74, 0x2c, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x72, 0x6f, 0x6d,
+	0x5f, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x62,
+	0x6f, 0x6f, 0x6c, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+	0x74, 0x2c, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x75,
+	0x69, 0x6e, 0x74, 0x31, 0x32, 0x38, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74,
+	0x31, 0x32, 0x38, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74,
+	0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x72, 0x65, 0x61,
+	0x6c, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c,
+	0x20, 0x72, 0x65, 0x61, 0x6c, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+	0x69, 0x6e, 0x74, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+	0x74, 0x2c, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x74,
+	0x69, 0x6d, 0x65, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x72,
+	0x6f, 0x6d, 0x5f, 0x75, 0x75, 0x69, 0x64, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69,
+	0x64, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69,
+	0x6f, 0x6e, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x69,
+	0x6e, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x28, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f,
+	0x74, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x2c,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x72,
+	0x6f, 0x6d, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x28, 0x75,
+	0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x2c, 0x20, 0x75,
+	0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x63, 0x68, 0x61,
+	0x72, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x75,
+	0x69, 0x6e, 0x74, 0x31, 0x32, 0x38, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x32, 0x38, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f,
+	0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x28, 0x72, 0x65, 0x61, 0x6c, 0x2c, 0x20, 0x75, 0x6e, 0x73,
+	0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73,
+	0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+	0x74, 0x2c, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f,
+	0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63,
+	0x28, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x73, 0x74, 0x61, 0x74,
+	0x69, 0x63, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x29,
+	0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74,
+	0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x76, 0x65, 0x72,
+	0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x28, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x69, 0x6e,
+	0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x6f, 0x5f, 0x69, 0x6e, 0x74, 0x28,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69,
+	0x6e, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x6f, 0x5f, 0x75, 0x69, 0x6e,
+	0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x69, 0x6e,
+	0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x6f, 0x5f,
+	0x69, 0x6e, 0x74, 0x36, 0x34, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74,
+	0x36, 0x34, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x6f, 0x5f, 0x75,
+	0x69, 0x6e, 0x74, 0x36, 0x34, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29,
+	0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x32, 0x38, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x5f, 0x74, 0x6f, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x32, 0x38, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x6f, 0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x32, 0x28,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x20,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x6f, 0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x36,
+	0x34, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x61, 0x6c, 0x20, 0x73, 0x74, 0x72,
+	0x69, 0x6e, 0x67, 0x5f, 0x74, 0x6f, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x28, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29,
+	0x3b, 0x0a, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f,
+	0x74, 0x6f, 0x5f, 0x75, 0x75, 0x69, 0x64, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x65,
+	0x72, 0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74,
+	0x6f, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x0a, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x65, 0x72, 0x72, 0x6f,
+	0x72, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x79,
+	0x73, 0x74, 0x65, 0x6d, 0x5f, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x5f, 0x72, 0x65, 0x73, 0x65, 0x74,
+	0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x65, 0x72, 0x72, 0x6f, 0x72,
+	0x5f, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x28, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x69,
+	0x6e, 0x74, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f,
+	0x72, 0x6d, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x79,
+	0x73, 0x74, 0x65, 0x6d, 0x5f, 0x61, 0x72, 0x63, 0x68, 0x69, 0x74, 0x65, 0x63, 0x74, 0x75, 0x72,
+	0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x79, 0x73,
+	0x74, 0x65, 0x6d, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x28, 0x76, 0x6f,
+	0x69, 0x64, 0x29, 0x3b, 0x0a, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+	0x74, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72,
+	0x65, 0x5f, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b,
+	0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d,
+	0x5f, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34,
+	0x5f, 0x74, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x68, 0x6f, 0x73, 0x74, 0x69, 0x64,
+	0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74,
+	0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x75, 0x73, 0x65, 0x72, 0x6e, 0x61, 0x6d, 0x65,
+	0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x64, 0x65, 0x62,
+	0x75, 0x67, 0x67, 0x65, 0x72, 0x5f, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x28, 0x76,
+	0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65,
+	0x6d, 0x5f, 0x70, 0x61, 0x75, 0x73, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x75,
+	0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x74, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x6c,
+	0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x75,
+	0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x74, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x63,
+	0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x75, 0x69,
+	0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x6c, 0x6f,
+	0x63, 0x61, 0x6c, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x5f, 0x74, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+	0x6c, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x79,
+	0x73, 0x74, 0x65, 0x6d, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x5f,
+	0x6f, 0x72, 0x69, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x69, 0x6e, 0x74, 0x29,
+	0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x64, 0x65, 0x76,
+	0x69, 0x63, 0x65, 0x5f, 0x6f, 0x72, 0x69, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28,
+	0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x79, 0x73, 0x74,
+	0x65, 0x6d, 0x5f, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74,
+	0x73, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x79,
+	0x73, 0x74, 0x65, 0x6d, 0x5f, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x5f, 0x62, 0x6f, 0x78,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29,
+	0x3b, 0x0a, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74,
+	0x2a, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x70, 0x6f, 0x73, 0x74, 0x5f, 0x65, 0x76,
+	0x65, 0x6e, 0x74, 0x28, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x74, 0x68, 0x72, 0x65, 0x61,
+	0x64, 0x5f, 0x74, 0x2a, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x61, 0x6c, 0x6c, 0x6f,
+	0x63, 0x61, 0x74, 0x65, 0x28, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x66, 0x6e, 0x2c, 0x20,
+	0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61,
+	0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c,
+	0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+	0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x74, 0x2a,
+	0x2c, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x66, 0x6e, 0x2c, 0x20, 0x76, 0x6f, 0x69,
+	0x64, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x75, 0x6e,
+	0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a,
+	0x65, 0x28, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f,
+	0x63, 0x61, 0x74, 0x65, 0x28, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x73, 0x74, 0x61,
+	0x72, 0x74, 0x28, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x2a, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x6a, 0x6f, 0x69, 0x6e,
+	0x28, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x28,
+	0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c,
+	0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x77, 0x61, 0x69, 0x74, 0x28, 0x76, 0x6f, 0x69,
+	0x64, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f,
+	0x74, 0x72, 0x79, 0x5f, 0x77, 0x61, 0x69, 0x74, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+	0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x69, 0x6c, 0x6c, 0x69, 0x73, 0x65, 0x63, 0x6f, 0x6e,
+	0x64, 0x73, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+	0x5f, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x28, 0x6f, 0x62, 0x6a, 0x65,
+	0x63, 0x74, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x74, 0x68, 0x72, 0x65,
+	0x61, 0x64, 0x5f, 0x69, 0x73, 0x5f, 0x72, 0x75, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x28, 0x6f, 0x62,
+	0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x74, 0x68,
+	0x72, 0x65, 0x61, 0x64, 0x5f, 0x69, 0x73, 0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x76, 0x6f, 0x69,
+	0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f,
+	0x73, 0x65, 0x74, 0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x73, 0x65, 0x74, 0x5f,
+	0x6e, 0x61, 0x6d, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x68, 0x61, 0x72, 0x64, 0x77,
+	0x61, 0x72, 0x65, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x6f,
+	0x62, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x73,
+	0x65, 0x6c, 0x66, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+	0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e,
+	0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x69, 0x64, 0x28,
+	0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+	0x69, 0x6e, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x68, 0x61, 0x72, 0x64, 0x77,
+	0x61, 0x72, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x73, 0x6c, 0x65, 0x65, 0x70, 0x28, 0x75, 0x6e, 0x73,
+	0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x79, 0x69, 0x65, 0x6c, 0x64, 0x28, 0x76, 0x6f,
+	0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+	0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x61, 0x74,
+	0x74, 0x61, 0x63, 0x68, 0x5f, 0x6a, 0x76, 0x6d, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x64, 0x65, 0x74, 0x61,
+	0x63, 0x68, 0x5f, 0x6a, 0x76, 0x6d, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x74,
+	0x69, 0x63, 0x6b, 0x5f, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x63, 0x75, 0x72, 0x72, 0x65,
+	0x6e, 0x74, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x74, 0x69, 0x63, 0x6b, 0x5f, 0x74,
+	0x20, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x64, 0x69, 0x66, 0x66, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x74, 0x69, 0x63, 0x6b, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74,
+	0x69, 0x63, 0x6b, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x74, 0x69, 0x6d,
+	0x65, 0x5f, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x65, 0x6c, 0x61, 0x70, 0x73, 0x65, 0x64,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74, 0x69, 0x63, 0x6b, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x74, 0x69, 0x63, 0x6b, 0x5f, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x65, 0x6c, 0x61, 0x70,
+	0x73, 0x65, 0x64, 0x5f, 0x74, 0x69, 0x63, 0x6b, 0x73, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x74, 0x69, 0x63, 0x6b, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x74, 0x69, 0x63, 0x6b, 0x5f, 0x74, 0x20,
+	0x74, 0x69, 0x6d, 0x65, 0x5f, 0x74, 0x69, 0x63, 0x6b, 0x73, 0x5f, 0x70, 0x65, 0x72, 0x5f, 0x73,
+	0x65, 0x63, 0x6f, 0x6e, 0x64, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x64, 0x65, 0x6c,
+	0x74, 0x61, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x74, 0x69,
+	0x63, 0x6b, 0x73, 0x5f, 0x74, 0x6f, 0x5f, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74, 0x69, 0x63, 0x6b, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x74, 0x69,
+	0x63, 0x6b, 0x5f, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x75,
+	0x70, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x74, 0x69, 0x63, 0x6b, 0x5f, 0x74, 0x20,
+	0x74, 0x69, 0x6d, 0x65, 0x5f, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x28, 0x76, 0x6f, 0x69, 0x64,
+	0x29, 0x3b, 0x0a, 0x0a, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f,
+	0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x28, 0x76, 0x6f,
+	0x69, 0x64, 0x29, 0x3b, 0x0a, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64,
+	0x5f, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x67,
+	0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x5f, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x28, 0x76,
+	0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f,
+	0x65, 0x71, 0x75, 0x61, 0x6c, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64,
+	0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x6e,
+	0x75, 0x6c, 0x6c, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20,
+	0x75, 0x75, 0x69, 0x64, 0x5f, 0x69, 0x73, 0x5f, 0x6e, 0x75, 0x6c, 0x6c, 0x28, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x75, 0x69, 0x64,
+	0x5f, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x64, 0x6e, 0x73, 0x28, 0x76, 0x6f, 0x69, 0x64,
+	0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x5f,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+	0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x74, 0x79,
+	0x70, 0x65, 0x5f, 0x73, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x28, 0x69, 0x6e, 0x74, 0x29, 0x3b,
+	0x0a, 0x0a, 0x1e, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x31,
+	0x36, 0x5f, 0x74, 0x20, 0x77, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x74, 0x3b, 0x1e, 0x74, 0x79, 0x70,
+	0x65, 0x64, 0x65, 0x66, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x77, 0x63,
+	0x68, 0x61, 0x72, 0x5f, 0x74, 0x3b, 0x16, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x77, 0x63, 0x68, 0x61, 0x72, 0x26, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66,
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61,
+	0x62, 0x6c, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x5f, 0x74, 0x3b, 0x0c, 0x6e, 0x75, 0x6c, 0x6c, 0x70,
+	0x74, 0x72, 0x02, 0x00, 0x00, 0x26, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x75, 0x69,
+	0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61, 0x62, 0x6c, 0x65,
+	0x5f, 0x69, 0x6e, 0x74, 0x5f, 0x74, 0x3b, 0x18, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x1c, 0x74, 0x79, 0x70, 0x65,
+	0x64, 0x65, 0x66, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x72, 0x65,
+	0x61, 0x6c, 0x3b, 0x1c, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x66, 0x6c, 0x6f, 0x61,
+	0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x61, 0x6c, 0x3b, 0x15, 0x73, 0x79, 0x73, 0x74,
+	0x65, 0x6d, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0xae, 0x01, 0x74, 0x79,
+	0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x66, 0x6c, 0x6f, 0x61,
+	0x74, 0x33, 0x32, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x64,
+	0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x3b,
+	0x0a, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x69,
+	0x6e, 0x74, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x72,
+	0x65, 0x61, 0x6c, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x73,
+	0x79, 0x73, 0x74, 0x65, 0x6d, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x70, 0x6f, 0x69, 0x6e, 0x74,
+	0x65, 0x72, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x79,
+	0x73, 0x74, 0x65, 0x6d, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x77, 0x63, 0x68, 0x61, 0x72, 0x28,
+	0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x1f, 0x6c, 0x75, 0x61, 0x5f, 0x73, 0x79, 0x6d, 0x62,
+	0x6f, 0x6c, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x2b, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6c, 0x75, 0x61, 0x5f, 0x73, 0x79, 0x6d, 0x62,
+	0x6f, 0x6c, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x09, 0x63, 0x64, 0x65, 0x66, 0x06, 0x43,
+	0x08, 0x66, 0x66, 0x69, 0x0c, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x02, 0x00, 0x02, 0x00,
+	0x02, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0a, 0x00,
+	0x11, 0x00, 0x11, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x14, 0x00,
+	0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x19, 0x00, 0x19, 0x00,
+	0x19, 0x00, 0x19, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1b, 0x00,
+	0x1b, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x21, 0x00, 0x21, 0x00,
+	0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x24, 0x00,
+	0x24, 0x00, 0x24, 0x00, 0x28, 0x00, 0x99, 0x02, 0x99, 0x02, 0x9b, 0x02, 0x9b, 0x02, 0x9b, 0x02,
+	0x9d, 0x02, 0x9e, 0x02, 0x9f, 0x02, 0x9f, 0x02, 0xa0, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa1, 0x02,
+	0xa2, 0x02, 0xa2, 0x02, 0xa3, 0x02, 0xa3, 0x02, 0xa5, 0x02, 0xa5, 0x02, 0xa5, 0x02, 0xa5, 0x02,
+	0xa7, 0x02, 0xa8, 0x02, 0xa9, 0x02, 0xa9, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xab, 0x02, 0xab, 0x02,
+	0xac, 0x02, 0xac, 0x02, 0xae, 0x02, 0xae, 0x02, 0xae, 0x02, 0xae, 0x02, 0xb4, 0x02, 0xbe, 0x02,
+	0xc8, 0x02, 0xca, 0x02, 0xca, 0x02, 0xca, 0x02, 0xcc, 0x02, 0xcd, 0x02, 0xce, 0x02, 0xcf, 0x02,
+	0xd0, 0x02, 0xd2, 0x02, 0xd3, 0x02, 0xd5, 0x02, 0xd5, 0x02, 0xd7, 0x02, 0x67, 0x03, 0x6a, 0x03,
+	0x6c, 0x03, 0x6d, 0x03, 0x6e, 0x03, 0x6f, 0x03, 0x70, 0x03, 0x72, 0x03, 0x74, 0x03, 0x75, 0x03,
+	0x77, 0x03, 0x79, 0x03, 0x7a, 0x03, 0x7c, 0x03, 0x7c, 0x03, 0x66, 0x66, 0x69, 0x00, 0x04, 0x74,
+	0x43, 0x00, 0x01, 0x73, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x6d, 0x65, 0x74, 0x61, 0x5f,
+	0x74, 0x00, 0x37, 0x1d, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x6d, 0x65, 0x74, 0x61, 0x5f,
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x0b, 0x12, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x6d,
+	0x65, 0x74, 0x61, 0x5f, 0x74, 0x00, 0x04, 0x0e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x6d, 0x65, 0x74, 0x61, 0x5f, 0x74, 0x00, 0x01, 0x0d, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x6d, 0x65, 0x74, 0x61, 0x5f,
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x09, 0x04, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x6d, 0x65, 0x74, 0x61, 0x5f, 0x74, 0x00, 0x04, 0x00, 0x77, 0x72,
+	0x61, 0x70, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x00, 0x01,
+	0x1e, 0x77, 0x72, 0x61, 0x70, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x5f, 0x74, 0x6f, 0x5f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x01, 0x1d, 0x77, 0x72,
+	0x61, 0x70, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f,
+	0x74, 0x6f, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x00, 0x01, 0x1c, 0x50, 0x52, 0x45, 0x48, 0x41,
+	0x53, 0x48, 0x5f, 0x4c, 0x55, 0x41, 0x00, 0x03, 0x19, 0x6c, 0x6f, 0x67, 0x5f, 0x64, 0x65, 0x62,
+	0x75, 0x67, 0x00, 0x01, 0x18, 0x6c, 0x6f, 0x67, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x00, 0x01, 0x17,
+	0x6c, 0x6f, 0x67, 0x5f, 0x77, 0x61, 0x72, 0x6e, 0x00, 0x01, 0x16, 0x6c, 0x6f, 0x67, 0x5f, 0x65,
+	0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x15, 0x6c, 0x6f, 0x67, 0x5f, 0x70, 0x61, 0x6e, 0x69, 0x63,
+	0x00, 0x01, 0x14, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x00, 0x01, 0x13, 0x73, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x00, 0x01, 0x12, 0x00, 0x00,
+};
+
+static const uint8_t lua_embedded_fr2_network[] = {
+	0x1b, 0x4c, 0x4a, 0x02, 0x08, 0x07, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0xd1, 0x28, 0x02,
+	0x00, 0x06, 0x00, 0x07, 0x00, 0x0c, 0x24, 0x00, 0x8b, 0x01, 0x36, 0x00, 0x00, 0x00, 0x27, 0x02,
+	0x01, 0x00, 0x42, 0x00, 0x02, 0x02, 0x39, 0x01, 0x02, 0x00, 0x36, 0x02, 0x00, 0x00, 0x27, 0x04,
+	0x03, 0x00, 0x42, 0x02, 0x02, 0x02, 0x39, 0x03, 0x04, 0x00, 0x27, 0x05, 0x05, 0x00, 0x42, 0x03,
+	0x02, 0x01, 0x35, 0x03, 0x06, 0x00, 0x4c, 0x03, 0x02, 0x00, 0x01, 0x00, 0x0f, 0x1b, 0x53, 0x4f,
+	0x43, 0x4b, 0x45, 0x54, 0x53, 0x54, 0x41, 0x54, 0x45, 0x5f, 0x43, 0x4f, 0x4e, 0x4e, 0x45, 0x43,
+	0x54, 0x49, 0x4e, 0x47, 0x03, 0x01, 0x1b, 0x4e, 0x45, 0x54, 0x57, 0x4f, 0x52, 0x4b, 0x5f, 0x53,
+	0x4f, 0x43, 0x4b, 0x45, 0x54, 0x5f, 0x49, 0x4e, 0x56, 0x41, 0x4c, 0x49, 0x44, 0x03, 0xff, 0xff,
+	0xff, 0xff, 0x0f, 0x27, 0x4e, 0x45, 0x54, 0x57, 0x4f, 0x52, 0x4b, 0x5f, 0x41, 0x44, 0x44, 0x52,
+	0x45, 0x53, 0x53, 0x5f, 0x4e, 0x55, 0x4d, 0x45, 0x52, 0x49, 0x43, 0x5f, 0x4d, 0x41, 0x58, 0x5f,
+	0x4c, 0x45, 0x4e, 0x47, 0x54, 0x48, 0x03, 0x2e, 0x1f, 0x4e, 0x45, 0x54, 0x57, 0x4f, 0x52, 0x4b,
+	0x5f, 0x41, 0x44, 0x44, 0x52, 0x45, 0x53, 0x53, 0x46, 0x41, 0x4d, 0x49, 0x4c, 0x59, 0x5f, 0x49,
+	0x50, 0x56, 0x36, 0x03, 0x01, 0x1d, 0x53, 0x4f, 0x43, 0x4b, 0x45, 0x54, 0x53, 0x54, 0x41, 0x54,
+	0x45, 0x5f, 0x4e, 0x4f, 0x54, 0x43, 0x4f, 0x4e, 0x4e, 0x45, 0x43, 0x54, 0x45, 0x44, 0x03, 0x00,
+	0x1a, 0x53, 0x4f, 0x43, 0x4b, 0x45, 0x54, 0x53, 0x54, 0x41, 0x54, 0x45, 0x5f, 0x43, 0x4f, 0x4e,
+	0x4e, 0x45, 0x43, 0x54, 0x45, 0x44, 0x03, 0x02, 0x1d, 0x4e, 0x45, 0x54, 0x57, 0x4f, 0x52, 0x4b,
+	0x5f, 0x54, 0x49, 0x4d, 0x45, 0x4f, 0x55, 0x54, 0x5f, 0x49, 0x4e, 0x46, 0x49, 0x4e, 0x49, 0x54,
+	0x45, 0x03, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x1f, 0x4e, 0x45, 0x54, 0x57, 0x4f, 0x52, 0x4b, 0x5f,
+	0x41, 0x44, 0x44, 0x52, 0x45, 0x53, 0x53, 0x46, 0x41, 0x4d, 0x49, 0x4c, 0x59, 0x5f, 0x49, 0x50,
+	0x56, 0x34, 0x03, 0x00, 0x18, 0x4e, 0x45, 0x54, 0x57, 0x4f, 0x52, 0x4b, 0x45, 0x56, 0x45, 0x4e,
+	0x54, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x49, 0x4e, 0x03, 0x03, 0x1b, 0x4e, 0x45, 0x54, 0x57, 0x4f,
+	0x52, 0x4b, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x43, 0x4f, 0x4e, 0x4e, 0x45, 0x43, 0x54, 0x45,
+	0x44, 0x03, 0x02, 0x1d, 0x53, 0x4f, 0x43, 0x4b, 0x45, 0x54, 0x53, 0x54, 0x41, 0x54, 0x45, 0x5f,
+	0x44, 0x49, 0x53, 0x43, 0x4f, 0x4e, 0x4e, 0x45, 0x43, 0x54, 0x45, 0x44, 0x03, 0x04, 0x1a, 0x53,
+	0x4f, 0x43, 0x4b, 0x45, 0x54, 0x53, 0x54, 0x41, 0x54, 0x45, 0x5f, 0x4c, 0x49, 0x53, 0x54, 0x45,
+	0x4e, 0x49, 0x4e, 0x47, 0x03, 0x03, 0x17, 0x4e, 0x45, 0x54, 0x57, 0x4f, 0x52, 0x4b, 0x45, 0x56,
+	0x45, 0x4e, 0x54, 0x5f, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x03, 0x04, 0x1c, 0x4e, 0x45, 0x54, 0x57,
+	0x4f, 0x52, 0x4b, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x43, 0x4f, 0x4e, 0x4e, 0x45, 0x43, 0x54,
+	0x49, 0x4f, 0x4e, 0x03, 0x01, 0x18, 0x4e, 0x45, 0x54, 0x57, 0x4f, 0x52, 0x4b, 0x45, 0x56, 0x45,
+	0x4e, 0x54, 0x5f, 0x48, 0x41, 0x4e, 0x47, 0x55, 0x50, 0x03, 0x05, 0xc6, 0x24, 0x0a, 0x74, 0x79,
+	0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x7b, 0x0a, 0x09,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x69, 0x64, 0x3b, 0x0a, 0x09, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3b, 0x0a, 0x7d, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65,
+	0x74, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x74, 0x3b, 0x0a, 0x0a, 0x74, 0x79, 0x70,
+	0x65, 0x64, 0x65, 0x66, 0x20, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x09, 0x76, 0x6f,
+	0x69, 0x64, 0x2a, 0x20, 0x63, 0x6c, 0x69, 0x65, 0x6e, 0x74, 0x3b, 0x0a, 0x09, 0x73, 0x6f, 0x63,
+	0x6b, 0x65, 0x74, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x74, 0x20, 0x68, 0x65, 0x61,
+	0x64, 0x65, 0x72, 0x3b, 0x0a, 0x7d, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x64, 0x61,
+	0x74, 0x61, 0x5f, 0x74, 0x3b, 0x0a, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x63, 0x6f,
+	0x6e, 0x66, 0x69, 0x67, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x74, 0x77,
+	0x6f, 0x72, 0x6b, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79,
+	0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6e, 0x65, 0x74,
+	0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65,
+	0x73, 0x73, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74,
+	0x72, 0x75, 0x63, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64,
+	0x72, 0x65, 0x73, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x34, 0x5f, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77,
+	0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x34,
+	0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75,
+	0x63, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65,
+	0x73, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x36, 0x5f, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72,
+	0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x36, 0x5f, 0x74,
+	0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x73, 0x6c,
+	0x6f, 0x74, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70,
+	0x6f, 0x6c, 0x6c, 0x5f, 0x73, 0x6c, 0x6f, 0x74, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65,
+	0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f,
+	0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x20,
+	0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x65, 0x76,
+	0x65, 0x6e, 0x74, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f,
+	0x6c, 0x6c, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x74, 0x77,
+	0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65,
+	0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65,
+	0x74, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64,
+	0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+	0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x3b,
+	0x0a, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x28,
+	0x2a, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 0x5f, 0x66, 0x6e, 0x29,
+	0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69,
+	0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64,
+	0x65, 0x66, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x28, 0x2a, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+	0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69,
+	0x7a, 0x65, 0x5f, 0x66, 0x6e, 0x29, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a,
+	0x2c, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x6e,
+	0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74,
+	0x2a, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73,
+	0x73, 0x5f, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65,
+	0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65,
+	0x73, 0x73, 0x5f, 0x74, 0x2a, 0x2a, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61,
+	0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x74, 0x20, 0x6e, 0x65,
+	0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x6f,
+	0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x74,
+	0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77,
+	0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x79, 0x70, 0x65,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61,
+	0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20,
+	0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f,
+	0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x74,
+	0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x29,
+	0x3b, 0x0a, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73,
+	0x73, 0x5f, 0x74, 0x2a, 0x2a, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64,
+	0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x28, 0x76, 0x6f, 0x69, 0x64,
+	0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f,
+	0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72,
+	0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65,
+	0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f,
+	0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61,
+	0x74, 0x65, 0x28, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65,
+	0x73, 0x73, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6e, 0x65, 0x74,
+	0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x6e, 0x65,
+	0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a,
+	0x2a, 0x29, 0x3b, 0x0a, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72,
+	0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61,
+	0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x34, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+	0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61,
+	0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x34, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73,
+	0x5f, 0x74, 0x2a, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72,
+	0x65, 0x73, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x36, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c,
+	0x69, 0x7a, 0x65, 0x28, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72,
+	0x65, 0x73, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x36, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65,
+	0x73, 0x73, 0x5f, 0x69, 0x70, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x70, 0x6f, 0x72, 0x74, 0x28, 0x6e,
+	0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74,
+	0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29,
+	0x3b, 0x0a, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6e,
+	0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x69,
+	0x70, 0x5f, 0x70, 0x6f, 0x72, 0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x74,
+	0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x29,
+	0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61,
+	0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x34, 0x5f, 0x73, 0x65, 0x74, 0x5f,
+	0x69, 0x70, 0x28, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65,
+	0x73, 0x73, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x29,
+	0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f,
+	0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x34, 0x5f,
+	0x69, 0x70, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b,
+	0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65,
+	0x73, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x36, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x69, 0x70, 0x28, 0x6e,
+	0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74,
+	0x2a, 0x2c, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x69, 0x6e, 0x36, 0x5f, 0x61, 0x64,
+	0x64, 0x72, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x69, 0x6e, 0x36, 0x5f,
+	0x61, 0x64, 0x64, 0x72, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64,
+	0x72, 0x65, 0x73, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x36, 0x5f, 0x69, 0x70, 0x28, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65,
+	0x73, 0x73, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x74,
+	0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73,
+	0x5f, 0x69, 0x70, 0x76, 0x34, 0x5f, 0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x70, 0x28, 0x75, 0x6e,
+	0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2c, 0x20, 0x75, 0x6e, 0x73,
+	0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69,
+	0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+	0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x3b, 0x0a, 0x0a, 0x69, 0x6e, 0x74, 0x20,
+	0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x5f, 0x69,
+	0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f,
+	0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28,
+	0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6e, 0x65, 0x74, 0x77,
+	0x6f, 0x72, 0x6b, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x5f, 0x69, 0x73, 0x5f, 0x69, 0x6e,
+	0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b,
+	0x0a, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f,
+	0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65,
+	0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x6d, 0x6f, 0x64, 0x75,
+	0x6c, 0x65, 0x5f, 0x70, 0x61, 0x72, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x28,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x5f,
+	0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65,
+	0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a,
+	0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x73, 0x75, 0x70,
+	0x70, 0x6f, 0x72, 0x74, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x34, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+	0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x73,
+	0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x5f, 0x69, 0x70, 0x76, 0x36, 0x28, 0x76, 0x6f, 0x69,
+	0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c,
+	0x6c, 0x5f, 0x74, 0x2a, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c,
+	0x6c, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+	0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6e,
+	0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+	0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70,
+	0x6f, 0x6c, 0x6c, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+	0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6e, 0x65, 0x74, 0x77,
+	0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a,
+	0x65, 0x28, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b,
+	0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65,
+	0x28, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f,
+	0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x28,
+	0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x75,
+	0x70, 0x64, 0x61, 0x74, 0x65, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x6e, 0x65, 0x74,
+	0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x6f,
+	0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6e,
+	0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x72, 0x65, 0x6d, 0x6f,
+	0x76, 0x65, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72,
+	0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65,
+	0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6e, 0x65, 0x74, 0x77,
+	0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x68, 0x61, 0x73, 0x5f, 0x73, 0x6f, 0x63,
+	0x6b, 0x65, 0x74, 0x28, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c,
+	0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f,
+	0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x6e, 0x75, 0x6d, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x73,
+	0x28, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f,
+	0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x73, 0x28, 0x6e, 0x65, 0x74,
+	0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x6f,
+	0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72,
+	0x6b, 0x5f, 0x70, 0x6f, 0x6c, 0x6c, 0x28, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x70,
+	0x6f, 0x6c, 0x6c, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f,
+	0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+	0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x6f, 0x63, 0x6b,
+	0x65, 0x74, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x73, 0x6f, 0x63, 0x6b,
+	0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x6f, 0x63,
+	0x6b, 0x65, 0x74, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x73,
+	0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20,
+	0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x62, 0x69, 0x6e, 0x64, 0x28, 0x73, 0x6f, 0x63, 0x6b,
+	0x65, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x74,
+	0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x29,
+	0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x63, 0x6f,
+	0x6e, 0x6e, 0x65, 0x63, 0x74, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61,
+	0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+	0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73,
+	0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x73, 0x6f, 0x63, 0x6b,
+	0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b,
+	0x65, 0x74, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f,
+	0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73,
+	0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+	0x69, 0x6e, 0x67, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x62,
+	0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65,
+	0x74, 0x5f, 0x72, 0x65, 0x75, 0x73, 0x65, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x28,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29,
+	0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x73, 0x65,
+	0x74, 0x5f, 0x72, 0x65, 0x75, 0x73, 0x65, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x28,
+	0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29,
+	0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x72, 0x65,
+	0x75, 0x73, 0x65, 0x5f, 0x70, 0x6f, 0x72, 0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73,
+	0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x72, 0x65, 0x75, 0x73, 0x65,
+	0x5f, 0x70, 0x6f, 0x72, 0x74, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x6f, 0x63,
+	0x6b, 0x65, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x63, 0x61, 0x73,
+	0x74, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74,
+	0x2a, 0x2c, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65,
+	0x73, 0x73, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72,
+	0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x61, 0x64,
+	0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x28, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72,
+	0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x61, 0x64,
+	0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x28, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x69,
+	0x6e, 0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x28,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29,
+	0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x70, 0x6f, 0x6c,
+	0x6c, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x66,
+	0x64, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x61, 0x76, 0x61, 0x69,
+	0x6c, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x28,
+	0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x73,
+	0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f,
+	0x62, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a,
+	0x2c, 0x20, 0x62, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28,
+	0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x69,
+	0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+	0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x6f, 0x63, 0x6b,
+	0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x73, 0x6f, 0x63,
+	0x6b, 0x65, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c,
+	0x69, 0x7a, 0x65, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61,
+	0x6d, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74,
+	0x2a, 0x20, 0x74, 0x63, 0x70, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x61, 0x6c, 0x6c,
+	0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x74, 0x63, 0x70, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x69, 0x6e, 0x69,
+	0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x20, 0x74, 0x63,
+	0x70, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x28,
+	0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+	0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x74,
+	0x63, 0x70, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e,
+	0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f,
+	0x6c, 0x20, 0x74, 0x63, 0x70, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x64, 0x65, 0x6c,
+	0x61, 0x79, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x74, 0x63, 0x70, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x73,
+	0x65, 0x74, 0x5f, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x6f, 0x63, 0x6b,
+	0x65, 0x74, 0x5f, 0x74, 0x2a, 0x20, 0x75, 0x64, 0x70, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+	0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x75, 0x64, 0x70, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+	0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x73, 0x6f, 0x63, 0x6b,
+	0x65, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x75,
+	0x64, 0x70, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x72, 0x65, 0x63, 0x76, 0x66, 0x72,
+	0x6f, 0x6d, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x76, 0x6f,
+	0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x6e, 0x65, 0x74,
+	0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x20, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x2a, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20,
+	0x75, 0x64, 0x70, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x73, 0x65, 0x6e, 0x64, 0x74,
+	0x6f, 0x28, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f,
+	0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x63,
+	0x64, 0x65, 0x66, 0x0f, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x06, 0x43,
+	0x08, 0x66, 0x66, 0x69, 0x0c, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x02, 0x02, 0x02, 0x03,
+	0x05, 0x05, 0x05, 0x08, 0x70, 0x70, 0x72, 0x8a, 0x66, 0x66, 0x69, 0x00, 0x04, 0x09, 0x43, 0x00,
+	0x01, 0x08, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x03, 0x05, 0x00,
+	0x00,
+};
+
+static const uint8_t lua_embedded_fr2_resource[] = {
+	0x1b, 0x4c, 0x4a, 0x02, 0x08, 0x07, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0xac, 0x3c, 0x02,
+	0x00, 0x07, 0x00, 0x08, 0x00, 0x0f, 0x31, 0x00, 0xa0, 0x01, 0x36, 0x00, 0x00, 0x00, 0x27, 0x02,
+	0x01, 0x00, 0x42, 0x00, 0x02, 0x02, 0x39, 0x01, 0x02, 0x00, 0x36, 0x02, 0x00, 0x00, 0x27, 0x04,
+	0x03, 0x00, 0x42, 0x02, 0x02, 0x02, 0x36, 0x03, 0x00, 0x00, 0x27, 0x05, 0x04, 0x00, 0x42, 0x03,
+	0x02, 0x02, 0x39, 0x04, 0x05, 0x00, 0x27, 0x06, 0x06, 0x00, 0x42, 0x04, 0x02, 0x01, 0x35, 0x04,
+	0x07, 0x00, 0x4c, 0x04, 0x02, 0x00, 0x01, 0x00, 0x08, 0x20, 0x52, 0x45, 0x53, 0x4f, 0x55, 0x52,
+	0x43, 0x45, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x4c, 0x41, 0x53, 0x54, 0x5f, 0x52, 0x45, 0x53,
+	0x45, 0x52, 0x56, 0x45, 0x44, 0x03, 0x20, 0x1d, 0x52, 0x45, 0x53, 0x4f, 0x55, 0x52, 0x43, 0x45,
+	0x5f, 0x53, 0x4f, 0x55, 0x52, 0x43, 0x45, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x42, 0x4c, 0x4f, 0x42,
+	0x03, 0x02, 0x19, 0x52, 0x45, 0x53, 0x4f, 0x55, 0x52, 0x43, 0x45, 0x45, 0x56, 0x45, 0x4e, 0x54,
+	0x5f, 0x4d, 0x4f, 0x44, 0x49, 0x46, 0x59, 0x03, 0x01, 0x19, 0x52, 0x45, 0x53, 0x4f, 0x55, 0x52,
+	0x43, 0x45, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x03, 0x02,
+	0x1e, 0x52, 0x45, 0x53, 0x4f, 0x55, 0x52, 0x43, 0x45, 0x5f, 0x53, 0x4f, 0x55, 0x52, 0x43, 0x45,
+	0x46, 0x4c, 0x41, 0x47, 0x5f, 0x55, 0x4e, 0x53, 0x45, 0x54, 0x03, 0x00, 0x1e, 0x52, 0x45, 0x53,
+	0x4f, 0x55, 0x52, 0x43, 0x45, 0x5f, 0x53, 0x4f, 0x55, 0x52, 0x43, 0x45, 0x46, 0x4c, 0x41, 0x47,
+	0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x03, 0x01, 0x19, 0x52, 0x45, 0x53, 0x4f, 0x55, 0x52, 0x43,
+	0x45, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x03, 0x00, 0x1a,
+	0x52, 0x45, 0x53, 0x4f, 0x55, 0x52, 0x43, 0x45, 0x5f, 0x50, 0x4c, 0x41, 0x54, 0x46, 0x4f, 0x52,
+	0x4d, 0x5f, 0x41, 0x4c, 0x4c, 0x03, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xbc, 0x39, 0x0a, 0x74, 0x79,
+	0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x72, 0x65, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x74, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70,
+	0x65, 0x64, 0x65, 0x66, 0x20, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x20, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x76, 0x61, 0x6c, 0x75,
+	0x65, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x5f, 0x74,
+	0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+	0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+	0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+	0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x74, 0x3b,
+	0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f,
+	0x64, 0x61, 0x74, 0x61, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x64, 0x61, 0x74,
+	0x61, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61,
+	0x6e, 0x67, 0x65, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5f, 0x74,
+	0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+	0x5f, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5f, 0x74, 0x3b, 0x0a, 0x74,
+	0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x72, 0x65,
+	0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x62, 0x6c,
+	0x6f, 0x63, 0x6b, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+	0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75,
+	0x63, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e,
+	0x67, 0x65, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f,
+	0x6d, 0x61, 0x70, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74,
+	0x72, 0x75, 0x63, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x62, 0x6c,
+	0x6f, 0x62, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x62, 0x6c, 0x6f, 0x62, 0x5f,
+	0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x70, 0x6c, 0x61, 0x74, 0x66,
+	0x6f, 0x72, 0x6d, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+	0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d,
+	0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75,
+	0x63, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x68, 0x65, 0x61, 0x64,
+	0x65, 0x72, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f,
+	0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+	0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x61,
+	0x74, 0x75, 0x72, 0x65, 0x5f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+	0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75, 0x72,
+	0x65, 0x5f, 0x74, 0x3b, 0x0a, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x69, 0x6e,
+	0x74, 0x20, 0x28, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x69, 0x6d,
+	0x70, 0x6f, 0x72, 0x74, 0x5f, 0x66, 0x6e, 0x29, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x28,
+	0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x69,
+	0x6c, 0x65, 0x5f, 0x66, 0x6e, 0x29, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69,
+	0x64, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x72,
+	0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x74,
+	0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x35, 0x36,
+	0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c,
+	0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65,
+	0x66, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67,
+	0x65, 0x5f, 0x74, 0x2a, 0x20, 0x28, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x72, 0x65, 0x64, 0x75,
+	0x63, 0x65, 0x5f, 0x66, 0x6e, 0x29, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x76,
+	0x6f, 0x69, 0x64, 0x2a, 0x29, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x69,
+	0x6e, 0x74, 0x20, 0x28, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74,
+	0x65, 0x5f, 0x66, 0x6e, 0x29, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63,
+	0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x29,
+	0x3b, 0x0a, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x5f, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x62,
+	0x75, 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x28, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x62, 0x6f, 0x6f,
+	0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67,
+	0x65, 0x5f, 0x69, 0x73, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a,
+	0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68,
+	0x61, 0x6e, 0x67, 0x65, 0x5f, 0x69, 0x73, 0x5f, 0x62, 0x6c, 0x6f, 0x62, 0x28, 0x72, 0x65, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x74, 0x2a, 0x29,
+	0x3b, 0x0a, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67,
+	0x65, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x61,
+	0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63,
+	0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c,
+	0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63,
+	0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68,
+	0x61, 0x6e, 0x67, 0x65, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61,
+	0x6c, 0x69, 0x7a, 0x65, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68,
+	0x61, 0x6e, 0x67, 0x65, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x76, 0x6f,
+	0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e,
+	0x67, 0x65, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65,
+	0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+	0x5f, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+	0x5f, 0x74, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61,
+	0x6e, 0x67, 0x65, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61,
+	0x74, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72,
+	0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x62,
+	0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f,
+	0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f,
+	0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65,
+	0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+	0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+	0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f,
+	0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x62, 0x6f, 0x6f, 0x6c,
+	0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c,
+	0x65, 0x5f, 0x6e, 0x65, 0x65, 0x64, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+	0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x28, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36,
+	0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x5f, 0x72, 0x65, 0x67, 0x69,
+	0x73, 0x74, 0x65, 0x72, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x6f,
+	0x6d, 0x70, 0x69, 0x6c, 0x65, 0x5f, 0x66, 0x6e, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65,
+	0x5f, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x5f, 0x75, 0x6e, 0x72, 0x65, 0x67,
+	0x69, 0x73, 0x74, 0x65, 0x72, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63,
+	0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x5f, 0x66, 0x6e, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c,
+	0x65, 0x5f, 0x75, 0x6e, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x5f, 0x70, 0x61, 0x74,
+	0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x20,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x75,
+	0x75, 0x69, 0x64, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x2a, 0x29,
+	0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x70, 0x6f, 0x73, 0x74, 0x28, 0x69, 0x6e, 0x74, 0x2c, 0x20,
+	0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a,
+	0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x65, 0x76, 0x65, 0x6e,
+	0x74, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x69, 0x6d, 0x70,
+	0x6f, 0x72, 0x74, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x28, 0x76, 0x6f,
+	0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x5f, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x62, 0x61,
+	0x73, 0x65, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f,
+	0x6f, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x69, 0x6d, 0x70, 0x6f,
+	0x72, 0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75,
+	0x69, 0x64, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x72, 0x65, 0x67, 0x69,
+	0x73, 0x74, 0x65, 0x72, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x69, 0x6d,
+	0x70, 0x6f, 0x72, 0x74, 0x5f, 0x66, 0x6e, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72,
+	0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x72,
+	0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x28, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x5f, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x75, 0x6e, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74,
+	0x65, 0x72, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x69, 0x6d, 0x70, 0x6f,
+	0x72, 0x74, 0x5f, 0x66, 0x6e, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x75, 0x6e, 0x72,
+	0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x28, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x69, 0x67, 0x6e,
+	0x61, 0x74, 0x75, 0x72, 0x65, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x5f, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x6d, 0x61, 0x70, 0x5f,
+	0x73, 0x74, 0x6f, 0x72, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f,
+	0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x35, 0x36, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62,
+	0x6f, 0x6f, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x69, 0x6d, 0x70,
+	0x6f, 0x72, 0x74, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x70, 0x75, 0x72, 0x67, 0x65, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x5f, 0x61, 0x75, 0x74, 0x6f, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f,
+	0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x61, 0x75, 0x74, 0x6f, 0x69,
+	0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x6e, 0x65, 0x65, 0x64, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74,
+	0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20,
+	0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x61, 0x75, 0x74, 0x6f, 0x69, 0x6d, 0x70,
+	0x6f, 0x72, 0x74, 0x5f, 0x77, 0x61, 0x74, 0x63, 0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x61, 0x75,
+	0x74, 0x6f, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x75, 0x6e, 0x77, 0x61, 0x74, 0x63, 0x68,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x61, 0x75, 0x74, 0x6f, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f,
+	0x63, 0x6c, 0x65, 0x61, 0x72, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x61, 0x75, 0x74, 0x6f, 0x69,
+	0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x68, 0x61, 0x6e, 0x64,
+	0x6c, 0x65, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6c, 0x6f,
+	0x63, 0x61, 0x6c, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x73, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6c,
+	0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x73, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6c, 0x6f, 0x63,
+	0x61, 0x6c, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29,
+	0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x5f, 0x70, 0x61, 0x74,
+	0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x63, 0x6c, 0x65, 0x61,
+	0x72, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x73, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 0x5f, 0x73, 0x74, 0x61,
+	0x74, 0x69, 0x63, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74,
+	0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72,
+	0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 0x5f, 0x64, 0x79, 0x6e, 0x61, 0x6d,
+	0x69, 0x63, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c,
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6c,
+	0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74,
+	0x69, 0x63, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c,
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6c,
+	0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5f, 0x64, 0x79, 0x6e, 0x61,
+	0x6d, 0x69, 0x63, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74,
+	0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x75, 0x69,
+	0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72,
+	0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x70, 0x6c,
+	0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x5f, 0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 0x5f, 0x64, 0x65, 0x63, 0x6f, 0x6d,
+	0x70, 0x6f, 0x73, 0x65, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x70, 0x6c,
+	0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 0x5f, 0x69, 0x73, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x5f,
+	0x6f, 0x72, 0x5f, 0x6d, 0x6f, 0x72, 0x65, 0x5f, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63,
+	0x28, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36,
+	0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x20, 0x72,
+	0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d,
+	0x5f, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74,
+	0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x64, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65,
+	0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x28, 0x76,
+	0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x64, 0x5f, 0x69, 0x73, 0x5f, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28,
+	0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75, 0x72, 0x65, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x64, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x35, 0x36, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x64, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x28, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20,
+	0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74,
+	0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x64, 0x5f, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64,
+	0x65, 0x6e, 0x63, 0x69, 0x65, 0x73, 0x28, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20, 0x75,
+	0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2a,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f,
+	0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x28, 0x72, 0x65, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x74, 0x2a, 0x2c,
+	0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72,
+	0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x62, 0x6c, 0x6f, 0x62,
+	0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20, 0x68,
+	0x61, 0x73, 0x68, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c,
+	0x20, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x64,
+	0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x63, 0x6f, 0x6d,
+	0x70, 0x69, 0x6c, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x28, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65,
+	0x64, 0x5f, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x28, 0x76, 0x6f, 0x69,
+	0x64, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x65,
+	0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x6f, 0x70,
+	0x65, 0x6e, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x65, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x6f, 0x70, 0x65,
+	0x6e, 0x5f, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69,
+	0x7a, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
+	0x65, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+	0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x5f, 0x69, 0x73, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61,
+	0x6c, 0x69, 0x7a, 0x65, 0x64, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x72,
+	0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x28, 0x76,
+	0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63,
+	0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x28, 0x76,
+	0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x5f, 0x70, 0x61, 0x72, 0x73, 0x65,
+	0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68,
+	0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74,
+	0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b,
+	0x65, 0x6e, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74, 0x20,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x70, 0x61, 0x74, 0x68, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c,
+	0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x5f, 0x73, 0x65, 0x74, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+	0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x75, 0x69, 0x6e, 0x74, 0x32, 0x35, 0x36, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x68,
+	0x61, 0x73, 0x68, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74,
+	0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x74, 0x2a, 0x20,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61,
+	0x6c, 0x69, 0x7a, 0x65, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72,
+	0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x66,
+	0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f,
+	0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72,
+	0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x77,
+	0x72, 0x69, 0x74, 0x65, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+	0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x5f, 0x73, 0x65, 0x74, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x74, 0x69, 0x63, 0x6b, 0x5f,
+	0x74, 0x2c, 0x20, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36,
+	0x34, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a,
+	0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x75, 0x6e, 0x73, 0x65, 0x74, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x74, 0x69, 0x63, 0x6b, 0x5f, 0x74,
+	0x2c, 0x20, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34,
+	0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x68,
+	0x61, 0x6e, 0x67, 0x65, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x67, 0x65, 0x74, 0x28, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20,
+	0x68, 0x61, 0x73, 0x68, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x62, 0x6c, 0x6f, 0x62,
+	0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x74, 0x69, 0x63, 0x6b, 0x5f, 0x74, 0x2c, 0x20, 0x68, 0x61, 0x73,
+	0x68, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x68,
+	0x61, 0x73, 0x68, 0x5f, 0x74, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a,
+	0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x62, 0x6c, 0x6f, 0x62, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20, 0x68, 0x61, 0x73,
+	0x68, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x68,
+	0x61, 0x73, 0x68, 0x5f, 0x74, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x77, 0x72, 0x69, 0x74,
+	0x65, 0x5f, 0x62, 0x6c, 0x6f, 0x62, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69,
+	0x64, 0x5f, 0x74, 0x2c, 0x20, 0x74, 0x69, 0x63, 0x6b, 0x5f, 0x74, 0x2c, 0x20, 0x68, 0x61, 0x73,
+	0x68, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x68,
+	0x61, 0x73, 0x68, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69,
+	0x64, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x5f, 0x63, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x65, 0x5f, 0x68, 0x69, 0x73, 0x74, 0x6f,
+	0x72, 0x79, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x63, 0x6c, 0x65,
+	0x61, 0x72, 0x5f, 0x62, 0x6c, 0x6f, 0x62, 0x5f, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x28,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6d, 0x61, 0x70, 0x28, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20,
+	0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x2c, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61,
+	0x70, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6d, 0x61, 0x70, 0x5f,
+	0x61, 0x6c, 0x6c, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x6d, 0x61, 0x70, 0x5f, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65, 0x28, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20,
+	0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64,
+	0x2a, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72,
+	0x63, 0x65, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65, 0x5f, 0x66,
+	0x6e, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x72, 0x65, 0x64,
+	0x75, 0x63, 0x65, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61, 0x70, 0x5f,
+	0x74, 0x2a, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x72,
+	0x65, 0x64, 0x75, 0x63, 0x65, 0x5f, 0x66, 0x6e, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+	0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x6d, 0x61, 0x70, 0x5f, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x28, 0x68, 0x61, 0x73, 0x68, 0x6d, 0x61,
+	0x70, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x72, 0x65,
+	0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x6e, 0x75,
+	0x6d, 0x5f, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x69, 0x65, 0x73, 0x28, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e,
+	0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x72,
+	0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x64,
+	0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x69, 0x65, 0x73, 0x28, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34,
+	0x5f, 0x74, 0x2c, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x64,
+	0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x69, 0x65, 0x73, 0x28, 0x63, 0x6f, 0x6e, 0x73,
+	0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34,
+	0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74,
+	0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72,
+	0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 0x5f, 0x73, 0x74, 0x61, 0x74,
+	0x69, 0x63, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c,
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 0x5f, 0x64, 0x79, 0x6e, 0x61, 0x6d,
+	0x69, 0x63, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x2c,
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x73, 0x74,
+	0x72, 0x65, 0x61, 0x6d, 0x5f, 0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x28, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+	0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x75, 0x69, 0x64, 0x5f, 0x74, 0x29,
+	0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x68, 0x65, 0x61,
+	0x64, 0x65, 0x72, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x68, 0x65,
+	0x61, 0x64, 0x65, 0x72, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f,
+	0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x28, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x5f, 0x74, 0x2a,
+	0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x63, 0x64, 0x65, 0x66, 0x0c, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72,
+	0x6b, 0x0f, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x06, 0x43, 0x08, 0x66,
+	0x66, 0x69, 0x0c, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x02, 0x02, 0x02, 0x03, 0x05, 0x05,
+	0x05, 0x06, 0x06, 0x06, 0x09, 0x8f, 0x8f, 0x91, 0x9f, 0x66, 0x66, 0x69, 0x00, 0x04, 0x0c, 0x43,
+	0x00, 0x01, 0x0b, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x03, 0x08,
+	0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x00, 0x03, 0x05, 0x00, 0x00,
+};
+
+static const uint8_t lua_embedded_fr2_window[] = {
+	0x1b, 0x4c, 0x4a, 0x02, 0x08, 0x07, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x8c, 0x12, 0x02,
+	0x00, 0x06, 0x00, 0x07, 0x00, 0x0c, 0x24, 0x00, 0x58, 0x36, 0x00, 0x00, 0x00, 0x27, 0x02, 0x01,
+	0x00, 0x42, 0x00, 0x02, 0x02, 0x39, 0x01, 0x02, 0x00, 0x36, 0x02, 0x00, 0x00, 0x27, 0x04, 0x03,
+	0x00, 0x42, 0x02, 0x02, 0x02, 0x39, 0x03, 0x04, 0x00, 0x27, 0x05, 0x05, 0x00, 0x42, 0x03, 0x02,
+	0x01, 0x35, 0x03, 0x06, 0x00, 0x4c, 0x03, 0x02, 0x00, 0x01, 0x00, 0x0a, 0x15, 0x57, 0x49, 0x4e,
+	0x44, 0x4f, 0x57, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x48, 0x49, 0x44, 0x45, 0x03, 0x06, 0x18,
+	0x57, 0x49, 0x4e, 0x44, 0x4f, 0x57, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x44, 0x45, 0x53, 0x54,
+	0x52, 0x4f, 0x59, 0x03, 0x04, 0x19, 0x57, 0x49, 0x4e, 0x44, 0x4f, 0x57, 0x45, 0x56, 0x45, 0x4e,
+	0x54, 0x5f, 0x47, 0x4f, 0x54, 0x46, 0x4f, 0x43, 0x55, 0x53, 0x03, 0x07, 0x17, 0x57, 0x49, 0x4e,
+	0x44, 0x4f, 0x57, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x03,
+	0x01, 0x1a, 0x57, 0x49, 0x4e, 0x44, 0x4f, 0x57, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x4c, 0x4f,
+	0x53, 0x54, 0x46, 0x4f, 0x43, 0x55, 0x53, 0x03, 0x08, 0x16, 0x57, 0x49, 0x4e, 0x44, 0x4f, 0x57,
+	0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x43, 0x4c, 0x4f, 0x53, 0x45, 0x03, 0x03, 0x17, 0x57, 0x49,
+	0x4e, 0x44, 0x4f, 0x57, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x52, 0x45, 0x53, 0x49, 0x5a, 0x45,
+	0x03, 0x02, 0x1b, 0x57, 0x49, 0x4e, 0x44, 0x4f, 0x57, 0x5f, 0x41, 0x44, 0x41, 0x50, 0x54, 0x45,
+	0x52, 0x5f, 0x44, 0x45, 0x46, 0x41, 0x55, 0x4c, 0x54, 0x03, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x17,
+	0x57, 0x49, 0x4e, 0x44, 0x4f, 0x57, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x52, 0x45, 0x44, 0x52,
+	0x41, 0x57, 0x03, 0x09, 0x15, 0x57, 0x49, 0x4e, 0x44, 0x4f, 0x57, 0x45, 0x56, 0x45, 0x4e, 0x54,
+	0x5f, 0x53, 0x48, 0x4f, 0x57, 0x03, 0x05, 0xb5, 0x0f, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65,
+	0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f,
+	0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f,
+	0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x74, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65,
+	0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f,
+	0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x3b, 0x0a, 0x0a, 0x74, 0x79, 0x70,
+	0x65, 0x64, 0x65, 0x66, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x28, 0x2a, 0x20, 0x77, 0x69, 0x6e,
+	0x64, 0x6f, 0x77, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x66, 0x6e, 0x29, 0x28, 0x77, 0x69, 0x6e,
+	0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x77, 0x69,
+	0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+	0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x77, 0x69, 0x6e,
+	0x64, 0x6f, 0x77, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x74, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
+	0x65, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+	0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x6d, 0x6f,
+	0x64, 0x75, 0x6c, 0x65, 0x5f, 0x69, 0x73, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69,
+	0x7a, 0x65, 0x64, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x72, 0x73, 0x69,
+	0x6f, 0x6e, 0x5f, 0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x75,
+	0x6c, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+	0x3b, 0x0a, 0x0a, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x20, 0x77, 0x69, 0x6e,
+	0x64, 0x6f, 0x77, 0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+	0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x2c, 0x20, 0x69, 0x6e,
+	0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+	0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a,
+	0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65,
+	0x28, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x77, 0x69,
+	0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28,
+	0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a,
+	0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x66,
+	0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f,
+	0x64, 0x65, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+	0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+	0x69, 0x6e, 0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x61, 0x64, 0x61, 0x70, 0x74,
+	0x65, 0x72, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x6d, 0x61, 0x78, 0x69, 0x6d,
+	0x69, 0x7a, 0x65, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x6d, 0x69, 0x6e, 0x69,
+	0x6d, 0x69, 0x7a, 0x65, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x72, 0x65, 0x73,
+	0x74, 0x6f, 0x72, 0x65, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x72, 0x65, 0x73,
+	0x69, 0x7a, 0x65, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x69,
+	0x6e, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x77,
+	0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+	0x77, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b,
+	0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x69, 0x73, 0x5f,
+	0x6f, 0x70, 0x65, 0x6e, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b,
+	0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x69, 0x73, 0x5f,
+	0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f,
+	0x69, 0x73, 0x5f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x64, 0x28, 0x77, 0x69, 0x6e,
+	0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x77, 0x69,
+	0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x69, 0x73, 0x5f, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x69, 0x7a, 0x65,
+	0x64, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x62, 0x6f,
+	0x6f, 0x6c, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x68, 0x61, 0x73, 0x5f, 0x66, 0x6f,
+	0x63, 0x75, 0x73, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x73, 0x68, 0x6f, 0x77,
+	0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74,
+	0x2a, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x73, 0x65, 0x74, 0x5f,
+	0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+	0x77, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b,
+	0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x69, 0x73, 0x5f,
+	0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x64, 0x28, 0x77, 0x69,
+	0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x77,
+	0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x28,
+	0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x29, 0x3b,
+	0x0a, 0x69, 0x6e, 0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x77, 0x69, 0x64, 0x74,
+	0x68, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x69, 0x6e,
+	0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x28,
+	0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20,
+	0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x5f,
+	0x78, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x69, 0x6e,
+	0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f,
+	0x6e, 0x5f, 0x79, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x66, 0x69, 0x74, 0x5f,
+	0x74, 0x6f, 0x5f, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+	0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20, 0x77, 0x69, 0x6e,
+	0x64, 0x6f, 0x77, 0x5f, 0x68, 0x77, 0x6e, 0x64, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+	0x77, 0x5f, 0x68, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x28, 0x77, 0x69, 0x6e, 0x64,
+	0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20, 0x77, 0x69,
+	0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x68, 0x64, 0x63, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f,
+	0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+	0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x5f, 0x68, 0x64, 0x63, 0x28, 0x76, 0x6f, 0x69,
+	0x64, 0x2a, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69,
+	0x64, 0x2a, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61,
+	0x79, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x2a, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65,
+	0x6e, 0x74, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+	0x67, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x61, 0x62, 0x6c,
+	0x65, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x2a, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x76, 0x69, 0x73, 0x75, 0x61,
+	0x6c, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x69, 0x6e,
+	0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x28,
+	0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+	0x2a, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x28, 0x77, 0x69,
+	0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+	0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x20, 0x77, 0x69,
+	0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+	0x77, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x76,
+	0x6f, 0x69, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x64,
+	0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x6c, 0x69, 0x6e, 0x6b, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+	0x77, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x64, 0x72, 0x61,
+	0x77, 0x5f, 0x66, 0x6e, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x77, 0x69, 0x6e,
+	0x64, 0x6f, 0x77, 0x5f, 0x73, 0x68, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x62, 0x6f, 0x61, 0x72,
+	0x64, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
+	0x69, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x68, 0x69, 0x64, 0x65, 0x5f, 0x6b,
+	0x65, 0x79, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74,
+	0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f,
+	0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x75, 0x6e, 0x73,
+	0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20,
+	0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x5f, 0x68, 0x65,
+	0x69, 0x67, 0x68, 0x74, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+	0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f,
+	0x76, 0x69, 0x65, 0x77, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+	0x77, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x2a, 0x29, 0x3b, 0x0a, 0x69, 0x6e,
+	0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x68, 0x65,
+	0x69, 0x67, 0x68, 0x74, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x74, 0x2a, 0x2c, 0x20,
+	0x76, 0x6f, 0x69, 0x64, 0x2a, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x63, 0x64, 0x65, 0x66, 0x0f, 0x66,
+	0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x06, 0x43, 0x08, 0x66, 0x66, 0x69, 0x0c,
+	0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x02, 0x02, 0x02, 0x03, 0x05, 0x05, 0x05, 0x08, 0x46,
+	0x46, 0x48, 0x57, 0x66, 0x66, 0x69, 0x00, 0x04, 0x09, 0x43, 0x00, 0x01, 0x08, 0x66, 0x6f, 0x75,
+	0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x03, 0x05, 0x00, 0x00,
+};
+
+static const lua_embedded_module_t lua_embedded_fr2[] = {
+	{{0x4666006cd11e65efULL, 0x291433d0785ef08dULL}, sizeof(lua_embedded_fr2_foundation), lua_embedded_fr2_foundation,
+	 {0xafe765efa0f49680ULL, 0x330b0e3cc9f5d632ULL, 0x8d12dcc7a538e789ULL, 0x8bd377c52b0ef08eULL}, "script/foundation.lua"},
+	{{0x49b42426567b296bULL, 0x894c85dde917c397ULL}, sizeof(lua_embedded_fr2_network), lua_embedded_fr2_network,
+	 {0xce56b47061ccf948ULL, 0xf211161ac15bac4eULL, 0x2874aa364f26e0a0ULL, 0xa651f87baec7589bULL}, "script/network.lua"},
+	{{0x4332d2fa81f4599aULL, 0x4113275e5e77eabaULL}, sizeof(lua_embedded_fr2_resource), lua_embedded_fr2_resource,
+	 {0x036ee316f9e00235ULL, 0xd29385597047aa41ULL, 0x89b81e1a27e24b3eULL, 0x19c8c36abfed49a0ULL}, "script/resource.lua"},
+	{{0x4a189d6f4b43ec66ULL, 0xa6debe148715d0b0ULL}, sizeof(lua_embedded_fr2_window), lua_embedded_fr2_window,
+	 {0x12033a4e89ade041ULL, 0x42dd6dc25ba304c6ULL, 0xa191513b3b3c2543ULL, 0x6a7a7058933f2a82ULL}, "script/window.lua"},
+};
@@ -16,17 +16,19 @@
 
 #include <lua/lua.h>
 
+#include <foundation/array.h>
+#include <foundation/hash.h>
+#include <foundation/hashmap.h>
 #include <foundation/log.h>
+#include <foundation/memory.h>
 #include <foundation/stream.h>
 #include <foundation/uuid.h>
 
-#include <resource/compile.h>
-#include <resource/stream.h>
-
 #undef LUA_API
 #define LUA_HAS_LUA_STATE_TYPE
 
 #include "luajit/src/lua.h"
+#include "luajit/src/lauxlib.h"
 
 lua_result_t
 lua_do_eval_string(lua_t* env, const char* code, size_t length);
@@ -37,6 +39,155 @@ lua_do_eval_stream(lua_t* env, stream_t* stream, uint64_t size_limit);
 lua_result_t
 lua_do_eval_uuid(lua_t* env, const uuid_t uuid);
 
+LUA_EXTERN lua_module_t*
+lua_module_load_resource(const uuid_t uuid, uint64_t platform, bool map, unsigned int* opened);
+
+LUA_EXTERN void
+lua_module_release(lua_module_t* module);
+
+LUA_EXTERN void
+lua_eval_cache_initialize(lua_t* env);
+
+LUA_EXTERN void
+lua_eval_cache_finalize(lua_t* env);
+
+void
+lua_eval_cache_initialize(lua_t* env) {
+	lua_config_t config = lua_module_config();
+	lua_eval_cache_t* cache = &env->eval_cache;
+	cache->capacity = config.eval_cache_capacity ? config.eval_cache_capacity : BUILD_LUA_EVAL_CACHE_CAPACITY;
+	cache->limit = config.eval_cache_limit ? config.eval_cache_limit : BUILD_LUA_EVAL_CACHE_LIMIT;
+	cache->lookup = hashmap_allocate(BUILD_SIZE_LUA_EVAL_CACHE_BUCKETS, 8);
+}
+
+void
+lua_eval_cache_finalize(lua_t* env) {
+	lua_eval_cache_t* cache = &env->eval_cache;
+	//Registry references are released with the state
+	for (size_t ientry = 0, esize = array_size(cache->entries); ientry < esize; ++ientry)
+		memory_deallocate(cache->entries[ientry].source);
+	array_deallocate(cache->entries);
+	if (cache->lookup)
+		hashmap_deallocate(cache->lookup);
+	cache->lookup = nullptr;
+}
+
+//Point the neighbours of the entry in the use list at the given slot (index plus one)
+static void
+lua_eval_cache_relink(lua_eval_cache_t* cache, lua_eval_cache_entry_t* entry, size_t slot) {
+	if (entry->newer)
+		cache->entries[entry->newer - 1].older = slot;
+	else
+		cache->newest = slot;
+	if (entry->older)
+		cache->entries[entry->older - 1].newer = slot;
+	else
+		cache->oldest = slot;
+}
+
+static void
+lua_eval_cache_unlink(lua_eval_cache_t* cache, size_t index) {
+	lua_eval_cache_entry_t* entry = cache->entries + index;
+	if (entry->newer)
+		cache->entries[entry->newer - 1].older = entry->older;
+	else
+		cache->newest = entry->older;
+	if (entry->older)
+		cache->entries[entry->older - 1].newer = entry->newer;
+	else
+		cache->oldest = entry->newer;
+}
+
+static void
+lua_eval_cache_link_newest(lua_eval_cache_t* cache, size_t index) {
+	lua_eval_cache_entry_t* entry = cache->entries + index;
+	entry->newer = 0;
+	entry->older = cache->newest;
+	if (cache->newest)
+		cache->entries[cache->newest - 1].newer = index + 1;
+	else
+		cache->oldest = index + 1;
+	cache->newest = index + 1;
+}
+
+static void
+lua_eval_cache_evict(lua_t* env, size_t index) {
+	lua_eval_cache_t* cache = &env->eval_cache;
+	lua_eval_cache_entry_t* entry = cache->entries + index;
+
+	luaL_unref(env->state, LUA_REGISTRYINDEX, entry->ref);
+	hashmap_erase(cache->lookup, entry->hash);
+	memory_deallocate(entry->source);
+	cache->bytes -= entry->length;
+	lua_eval_cache_unlink(cache, index);
+
+	//Last entry fills the hole, update the links to it
+	size_t last = array_size(cache->entries) - 1;
+	if (index != last) {
+		*entry = cache->entries[last];
+		hashmap_insert(cache->lookup, entry->hash, (void*)(uintptr_t)(index + 1));
+		lua_eval_cache_relink(cache, entry, index + 1);
+	}
+	array_pop(cache->entries);
+	++cache->evictions;
+}
+
+//Evict least recently used chunks until at most count chunks of at most size bytes remain
+static void
+lua_eval_cache_trim(lua_t* env, size_t count, size_t size) {
+	lua_eval_cache_t* cache = &env->eval_cache;
+	while (cache->oldest && ((array_size(cache->entries) > count) || (cache->bytes > size)))
+		lua_eval_cache_evict(env, cache->oldest - 1);
+}
+
+//Push cached chunk for source, return false if not cached
+static bool
+lua_eval_cache_push(lua_t* env, hash_t key, const char* code, size_t length) {
+	lua_eval_cache_t* cache = &env->eval_cache;
+	if (!cache->lookup)
+		return false;
+	size_t index = (size_t)(uintptr_t)hashmap_lookup(cache->lookup, key);
+	if (!index || (cache->entries[index - 1].length != length) ||
+	        (memcmp(cache->entries[index - 1].source, code, length) != 0)) {
+		++cache->misses;
+		return false;
+	}
+	lua_eval_cache_entry_t* entry = cache->entries + (index - 1);
+	lua_eval_cache_unlink(cache, index - 1);
+	lua_eval_cache_link_newest(cache, index - 1);
+	++cache->hits;
+	lua_rawgeti(env->state, LUA_REGISTRYINDEX, entry->ref);
+	return true;
+}
+
+//Pin the loaded chunk on top of stack in the registry and cache it for the source
+static void
+lua_eval_cache_store(lua_t* env, hash_t key, const char* code, size_t length) {
+	lua_eval_cache_t* cache = &env->eval_cache;
+	if (!cache->lookup || (length > cache->limit))
+		return;
+
+	//Replace a colliding entry with different source
+	size_t index = (size_t)(uintptr_t)hashmap_lookup(cache->lookup, key);
+	if (index)
+		lua_eval_cache_evict(env, index - 1);
+
+	lua_eval_cache_trim(env, cache->capacity - 1, cache->limit - length);
+
+	lua_pushvalue(env->state, -1);
+	lua_eval_cache_entry_t entry = {
+		.hash = key,
+		.length = length,
+		.source = memory_allocate(HASH_LUA, length ? length : 1, 0, MEMORY_PERSISTENT),
+		.ref = luaL_ref(env->state, LUA_REGISTRYINDEX)
+	};
+	memcpy(entry.source, code, length);
+	array_push(cache->entries, entry);
+	lua_eval_cache_link_newest(cache, array_size(cache->entries) - 1);
+	hashmap_insert(cache->lookup, key, (void*)(uintptr_t)array_size(cache->entries));
+	cache->bytes += length;
+}
+
 lua_result_t
 lua_do_eval_string(lua_t* env, const char* code, size_t length) {
 	lua_State* state;
@@ -46,18 +197,23 @@ lua_do_eval_string(lua_t* env, const char* code, size_t length) {
 
 	state = env->state;
 
-	lua_readstring_t read_string = {
-		.string = code,
-		.size   = length
-	};
+	hash_t key = hash(code, length);
+	if (!lua_eval_cache_push(env, key, code, length)) {
+		lua_readstring_t read_string = {
+			.string = code,
+			.size   = length
+		};
+
+		if (lua_load(state, lua_read_string, &read_string, "=eval") != 0) {
+			string_const_t errmsg = {0, 0};
+			errmsg.str = lua_tolstring(state, -1, &errmsg.length);
+			log_errorf(HASH_LUA, ERROR_INVALID_VALUE, STRING_CONST("Lua eval string failed on load: %.*s"),
+			           STRING_FORMAT(errmsg));
+			lua_pop(state, 1);
+			return LUA_ERROR;
+		}
 
-	if (lua_load(state, lua_read_string, &read_string, "=eval") != 0) {
-		string_const_t errmsg = {0, 0};
-		errmsg.str = lua_tolstring(state, -1, &errmsg.length);
-		log_errorf(HASH_LUA, ERROR_INVALID_VALUE, STRING_CONST("Lua eval string failed on load: %.*s"),
-		           STRING_FORMAT(errmsg));
-		lua_pop(state, 1);
-		return LUA_ERROR;
+		lua_eval_cache_store(env, key, code, length);
 	}
 
 	if (lua_pcall(state, 0, 0, 0) != 0) {
@@ -86,7 +242,29 @@ lua_do_eval_stream(lua_t* env, stream_t* stream, uint64_t size_limit) {
 		.remain = size_limit ? size_limit : 0x7FFFFFFFFFFFFFFFULL
 	};
 
-	if (lua_load(state, lua_read_stream, &read_stream, "=eval") != 0) {
+	//Local files are mapped and loaded in one chunk, other streams are read in chunks
+	size_t offset = stream_tell(stream);
+	size_t available = stream_size(stream);
+	size_t size = (available > offset) ? (available - offset) : 0;
+	if (size_limit && (size_limit < size))
+		size = (size_t)size_limit;
+
+	lua_mapping_t mapping;
+	int loaded;
+	if (lua_stream_map(stream, size, &mapping)) {
+		lua_readbuffer_t read_buffer = {
+			.buffer = mapping.data,
+			.size   = mapping.length,
+			.offset = 0
+		};
+		loaded = lua_load(state, lua_read_buffer, &read_buffer, "=eval");
+		lua_stream_unmap(&mapping);
+	}
+	else {
+		loaded = lua_load(state, lua_read_stream, &read_stream, "=eval");
+	}
+
+	if (loaded != 0) {
 		string_const_t errmsg = {0, 0};
 		errmsg.str = lua_tolstring(state, -1, &errmsg.length);
 		log_errorf(HASH_LUA, ERROR_INVALID_VALUE, STRING_CONST("Lua eval stream failed on load: %.*s"),
@@ -109,71 +287,46 @@ lua_do_eval_stream(lua_t* env, stream_t* stream, uint64_t size_limit) {
 
 lua_result_t
 lua_do_eval_uuid(lua_t* env, const uuid_t uuid) {
+	lua_State* state;
+
 	if (!env || uuid_is_null(uuid))
 		return LUA_ERROR;
 
-	const uint32_t expected_version = LUA_RESOURCE_MODULE_VERSION;
-	uint64_t platform = 0;
-	stream_t* stream;
-	bool success = false;
-	bool recompile = false;
-	bool recompiled = false;
+	state = env->state;
 
-	error_context_declare_local(
-	    char uuidbuf[40];
-	    const string_t uuidstr = string_from_uuid(uuidbuf, sizeof(uuidbuf), uuid)
-	);
-	error_context_push(STRING_CONST("loading resource"), STRING_ARGS(uuidstr));
+	//Not cached, the bytecode is only needed for a single load and local files can be mapped
+	lua_module_t* module = lua_module_load_resource(uuid, lua_resource_platform(), true, nullptr);
+	if (!module)
+		return LUA_ERROR;
 
-	platform = lua_resource_platform();
+	lua_readbuffer_t read_buffer = {
+		.buffer = module->bytecode,
+		.size   = module->size,
+		.offset = 0
+	};
 
-retry:
+	int loaded = lua_load(state, lua_read_buffer, &read_buffer, "=eval");
+	lua_module_release(module);
 
-	stream = resource_stream_open_static(uuid, platform);
-	if (stream) {
-		resource_header_t header = resource_stream_read_header(stream);
-		if ((header.type == HASH_LUA) && (header.version == expected_version)) {
-			success = true;
-		}
-		else {
-			log_warnf(HASH_LUA, WARNING_INVALID_VALUE,
-			          STRING_CONST("Got unexpected type/version: %" PRIx64 " : %u"),
-			          header.type, header.version);
-			recompile = true;
-		}
-		stream_deallocate(stream);
-		stream = nullptr;
-	}
-	if (success) {
-		success = false;
-		stream = resource_stream_open_dynamic(uuid, platform);
-	}
-	if (stream) {
-		uint32_t version = stream_read_uint32(stream);
-		size_t size = (size_t)stream_read_uint64(stream);
-		if (version == expected_version) {
-			if (lua_do_eval_stream(env, stream, size) == LUA_OK)
-				success = true;
-		}
-		else {
-			log_warnf(HASH_LUA, WARNING_INVALID_VALUE,
-			          STRING_CONST("Got unexpected type/version: %u"),
-			          version);
-			recompile = true;
-		}
-		stream_deallocate(stream);
-		stream = nullptr;
+	if (loaded != 0) {
+		string_const_t errmsg = {0, 0};
+		errmsg.str = lua_tolstring(state, -1, &errmsg.length);
+		log_errorf(HASH_LUA, ERROR_INVALID_VALUE, STRING_CONST("Lua eval resource failed on load: %.*s"),
+		           STRING_FORMAT(errmsg));
+		lua_pop(state, 1);
+		return LUA_ERROR;
 	}
 
-	if (recompile && !recompiled) {
-		recompiled = resource_compile(uuid, platform);
-		if (recompiled)
-			goto retry;
+	if (lua_pcall(state, 0, 0, 0) != 0) {
+		string_const_t errmsg = {0, 0};
+		errmsg.str = lua_tolstring(state, -1, &errmsg.length);
+		log_errorf(HASH_LUA, ERROR_INTERNAL_FAILURE, STRING_CONST("Lua eval resource failed on pcall: %.*s"),
+		           STRING_FORMAT(errmsg));
+		lua_pop(state, 1);
+		return LUA_ERROR;
 	}
 
-	error_context_pop();
-
-	return success ? LUA_OK : LUA_ERROR;
+	return LUA_OK;
 }
 
 lua_result_t
@@ -184,7 +337,7 @@ lua_eval_string(lua_t* env, const char* code, size_t length) {
 		op.cmd = LUACMD_EVAL;
 		op.data.name = code;
 		op.size = length;
-		lua_push_op(env, &op);
+		lua_push_op(env, &op, true);
 		return LUA_QUEUED;
 	}
 	lua_execute_pending(env);
@@ -203,7 +356,7 @@ lua_eval_stream(lua_t* env, stream_t* stream) {
 		lua_op_t op;
 		op.cmd = LUACMD_LOAD;
 		op.data.ptr = stream;
-		lua_push_op(env, &op);
+		lua_push_op(env, &op, true);
 		return LUA_QUEUED;
 	}
 	lua_execute_pending(env);
@@ -221,8 +374,8 @@ lua_eval_resource(lua_t* env, const uuid_t uuid) {
 	if (!lua_acquire_execution_right(env, true)) {
 		lua_op_t op;
 		op.cmd = LUACMD_LOAD_RESOURCE;
-		op.data.uuid = uuid;
-		lua_push_op(env, &op);
+		op.arg.value[0].uuid = uuid;
+		lua_push_op(env, &op, true);
 		return LUA_QUEUED;
 	}
 	lua_execute_pending(env);
@@ -233,3 +386,41 @@ lua_eval_resource(lua_t* env, const uuid_t uuid) {
 	return lua_do_eval_uuid(env, uuid);
 #endif
 }
+
+void
+lua_eval_cache_configure(lua_t* env, size_t capacity, size_t limit) {
+	if (!env)
+		return;
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+	lua_acquire_execution_right(env, true);
+#endif
+	lua_eval_cache_t* cache = &env->eval_cache;
+	cache->capacity = capacity;
+	cache->limit = limit;
+	if (cache->lookup)
+		lua_eval_cache_trim(env, capacity, limit);
+	if (!capacity && cache->lookup) {
+		hashmap_deallocate(cache->lookup);
+		cache->lookup = nullptr;
+	}
+	else if (capacity && !cache->lookup) {
+		cache->lookup = hashmap_allocate(BUILD_SIZE_LUA_EVAL_CACHE_BUCKETS, 8);
+	}
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+	lua_release_execution_right(env);
+#endif
+}
+
+lua_eval_cache_statistics_t
+lua_eval_cache_statistics(lua_t* env) {
+	lua_eval_cache_statistics_t statistics;
+	memset(&statistics, 0, sizeof(statistics));
+	if (!env)
+		return statistics;
+	statistics.hits = env->eval_cache.hits;
+	statistics.misses = env->eval_cache.misses;
+	statistics.evictions = env->eval_cache.evictions;
+	statistics.count = array_size(env->eval_cache.entries);
+	statistics.bytes = env->eval_cache.bytes;
+	return statistics;
+}
@@ -29,6 +29,22 @@ lua_eval_string(lua_t* env, const char* code, size_t length);
 LUA_API lua_result_t
 lua_eval_stream(lua_t* env, stream_t* stream);
 
+/*! Set limits of the compiled chunk cache of lua_eval_string in the given environment. Evaluating
+a string already in the cache runs the loaded chunk without parsing the source again. Least
+recently used chunks are evicted to stay within limits. Initial limits are taken from the module
+config (eval_cache_capacity and eval_cache_limit).
+\param env Lua environment
+\param capacity Maximum number of cached chunks, 0 to disable and clear the cache
+\param limit Maximum total size of source in bytes of cached chunks */
+LUA_API void
+lua_eval_cache_configure(lua_t* env, size_t capacity, size_t limit);
+
+/*! Get statistics of the compiled chunk cache of lua_eval_string in the given environment.
+\param env Lua environment
+\return Cache statistics */
+LUA_API lua_eval_cache_statistics_t
+lua_eval_cache_statistics(lua_t* env);
+
 //! Load code from resource
 LUA_API lua_result_t
 lua_eval_resource(lua_t* env, const uuid_t uuid);
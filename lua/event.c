@@ -14,19 +14,95 @@
 
 #include <lua/event.h>
 #include <lua/module.h>
+#include <lua/lua.h>
 
-#include <foundation/array.h>
+#include <foundation/foundation.h>
 #include <resource/event.h>
 
-extern lua_t**
-lua_instances(void);
+static mutex_t* _lua_event_lock;
+static uuid_t* _lua_event_pending;
+static tick_t _lua_event_last;
+
+LUA_EXTERN int
+lua_event_initialize(void);
+
+LUA_EXTERN void
+lua_event_finalize(void);
+
+LUA_EXTERN void
+lua_archive_shadow(const uuid_t uuid);
+
+int
+lua_event_initialize(void) {
+	_lua_event_lock = mutex_allocate(STRING_CONST("lua-event"));
+	_lua_event_pending = nullptr;
+	return 0;
+}
+
+void
+lua_event_finalize(void) {
+	array_deallocate(_lua_event_pending);
+	mutex_deallocate(_lua_event_lock);
+	_lua_event_lock = nullptr;
+}
+
+void
+lua_event_queue_reload(const uuid_t uuid, bool modified) {
+	//Drop stale bytecode right away so loads during the quiet period read the new version,
+	//bytecode packed in mounted archives is stale as well
+	if (modified) {
+		lua_archive_shadow(uuid);
+		lua_module_cache_invalidate(uuid);
+	}
+
+	mutex_lock(_lua_event_lock);
+	size_t ipend = 0, psize = array_size(_lua_event_pending);
+	while ((ipend < psize) && !uuid_equal(_lua_event_pending[ipend], uuid))
+		++ipend;
+	if (ipend == psize)
+		array_push(_lua_event_pending, uuid);
+	_lua_event_last = time_current();
+	mutex_unlock(_lua_event_lock);
+}
 
 void
 lua_event_handle_resource(const event_t* event) {
 	if ((event->id != RESOURCEEVENT_MODIFY) && (event->id != RESOURCEEVENT_DEPENDS))
 		return;
 
-	lua_t** instances = lua_instances();
-	for (size_t ienv = 0, esize = array_size(instances); ienv < esize; ++ienv)
-		lua_module_reload(instances[ienv], resource_event_uuid(event));
+	lua_event_queue_reload(resource_event_uuid(event), event->id == RESOURCEEVENT_MODIFY);
+
+	//Without a quiet period modules are reloaded as each event arrives
+	if (!lua_module_config().reload_delay)
+		lua_event_process_reloads(true);
+}
+
+unsigned int
+lua_event_process_reloads(bool force) {
+	unsigned int delay = lua_module_config().reload_delay;
+
+	mutex_lock(_lua_event_lock);
+	if (!array_size(_lua_event_pending)) {
+		mutex_unlock(_lua_event_lock);
+		return 0;
+	}
+	unsigned int elapsed = (unsigned int)(time_ticks_to_seconds(time_diff(_lua_event_last, time_current())) * 1000.0);
+	if (!force && (elapsed < delay)) {
+		mutex_unlock(_lua_event_lock);
+		return delay - elapsed;
+	}
+	uuid_t* batch = _lua_event_pending;
+	_lua_event_pending = nullptr;
+	mutex_unlock(_lua_event_lock);
+
+	log_debugf(HASH_LUA, STRING_CONST("Reloading batch of %" PRIsize " modules"), array_size(batch));
+	lua_module_reload_batch(batch, array_size(batch));
+	array_deallocate(batch);
+
+	//Events arriving while reloading start a new quiet period
+	mutex_lock(_lua_event_lock);
+	bool pending = array_size(_lua_event_pending) > 0;
+	mutex_unlock(_lua_event_lock);
+
+	return pending ? delay : 0;
 }
@@ -22,7 +22,24 @@
 #include <lua/types.h>
 
 /*! Handle resource events. No other event types should be
-passed to this function.
+passed to this function. Modified modules are reloaded right away, or queued for reload if
+a quiet period (reload_delay in module config) is set, in which case the application must
+call lua_event_process_reloads.
 \param event Resource event */
 LUA_API void
 lua_event_handle_resource(const event_t* event);
+
+/*! Queue a module for reload in all lua environments as if a resource event was received.
+Queuing the same module several times before the reload is processed only reloads it once.
+\param uuid Module
+\param modified Flag if the module resource was modified, dropping cached bytecode */
+LUA_API void
+lua_event_queue_reload(const uuid_t uuid, bool modified);
+
+/*! Process queued module reloads once no new reload has been queued for the quiet period
+(reload_delay in module config, none if 0), applying all of them as one batch per lua environment.
+Should be called periodically from the thread handling resource events.
+\param force Process queued reloads without waiting for the quiet period
+\return Milliseconds until queued reloads are due, 0 if nothing is queued */
+LUA_API unsigned int
+lua_event_process_reloads(bool force);
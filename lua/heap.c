@@ -0,0 +1,539 @@
+/* heap.c  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#define LUA_USE_INTERNAL_HEADER
+
+#include <lua/lua.h>
+#include <foundation/foundation.h>
+
+#undef LUA_API
+#define LUA_HAS_LUA_STATE_TYPE
+
+#include "luajit/src/lua.h"
+#include "luajit/src/lauxlib.h"
+
+#include <stdlib.h>
+
+#define LUA_HEAP_SNAPSHOT_VERSION 1
+
+//Type entries are stored first in the entry array, in LUA_HEAP_T* order
+#define LUA_HEAP_TABLE_ARRAY LUA_HEAP_NUMTYPES
+#define LUA_HEAP_TABLE_HASH (LUA_HEAP_NUMTYPES + 1)
+
+static const char* _lua_heap_type_name[] = {
+	"string", "upvalue", "thread", "proto", "function", "trace", "cdata", "table", "userdata",
+	"table.array", "table.hash"
+};
+
+static const char* _lua_heap_group_name[] = {
+	"type", "ctype", "site", "module"
+};
+
+struct lua_heap_ctype_t {
+	unsigned int id;
+	int64_t      count;
+	int64_t      bytes;
+};
+typedef struct lua_heap_ctype_t lua_heap_ctype_t;
+
+struct lua_heap_census_t {
+	lua_heap_snapshot_t* snapshot;
+	hashmap_t*           map;
+	lua_heap_ctype_t*    ctypes;
+	hashmap_t*           ctypemap;
+};
+typedef struct lua_heap_census_t lua_heap_census_t;
+
+static lua_heap_snapshot_t*
+lua_heap_snapshot_allocate(void) {
+	lua_heap_snapshot_t* snapshot = memory_allocate(HASH_LUA, sizeof(lua_heap_snapshot_t), 0,
+	                                                MEMORY_PERSISTENT | MEMORY_ZERO_INITIALIZED);
+	return snapshot;
+}
+
+static hash_t
+lua_heap_entry_key(lua_heap_group_t group, const char* name, size_t length) {
+	return hash(name, length) + (hash_t)group;
+}
+
+static lua_heap_entry_t*
+lua_heap_entry(lua_heap_snapshot_t* snapshot, hashmap_t* map, lua_heap_group_t group,
+               const char* name, size_t length) {
+	hash_t key = lua_heap_entry_key(group, name, length);
+	uintptr_t index = (uintptr_t)hashmap_lookup(map, key);
+	if (!index) {
+		lua_heap_entry_t entry = {
+			.group = group,
+			.name = string_clone(name, length),
+			.count = 0,
+			.bytes = 0
+		};
+		array_push(snapshot->entries, entry);
+		index = array_size(snapshot->entries);
+		hashmap_insert(map, key, (void*)index);
+	}
+	return snapshot->entries + (index - 1);
+}
+
+static hashmap_t*
+lua_heap_snapshot_map(const lua_heap_snapshot_t* snapshot) {
+	hashmap_t* map = hashmap_allocate(127, 15);
+	for (size_t ient = 0, esize = array_size(snapshot->entries); ient < esize; ++ient) {
+		const lua_heap_entry_t* entry = snapshot->entries + ient;
+		hashmap_insert(map, lua_heap_entry_key(entry->group, STRING_ARGS(entry->name)),
+		               (void*)(uintptr_t)(ient + 1));
+	}
+	return map;
+}
+
+static void
+lua_heap_census_walk(void* data, const lua_HeapObject* obj) {
+	lua_heap_census_t* census = data;
+	lua_heap_snapshot_t* snapshot = census->snapshot;
+	lua_heap_entry_t* entry;
+
+	++snapshot->count;
+	snapshot->bytes += (int64_t)obj->size;
+
+	if ((obj->type < 0) || (obj->type >= LUA_HEAP_NUMTYPES))
+		return;
+
+	entry = snapshot->entries + obj->type;
+	++entry->count;
+	entry->bytes += (int64_t)obj->size;
+
+	if (obj->type == LUA_HEAP_TTABLE) {
+		if (obj->arraysize) {
+			entry = snapshot->entries + LUA_HEAP_TABLE_ARRAY;
+			++entry->count;
+			entry->bytes += (int64_t)obj->arraysize;
+		}
+		if (obj->hashsize) {
+			entry = snapshot->entries + LUA_HEAP_TABLE_HASH;
+			++entry->count;
+			entry->bytes += (int64_t)obj->hashsize;
+		}
+	}
+	else if (obj->type == LUA_HEAP_TCDATA) {
+		//Names can not be resolved while walking, collect by id
+		uintptr_t index = (uintptr_t)hashmap_lookup(census->ctypemap, (hash_t)obj->ctypeid + 1);
+		if (!index) {
+			lua_heap_ctype_t ctype = {obj->ctypeid, 0, 0};
+			array_push(census->ctypes, ctype);
+			index = array_size(census->ctypes);
+			hashmap_insert(census->ctypemap, (hash_t)obj->ctypeid + 1, (void*)index);
+		}
+		++census->ctypes[index - 1].count;
+		census->ctypes[index - 1].bytes += (int64_t)obj->size;
+	}
+	else if (obj->chunkname && ((obj->type == LUA_HEAP_TFUNCTION) || (obj->type == LUA_HEAP_TPROTO))) {
+		char buffer[256];
+		const char* chunkname = obj->chunkname;
+		if ((*chunkname == '=') || (*chunkname == '@'))
+			++chunkname;
+		string_t site = string_format(buffer, sizeof(buffer), STRING_CONST("%s:%d"), chunkname,
+		                              obj->linedefined);
+		entry = lua_heap_entry(snapshot, census->map, LUAHEAP_SITE, STRING_ARGS(site));
+		++entry->count;
+		entry->bytes += (int64_t)obj->size;
+	}
+}
+
+static void
+lua_heap_census_ctypes(lua_State* state, lua_heap_census_t* census) {
+	for (size_t ict = 0, csize = array_size(census->ctypes); ict < csize; ++ict) {
+		const lua_heap_ctype_t* ctype = census->ctypes + ict;
+		size_t length = 0;
+		lua_pushctypename(state, ctype->id);
+		const char* name = lua_tolstring(state, -1, &length);
+		lua_heap_entry_t* entry = lua_heap_entry(census->snapshot, census->map, LUAHEAP_CTYPE, name,
+		                                         length);
+		entry->count += ctype->count;
+		entry->bytes += ctype->bytes;
+		lua_pop(state, 1);
+	}
+}
+
+static void
+lua_heap_census_push(lua_State* state, int visited, int pending, int* numpending, int idx) {
+	if (idx < 0)
+		idx = lua_gettop(state) + idx + 1;
+	if (!lua_heapsize(state, idx))
+		return;
+	lua_pushvalue(state, idx);
+	lua_rawget(state, visited);
+	bool seen = !lua_isnil(state, -1);
+	lua_pop(state, 1);
+	if (seen)
+		return;
+	lua_pushvalue(state, idx);
+	lua_pushboolean(state, 1);
+	lua_rawset(state, visited);
+	lua_pushvalue(state, idx);
+	lua_rawseti(state, pending, ++(*numpending));
+}
+
+//Attribute everything reachable from a module table to that module, skipping globals, the
+//registry and other module tables. Objects shared between modules count for the first one.
+static void
+lua_heap_census_module(lua_State* state, lua_heap_census_t* census, int visited, int module,
+                       const char* name, size_t length) {
+	lua_heap_entry_t* entry = lua_heap_entry(census->snapshot, census->map, LUAHEAP_MODULE, name,
+	                                         length);
+	int numpending = 0;
+	int64_t count = 0;
+	int64_t bytes = 0;
+
+	lua_newtable(state);
+	int pending = lua_gettop(state);
+
+	lua_pushvalue(state, module);
+	lua_rawseti(state, pending, ++numpending);
+
+	while (numpending) {
+		lua_rawgeti(state, pending, numpending);
+		lua_pushnil(state);
+		lua_rawseti(state, pending, numpending--);
+
+		int object = lua_gettop(state);
+		++count;
+		bytes += (int64_t)lua_heapsize(state, object);
+
+		switch (lua_type(state, object)) {
+		case LUA_TTABLE:
+			if (lua_getmetatable(state, object)) {
+				lua_heap_census_push(state, visited, pending, &numpending, -1);
+				lua_pop(state, 1);
+			}
+			lua_pushnil(state);
+			while (lua_next(state, object)) {
+				lua_heap_census_push(state, visited, pending, &numpending, -2);
+				lua_heap_census_push(state, visited, pending, &numpending, -1);
+				lua_pop(state, 1);
+			}
+			break;
+
+		case LUA_TFUNCTION:
+			for (int iup = 1; lua_getupvalue(state, object, iup); ++iup) {
+				lua_heap_census_push(state, visited, pending, &numpending, -1);
+				lua_pop(state, 1);
+			}
+			lua_getfenv(state, object);
+			lua_heap_census_push(state, visited, pending, &numpending, -1);
+			lua_pop(state, 1);
+			break;
+
+		case LUA_TUSERDATA:
+			if (lua_getmetatable(state, object)) {
+				lua_heap_census_push(state, visited, pending, &numpending, -1);
+				lua_pop(state, 1);
+			}
+			lua_getfenv(state, object);
+			lua_heap_census_push(state, visited, pending, &numpending, -1);
+			lua_pop(state, 1);
+			break;
+
+		default:
+			break;
+		}
+
+		lua_settop(state, object - 1);
+	}
+
+	lua_pop(state, 1);
+
+	entry->count += count;
+	entry->bytes += bytes;
+}
+
+static void
+lua_heap_census_modules(lua_State* state, lua_heap_census_t* census) {
+	int stacksize = lua_gettop(state);
+
+	lua_pushlstring(state, STRING_CONST(BUILD_REGISTRY_LOADED_MODULES));
+	lua_gettable(state, LUA_REGISTRYINDEX);
+	if (!lua_istable(state, -1)) {
+		lua_settop(state, stacksize);
+		return;
+	}
+	int loaded = lua_gettop(state);
+
+	//Mark shared roots and all module tables as visited up front so that modules are not
+	//attributed to each other through cross references
+	lua_newtable(state);
+	int visited = lua_gettop(state);
+
+	lua_pushvalue(state, LUA_GLOBALSINDEX);
+	lua_pushboolean(state, 1);
+	lua_rawset(state, visited);
+	lua_pushvalue(state, LUA_REGISTRYINDEX);
+	lua_pushboolean(state, 1);
+	lua_rawset(state, visited);
+	lua_pushvalue(state, loaded);
+	lua_pushboolean(state, 1);
+	lua_rawset(state, visited);
+
+	lua_pushnil(state);
+	while (lua_next(state, loaded)) {
+		if (lua_istable(state, -1)) {
+			lua_pushboolean(state, 1);
+			lua_rawset(state, visited);
+		}
+		else {
+			lua_pop(state, 1);
+		}
+	}
+
+	lua_pushnil(state);
+	while (lua_next(state, loaded)) {
+		int module = lua_gettop(state);
+		if (lua_istable(state, module)) {
+			lua_pushlstring(state, STRING_CONST("__modulename"));
+			lua_rawget(state, module);
+			size_t length = 0;
+			const char* name = lua_isstring(state, -1) ? lua_tolstring(state, -1, &length) : nullptr;
+			if (name && length)
+				lua_heap_census_module(state, census, visited, module, name, length);
+			lua_pop(state, 1);
+		}
+		lua_pop(state, 1);
+	}
+
+	lua_settop(state, stacksize);
+}
+
+lua_heap_snapshot_t*
+lua_heap_snapshot(lua_t* env) {
+	if (!env)
+		return nullptr;
+
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+	if (!lua_acquire_execution_right(env, true))
+		return nullptr;
+#endif
+
+	lua_State* state = env->state;
+	lua_heap_census_t census;
+	memset(&census, 0, sizeof(census));
+
+	census.snapshot = lua_heap_snapshot_allocate();
+	census.map = hashmap_allocate(127, 15);
+	census.ctypemap = hashmap_allocate(31, 7);
+
+	for (int itype = 0; itype < LUA_HEAP_TABLE_HASH + 1; ++itype)
+		lua_heap_entry(census.snapshot, census.map, LUAHEAP_TYPE, _lua_heap_type_name[itype],
+		               string_length(_lua_heap_type_name[itype]));
+
+	lua_gc(state, LUA_GCCOLLECT, 0);
+	lua_gc(state, LUA_GCSTOP, 0);
+
+	lua_heapwalk(state, lua_heap_census_walk, &census);
+	lua_heap_census_ctypes(state, &census);
+	lua_heap_census_modules(state, &census);
+
+	lua_gc(state, LUA_GCRESTART, 0);
+
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+	lua_release_execution_right(env);
+#endif
+
+	array_deallocate(census.ctypes);
+	hashmap_deallocate(census.ctypemap);
+	hashmap_deallocate(census.map);
+
+	return census.snapshot;
+}
+
+void
+lua_heap_snapshot_deallocate(lua_heap_snapshot_t* snapshot) {
+	if (!snapshot)
+		return;
+	for (size_t ient = 0, esize = array_size(snapshot->entries); ient < esize; ++ient)
+		string_deallocate(snapshot->entries[ient].name.str);
+	array_deallocate(snapshot->entries);
+	memory_deallocate(snapshot);
+}
+
+lua_heap_snapshot_t*
+lua_heap_snapshot_diff(const lua_heap_snapshot_t* before, const lua_heap_snapshot_t* after) {
+	if (!before || !after)
+		return nullptr;
+
+	lua_heap_snapshot_t* diff = lua_heap_snapshot_allocate();
+	hashmap_t* map = lua_heap_snapshot_map(before);
+	size_t esize;
+
+	diff->count = after->count - before->count;
+	diff->bytes = after->bytes - before->bytes;
+
+	bool* matched = memory_allocate(HASH_LUA, sizeof(bool) * (array_size(before->entries) + 1), 0,
+	                                MEMORY_TEMPORARY | MEMORY_ZERO_INITIALIZED);
+
+	esize = array_size(after->entries);
+	for (size_t ient = 0; ient < esize; ++ient) {
+		const lua_heap_entry_t* entry = after->entries + ient;
+		lua_heap_entry_t delta = {entry->group, {0, 0}, entry->count, entry->bytes};
+		uintptr_t index = (uintptr_t)hashmap_lookup(map, lua_heap_entry_key(entry->group,
+		                                                                    STRING_ARGS(entry->name)));
+		if (index) {
+			delta.count -= before->entries[index - 1].count;
+			delta.bytes -= before->entries[index - 1].bytes;
+			matched[index - 1] = true;
+		}
+		if (delta.count || delta.bytes) {
+			delta.name = string_clone(STRING_ARGS(entry->name));
+			array_push(diff->entries, delta);
+		}
+	}
+
+	esize = array_size(before->entries);
+	for (size_t ient = 0; ient < esize; ++ient) {
+		const lua_heap_entry_t* entry = before->entries + ient;
+		if (matched[ient] || (!entry->count && !entry->bytes))
+			continue;
+		lua_heap_entry_t delta = {entry->group, string_clone(STRING_ARGS(entry->name)),
+		                          -entry->count, -entry->bytes};
+		array_push(diff->entries, delta);
+	}
+
+	memory_deallocate(matched);
+	hashmap_deallocate(map);
+
+	return diff;
+}
+
+bool
+lua_heap_snapshot_write(const lua_heap_snapshot_t* snapshot, stream_t* stream) {
+	if (!snapshot || !stream)
+		return false;
+
+	stream_write_format(stream, STRING_CONST("luaheap %d %" PRId64 " %" PRId64 "\n"),
+	                    LUA_HEAP_SNAPSHOT_VERSION, snapshot->count, snapshot->bytes);
+	for (size_t ient = 0, esize = array_size(snapshot->entries); ient < esize; ++ient) {
+		const lua_heap_entry_t* entry = snapshot->entries + ient;
+		stream_write_format(stream, STRING_CONST("%s %" PRId64 " %" PRId64 " %.*s\n"),
+		                    _lua_heap_group_name[entry->group], entry->count, entry->bytes,
+		                    STRING_FORMAT(entry->name));
+	}
+	stream_flush(stream);
+
+	return true;
+}
+
+//Split off the next space separated token, returns remainder
+static string_const_t
+lua_heap_token(string_const_t* line) {
+	size_t offset = string_find(STRING_ARGS(*line), ' ', 0);
+	string_const_t token = string_substr(STRING_ARGS(*line), 0, offset);
+	*line = (offset != STRING_NPOS) ? string_substr(STRING_ARGS(*line), offset + 1, STRING_NPOS) :
+	        string_const(nullptr, 0);
+	return token;
+}
+
+lua_heap_snapshot_t*
+lua_heap_snapshot_read(stream_t* stream) {
+	if (!stream)
+		return nullptr;
+
+	string_t line = stream_read_line(stream, '\n');
+	string_const_t remain = string_to_const(line);
+	string_const_t magic = lua_heap_token(&remain);
+	string_const_t version = lua_heap_token(&remain);
+	if (!string_equal(STRING_ARGS(magic), STRING_CONST("luaheap")) ||
+	        (string_to_int(STRING_ARGS(version)) != LUA_HEAP_SNAPSHOT_VERSION)) {
+		log_warn(HASH_LUA, WARNING_INVALID_VALUE, STRING_CONST("Invalid heap snapshot header"));
+		string_deallocate(line.str);
+		return nullptr;
+	}
+
+	lua_heap_snapshot_t* snapshot = lua_heap_snapshot_allocate();
+	hashmap_t* map = hashmap_allocate(127, 15);
+
+	string_const_t count = lua_heap_token(&remain);
+	snapshot->count = string_to_int64(STRING_ARGS(count));
+	snapshot->bytes = string_to_int64(STRING_ARGS(remain));
+	string_deallocate(line.str);
+
+	while (!stream_eos(stream)) {
+		line = stream_read_line(stream, '\n');
+		remain = string_to_const(line);
+		string_const_t group = lua_heap_token(&remain);
+		count = lua_heap_token(&remain);
+		string_const_t bytes = lua_heap_token(&remain);
+		int igroup = 0;
+		while ((igroup < LUAHEAP_GROUP_COUNT) &&
+		        !string_equal(STRING_ARGS(group), _lua_heap_group_name[igroup],
+		                      string_length(_lua_heap_group_name[igroup])))
+			++igroup;
+		if ((igroup < LUAHEAP_GROUP_COUNT) && remain.length) {
+			lua_heap_entry_t* entry = lua_heap_entry(snapshot, map, (lua_heap_group_t)igroup,
+			                                         STRING_ARGS(remain));
+			entry->count += string_to_int64(STRING_ARGS(count));
+			entry->bytes += string_to_int64(STRING_ARGS(bytes));
+		}
+		string_deallocate(line.str);
+	}
+
+	hashmap_deallocate(map);
+
+	return snapshot;
+}
+
+static int
+lua_heap_entry_compare(const void* first, const void* second) {
+	const lua_heap_entry_t* lhs = *(const lua_heap_entry_t* const*)first;
+	const lua_heap_entry_t* rhs = *(const lua_heap_entry_t* const*)second;
+	int64_t lbytes = (lhs->bytes < 0) ? -lhs->bytes : lhs->bytes;
+	int64_t rbytes = (rhs->bytes < 0) ? -rhs->bytes : rhs->bytes;
+	if (lhs->group != rhs->group)
+		return (lhs->group < rhs->group) ? -1 : 1;
+	if (lbytes != rbytes)
+		return (lbytes > rbytes) ? -1 : 1;
+	return 0;
+}
+
+void
+lua_heap_snapshot_log(const lua_heap_snapshot_t* snapshot, size_t limit) {
+	if (!snapshot)
+		return;
+
+	size_t esize = array_size(snapshot->entries);
+	const lua_heap_entry_t** sorted = memory_allocate(HASH_LUA, sizeof(lua_heap_entry_t*) * (esize + 1),
+	                                                  0, MEMORY_TEMPORARY);
+	for (size_t ient = 0; ient < esize; ++ient)
+		sorted[ient] = snapshot->entries + ient;
+	qsort(sorted, esize, sizeof(lua_heap_entry_t*), lua_heap_entry_compare);
+
+	log_infof(HASH_LUA, STRING_CONST("Heap: %" PRId64 " objects, %" PRId64 " bytes"),
+	          snapshot->count, snapshot->bytes);
+
+	int group = -1;
+	size_t logged = 0;
+	for (size_t ient = 0; ient < esize; ++ient) {
+		const lua_heap_entry_t* entry = sorted[ient];
+		if (!entry->count && !entry->bytes)
+			continue;
+		if ((int)entry->group != group) {
+			group = (int)entry->group;
+			logged = 0;
+			log_infof(HASH_LUA, STRING_CONST("  By %s:"), _lua_heap_group_name[group]);
+		}
+		if (limit && (logged++ >= limit))
+			continue;
+		log_infof(HASH_LUA, STRING_CONST("    %12" PRId64 " %14" PRId64 "  %.*s"),
+		          entry->count, entry->bytes, STRING_FORMAT(entry->name));
+	}
+
+	memory_deallocate(sorted);
+}
@@ -0,0 +1,64 @@
+/* heap.h  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#pragma once
+
+/*! \file heap.h
+    Lua heap inspection */
+
+#include <foundation/platform.h>
+
+#include <lua/types.h>
+
+/*! Take a census of all objects in the heap of the given Lua environment. A full garbage
+collection is performed before the heap is walked. Objects are counted by type (with tables
+split in array and hash parts), cdata by C type, functions and prototypes by defining source
+location, and objects reachable from loaded module tables by module name.
+\param env Lua environment
+\return Heap snapshot, null if failed */
+LUA_API lua_heap_snapshot_t*
+lua_heap_snapshot(lua_t* env);
+
+/*! Deallocate a heap snapshot
+\param snapshot Heap snapshot */
+LUA_API void
+lua_heap_snapshot_deallocate(lua_heap_snapshot_t* snapshot);
+
+/*! Compute the difference between two snapshots. Entries in the resulting snapshot hold
+the change in count and bytes from the first to the second snapshot, unchanged entries
+are omitted.
+\param before Earlier snapshot
+\param after Later snapshot
+\return Difference snapshot */
+LUA_API lua_heap_snapshot_t*
+lua_heap_snapshot_diff(const lua_heap_snapshot_t* before, const lua_heap_snapshot_t* after);
+
+/*! Write snapshot to stream in text format
+\param snapshot Heap snapshot
+\param stream Output stream
+\return true if successful, false if failed */
+LUA_API bool
+lua_heap_snapshot_write(const lua_heap_snapshot_t* snapshot, stream_t* stream);
+
+/*! Read snapshot previously written by lua_heap_snapshot_write
+\param stream Input stream
+\return Heap snapshot, null if stream is not a valid snapshot */
+LUA_API lua_heap_snapshot_t*
+lua_heap_snapshot_read(stream_t* stream);
+
+/*! Log snapshot entries, largest byte count first
+\param snapshot Heap snapshot
+\param limit Maximum number of entries to log per group, 0 for all */
+LUA_API void
+lua_heap_snapshot_log(const lua_heap_snapshot_t* snapshot, size_t limit);
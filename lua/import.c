@@ -16,32 +16,158 @@
 #include <lua/lua.h>
 #include <resource/resource.h>
 
+LUA_EXTERN int
+lua_import_initialize(void);
+
+LUA_EXTERN void
+lua_import_finalize(void);
+
+LUA_EXTERN size_t
+lua_jobs_run(bool (*work)(void*, size_t), void* data, size_t count, size_t threads);
+
+/* Import jobs run concurrently, the lock serializes import map lookups and stores as well as
+   writes of resource source files. Reading and digesting source files is not serialized. */
+static mutex_t* _lua_import_lock;
+
+int
+lua_import_initialize(void) {
+	_lua_import_lock = mutex_allocate(STRING_CONST("lua-import"));
+	return 0;
+}
+
+void
+lua_import_finalize(void) {
+	mutex_deallocate(_lua_import_lock);
+	_lua_import_lock = nullptr;
+}
+
+static bool
+lua_import_job(void* data, size_t index) {
+	lua_import_job_t* job = (lua_import_job_t*)data + index;
+	tick_t start = time_current();
+	job->size = (size_t)fs_size(STRING_ARGS(job->path));
+	job->success = resource_import(STRING_ARGS(job->path), uuid_null());
+	job->time = time_ticks_to_seconds(time_diff(start, time_current()));
+	return job->success;
+}
+
+size_t
+lua_import_jobs(lua_import_job_t* jobs, size_t count, unsigned int threads) {
+	size_t numthreads = threads ? threads : system_hardware_threads();
+	if (numthreads > BUILD_LUA_IMPORT_THREADS)
+		numthreads = BUILD_LUA_IMPORT_THREADS;
+	return lua_jobs_run(lua_import_job, jobs, count, numthreads);
+}
+
+size_t
+lua_import_collect(const char* path, size_t length, lua_import_job_t** jobs, string_t** paths) {
+	lua_import_job_t job;
+	memset(&job, 0, sizeof(job));
+	if (!fs_is_directory(path, length)) {
+		job.path = string_const(path, length);
+		array_push(*jobs, job);
+		return 1;
+	}
+
+	string_t* files = fs_matching_files(path, length, STRING_CONST("^.*\\.lua$"), true);
+	size_t count = array_size(files);
+	for (size_t ifile = 0; ifile < count; ++ifile) {
+		string_t filepath = path_allocate_concat(path, length, STRING_ARGS(files[ifile]));
+		array_push(*paths, filepath);
+		job.path = string_const(STRING_ARGS(filepath));
+		array_push(*jobs, job);
+	}
+	string_array_deallocate(files);
+	return count;
+}
+
 #if RESOURCE_ENABLE_LOCAL_SOURCE
 
 typedef struct {
-	char* sourcecode;
+	const char* sourcecode;
 	size_t sourcecode_size;
 	tick_t timestamp;
+	hash_t checksum;
+	//! Digest for the import map, equal to stream_sha256 of the source stream
+	uint256_t signature;
+	//! Read buffer, null if the source is mapped
+	char* buffer;
+	lua_mapping_t mapping;
 } luaimport_source_t;
 
+/* Digest like stream_sha256, which treats CR and CR+LF line endings as LF in text streams.
+   A CR ending one chunk makes a leading LF of the next chunk part of the same line ending. */
+static void
+lua_import_digest(sha256_t* digest, const char* data, size_t size, bool binary, bool* skip_lf) {
+	if (binary) {
+		sha256_digest(digest, data, size);
+		return;
+	}
+
+	size_t last = (*skip_lf && size && (data[0] == '\n')) ? 1 : 0;
+	*skip_lf = false;
+	for (size_t ic = last; ic < size; ++ic) {
+		if (data[ic] != '\r')
+			continue;
+		if (ic > last)
+			sha256_digest(digest, data + last, ic - last);
+		sha256_digest(digest, "\n", 1);
+		if (ic + 1 == size)
+			*skip_lf = true;
+		else if (data[ic + 1] == '\n')
+			++ic;
+		last = ic + 1;
+	}
+	if (last < size)
+		sha256_digest(digest, data + last, size - last);
+}
+
+//Read the source once, mapped if large enough, digesting each chunk for the import map as it arrives
 static int
 lua_import_stream(stream_t* stream, luaimport_source_t* source) {
-	int result = -1;
+	const bool binary = stream_is_binary(stream);
+	bool skip_lf = false;
+	bool success = true;
+	size_t size = stream_size(stream);
 
-	source->sourcecode_size = stream_size(stream);
-	source->sourcecode = memory_allocate(HASH_LUA, source->sourcecode_size, 0, MEMORY_PERSISTENT);
+	source->sourcecode_size = size;
 	source->timestamp = stream_last_modified(stream);
 
-	if (stream_read(stream, source->sourcecode, source->sourcecode_size) == source->sourcecode_size)
-		result = 0;
+	sha256_t* digest = sha256_allocate();
+	if (lua_stream_map(stream, size, &source->mapping)) {
+		source->sourcecode = source->mapping.data;
+		for (size_t offset = 0; offset < size; offset += BUILD_LUA_IMPORT_CHUNK_SIZE) {
+			size_t chunk = size - offset;
+			if (chunk > BUILD_LUA_IMPORT_CHUNK_SIZE)
+				chunk = BUILD_LUA_IMPORT_CHUNK_SIZE;
+			lua_import_digest(digest, source->sourcecode + offset, chunk, binary, &skip_lf);
+		}
+	}
+	else {
+		source->buffer = memory_allocate(HASH_LUA, size, 0, MEMORY_PERSISTENT);
+		source->sourcecode = source->buffer;
+		for (size_t offset = 0; success && (offset < size); offset += BUILD_LUA_IMPORT_CHUNK_SIZE) {
+			size_t chunk = size - offset;
+			if (chunk > BUILD_LUA_IMPORT_CHUNK_SIZE)
+				chunk = BUILD_LUA_IMPORT_CHUNK_SIZE;
+			success = (stream_read(stream, source->buffer + offset, chunk) == chunk);
+			if (success)
+				lua_import_digest(digest, source->buffer + offset, chunk, binary, &skip_lf);
+		}
+	}
+	sha256_digest_finalize(digest);
+	source->signature = sha256_get_digest_raw(digest);
+	sha256_deallocate(digest);
+
+	if (success)
+		source->checksum = hash(source->sourcecode, size);
 
-	return result;
+	return success ? 0 : -1;
 }
 
 static int
 lua_import_output(const uuid_t uuid, const luaimport_source_t* import) {
 	resource_source_t source;
-	hash_t checksum;
 	tick_t timestamp;
 	uint64_t platform;
 	string_const_t type = string_const(STRING_CONST("lua"));
@@ -53,10 +179,9 @@ lua_import_output(const uuid_t uuid, const luaimport_source_t* import) {
 	timestamp = import->timestamp;
 	platform = 0;
 
-	checksum = hash(import->sourcecode, import->sourcecode_size);
-	if (resource_source_write_blob(uuid, timestamp, HASH_SOURCE, platform, checksum,
+	if (resource_source_write_blob(uuid, timestamp, HASH_SOURCE, platform, import->checksum,
 	                               import->sourcecode, import->sourcecode_size)) {
-		resource_source_set_blob(&source, timestamp, HASH_SOURCE, platform, checksum,
+		resource_source_set_blob(&source, timestamp, HASH_SOURCE, platform, import->checksum,
 		                         import->sourcecode_size);
 	} else {
 		string_const_t uuidstr = string_from_uuid_static(uuid);
@@ -91,7 +216,7 @@ lua_import(stream_t* stream, const uuid_t uuid_given) {
 	string_const_t path;
 	string_const_t extension;
 	bool store_import = false;
-	luaimport_source_t source = {0, 0};
+	luaimport_source_t source;
 	int ret;
 
 	path = stream_path(stream);
@@ -99,8 +224,13 @@ lua_import(stream_t* stream, const uuid_t uuid_given) {
 	if (!string_equal_nocase(STRING_ARGS(extension), STRING_CONST("lua")))
 		return -1;
 
-	if (uuid_is_null(uuid))
+	memset(&source, 0, sizeof(source));
+
+	if (uuid_is_null(uuid)) {
+		mutex_lock(_lua_import_lock);
 		uuid = resource_import_lookup(STRING_ARGS(path)).uuid;
+		mutex_unlock(_lua_import_lock);
+	}
 
 	if (uuid_is_null(uuid)) {
 		uuid = uuid_generate_random();
@@ -112,7 +242,9 @@ lua_import(stream_t* stream, const uuid_t uuid_given) {
 	error_context_push(STRING_CONST("importing module"), STRING_ARGS(uuidstr));
 
 	if (store_import) {
+		mutex_lock(_lua_import_lock);
 		uuid_t founduuid = resource_import_map_store(STRING_ARGS(path), uuid, uint256_null());
+		mutex_unlock(_lua_import_lock);
 		if (uuid_is_null(founduuid)) {
 			log_warn(HASH_RESOURCE, WARNING_SUSPICIOUS,
 			         STRING_CONST("Unable to open import map file to store new resource"));
@@ -125,14 +257,17 @@ lua_import(stream_t* stream, const uuid_t uuid_given) {
 	if ((ret = lua_import_stream(stream, &source)) < 0)
 		goto exit;
 
-	if ((ret = lua_import_output(uuid, &source)) < 0)
-		goto exit;
-
-	resource_import_map_store(STRING_ARGS(path), uuid, stream_sha256(stream));
+	mutex_lock(_lua_import_lock);
+	ret = lua_import_output(uuid, &source);
+	if (ret == 0)
+		resource_import_map_store(STRING_ARGS(path), uuid, source.signature);
+	mutex_unlock(_lua_import_lock);
 
 exit:
 
-	memory_deallocate(source.sourcecode);
+	if (source.mapping.base)
+		lua_stream_unmap(&source.mapping);
+	memory_deallocate(source.buffer);
 
 	error_context_pop();
 
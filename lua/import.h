@@ -28,3 +28,22 @@
 \return 0 if successful, <0 if error */
 LUA_API int
 lua_import(stream_t* stream, const uuid_t uuid);
+
+/*! Import files in parallel on a pool of threads through resource_import. Each file is read
+once, the checksum and import map signature are computed in the same pass, and resource writes
+are serialized. Blocks until all jobs are done.
+\param jobs Jobs, success, size and time are set for each job
+\param count Number of jobs
+\param threads Maximum number of threads including the calling thread, 0 for hardware thread count
+\return Number of files successfully imported */
+LUA_API size_t
+lua_import_jobs(lua_import_job_t* jobs, size_t count, unsigned int threads);
+
+/*! Add import jobs for a file, or for all .lua files in a directory and its subdirectories
+\param path File or directory path
+\param length Length of path
+\param jobs Array of jobs to add to
+\param paths Array taking ownership of allocated job paths, deallocate with string_array_deallocate
+\return Number of jobs added */
+LUA_API size_t
+lua_import_collect(const char* path, size_t length, lua_import_job_t** jobs, string_t** paths);
@@ -0,0 +1,180 @@
+/* jobs.c  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#include <lua/lua.h>
+
+#include <foundation/foundation.h>
+
+LUA_EXTERN int
+lua_jobs_initialize(void);
+
+LUA_EXTERN void
+lua_jobs_finalize(void);
+
+LUA_EXTERN size_t
+lua_jobs_run(bool (*work)(void*, size_t), void* data, size_t count, size_t threads);
+
+LUA_EXTERN void
+lua_compile_state_release(void);
+
+struct lua_jobs_t {
+	bool (*work)(void*, size_t);
+	void* data;
+	size_t count;
+	//! Maximum number of workers joining the calling thread
+	size_t helpers;
+	//! Number of workers that joined, protected by the lock
+	size_t joined;
+	atomic32_t next;
+	atomic32_t succeeded;
+	//! Number of workers currently working the batch
+	atomic32_t working;
+};
+typedef struct lua_jobs_t lua_jobs_t;
+
+/* Worker threads are started on demand and live until finalize, keeping their thread local
+   state such as compile states across batches. The lock protects the list of batches open
+   for workers to join, the worker thread count and the exit flag. */
+static mutex_t* _lua_jobs_lock;
+static semaphore_t _lua_jobs_signal;
+static thread_t _lua_jobs_thread[BUILD_LUA_JOB_THREADS];
+static size_t _lua_jobs_threads;
+static lua_jobs_t** _lua_jobs_batches;
+static bool _lua_jobs_exit;
+
+int
+lua_jobs_initialize(void) {
+	_lua_jobs_lock = mutex_allocate(STRING_CONST("lua-jobs"));
+	semaphore_initialize(&_lua_jobs_signal, 0);
+	_lua_jobs_threads = 0;
+	_lua_jobs_exit = false;
+	return 0;
+}
+
+void
+lua_jobs_finalize(void) {
+	mutex_lock(_lua_jobs_lock);
+	_lua_jobs_exit = true;
+	size_t threads = _lua_jobs_threads;
+	mutex_unlock(_lua_jobs_lock);
+
+	for (size_t ith = 0; ith < threads; ++ith)
+		semaphore_post(&_lua_jobs_signal);
+	for (size_t ith = 0; ith < threads; ++ith)
+		thread_finalize(&_lua_jobs_thread[ith]);
+
+	array_deallocate(_lua_jobs_batches);
+	semaphore_finalize(&_lua_jobs_signal);
+	mutex_deallocate(_lua_jobs_lock);
+	_lua_jobs_lock = nullptr;
+	_lua_jobs_threads = 0;
+}
+
+static void
+lua_jobs_work(lua_jobs_t* jobs) {
+	while (true) {
+		int32_t index = atomic_incr32(&jobs->next, memory_order_relaxed) - 1;
+		if (index >= (int32_t)jobs->count)
+			break;
+		if (jobs->work(jobs->data, (size_t)index))
+			atomic_incr32(&jobs->succeeded, memory_order_relaxed);
+	}
+}
+
+//Each wakeup joins at most one batch with unclaimed jobs, stale wakeups find none and wait again
+static void*
+lua_jobs_worker(void* arg) {
+	FOUNDATION_UNUSED(arg);
+	while (semaphore_wait(&_lua_jobs_signal)) {
+		lua_jobs_t* jobs = nullptr;
+		mutex_lock(_lua_jobs_lock);
+		if (_lua_jobs_exit) {
+			mutex_unlock(_lua_jobs_lock);
+			break;
+		}
+		for (size_t ibatch = 0, bsize = array_size(_lua_jobs_batches); ibatch < bsize; ++ibatch) {
+			lua_jobs_t* batch = _lua_jobs_batches[ibatch];
+			if ((batch->joined < batch->helpers) &&
+			        (atomic_load32(&batch->next, memory_order_relaxed) < (int32_t)batch->count)) {
+				++batch->joined;
+				atomic_incr32(&batch->working, memory_order_relaxed);
+				jobs = batch;
+				break;
+			}
+		}
+		mutex_unlock(_lua_jobs_lock);
+
+		if (jobs) {
+			lua_jobs_work(jobs);
+			atomic_decr32(&jobs->working, memory_order_release);
+		}
+	}
+	lua_compile_state_release();
+	return 0;
+}
+
+/* The calling thread works the batch together with up to threads-1 pool workers and returns
+   once every job is done. Returns number of jobs the work function succeeded for. */
+size_t
+lua_jobs_run(bool (*work)(void*, size_t), void* data, size_t count, size_t threads) {
+	lua_jobs_t jobs;
+
+	if (!count)
+		return 0;
+
+	jobs.work = work;
+	jobs.data = data;
+	jobs.count = count;
+	jobs.helpers = ((threads < count) ? threads : count);
+	jobs.helpers = jobs.helpers ? jobs.helpers - 1 : 0;
+	if (jobs.helpers > BUILD_LUA_JOB_THREADS)
+		jobs.helpers = BUILD_LUA_JOB_THREADS;
+	jobs.joined = 0;
+	atomic_store32(&jobs.next, 0, memory_order_relaxed);
+	atomic_store32(&jobs.succeeded, 0, memory_order_relaxed);
+	atomic_store32(&jobs.working, 0, memory_order_relaxed);
+
+	if (jobs.helpers) {
+		mutex_lock(_lua_jobs_lock);
+		while (_lua_jobs_threads < jobs.helpers) {
+			thread_t* thread = &_lua_jobs_thread[_lua_jobs_threads++];
+			thread_initialize(thread, lua_jobs_worker, nullptr, STRING_CONST("lua_jobs"),
+			                  THREAD_PRIORITY_NORMAL, 0);
+			thread_start(thread);
+		}
+		array_push(_lua_jobs_batches, &jobs);
+		mutex_unlock(_lua_jobs_lock);
+
+		for (size_t ihelp = 0; ihelp < jobs.helpers; ++ihelp)
+			semaphore_post(&_lua_jobs_signal);
+	}
+
+	lua_jobs_work(&jobs);
+
+	if (jobs.helpers) {
+		//No worker joins once removed, wait for the ones still finishing their last job
+		mutex_lock(_lua_jobs_lock);
+		for (size_t ibatch = 0, bsize = array_size(_lua_jobs_batches); ibatch < bsize; ++ibatch) {
+			if (_lua_jobs_batches[ibatch] == &jobs) {
+				array_erase(_lua_jobs_batches, ibatch);
+				break;
+			}
+		}
+		mutex_unlock(_lua_jobs_lock);
+		while (atomic_load32(&jobs.working, memory_order_acquire))
+			thread_yield();
+	}
+
+	return (size_t)atomic_load32(&jobs.succeeded, memory_order_acquire);
+}
@@ -19,6 +19,7 @@
 #include <foundation/foundation.h>
 #include <resource/import.h>
 #include <resource/compile.h>
+#include <resource/platform.h>
 #include <resource/stream.h>
 
 #include <setjmp.h>
@@ -29,6 +30,7 @@
 #include "luajit/src/lua.h"
 #include "luajit/src/lauxlib.h"
 #include "luajit/src/lualib.h"
+#include "luajit/src/lj_arch.h"
 
 #if !FOUNDATION_PLATFORM_WINDOWS
 #include <sys/mman.h>
@@ -38,10 +40,17 @@
 
 static lua_config_t _lua_config;
 static lua_t** _lua_instances;
+static mutex_t* _lua_instances_lock;
 
 lua_t**
 lua_instances(void);
 
+void
+lua_instances_lock(void);
+
+void
+lua_instances_unlock(void);
+
 extern lua_result_t
 lua_do_bind(lua_t* env, const char* property, size_t length, lua_command_t cmd, lua_value_t val);
 
@@ -61,10 +70,28 @@ static lua_result_t
 lua_do_get(lua_t* env, const char* property, size_t length);
 
 LUA_EXTERN void
-lua_module_registry_finalize(lua_State* state);
+lua_module_registry_finalize(lua_t* env);
+
+LUA_EXTERN void
+lua_module_registry_initialize(lua_t* env);
+
+LUA_EXTERN void
+lua_profile_allocation_sample(lua_t* env, size_t size);
+
+LUA_EXTERN void
+lua_profile_deallocate(lua_t* env);
+
+LUA_EXTERN void
+lua_eval_cache_initialize(lua_t* env);
+
+LUA_EXTERN void
+lua_eval_cache_finalize(lua_t* env);
 
 LUA_EXTERN void
-lua_module_registry_initialize(lua_State* state);
+lua_module_reload_queued(lua_t* env, void* data);
+
+LUA_EXTERN void
+lua_module_reload_discard(void* data);
 
 #if BUILD_ENABLE_LUA_THREAD_SAFE
 
@@ -106,21 +133,34 @@ lua_release_execution_right(lua_t* env) {
 	}
 }
 
-void
-lua_push_op(lua_t* env, lua_op_t* op) {
-	unsigned int ofs, old;
-	do {
-		old = atomic_load32(&env->queue_tail);
-		ofs = old + 1;
-		if (ofs >= BUILD_LUA_CALL_QUEUE_SIZE)
-			ofs = 0;
+bool
+lua_push_op(lua_t* env, lua_op_t* op, bool force) {
+	unsigned int next, slot;
+	while (true) {
+		slot = atomic_load32(&env->queue_tail);
+		next = slot + 1;
+		if (next >= BUILD_LUA_CALL_QUEUE_SIZE)
+			next = 0;
+		//The slot after the tail stays free to stop the consumer. When full, take the execution
+		//right and drain the queue instead of overwriting unexecuted ops
+		if (env->queue[next].cmd != LUACMD_WAIT) {
+			if (!lua_acquire_execution_right(env, force))
+				return false;
+			lua_execute_pending(env);
+			lua_release_execution_right(env);
+			continue;
+		}
+		if (atomic_cas32(&env->queue_tail, next, slot))
+			break;
 	}
-	while (!atomic_cas32(&env->queue_tail, ofs, old));
 
-	//Got slot, copy except command
-	memcpy(&env->queue[ofs].data, &op->data, sizeof(op->data) + sizeof(lua_arg_t));
+	//Got slot, copy except command (consumer starts at head, which trails tail)
+	env->queue[slot].data = op->data;
+	env->queue[slot].size = op->size;
+	env->queue[slot].arg = op->arg;
 	//Now set command, completing insert
-	env->queue[ofs].cmd = op->cmd;
+	env->queue[slot].cmd = op->cmd;
+	return true;
 }
 
 void
@@ -136,7 +176,7 @@ lua_execute_pending(lua_t* env) {
 			break;
 
 		case LUACMD_LOAD_RESOURCE:
-			lua_do_eval_uuid(env, env->queue[head].data.ptr);
+			lua_do_eval_uuid(env, env->queue[head].arg.value[0].uuid);
 			break;
 
 		case LUACMD_EVAL:
@@ -154,6 +194,10 @@ lua_execute_pending(lua_t* env) {
 			            env->queue[head].arg.value[0]);
 			break;
 
+		case LUACMD_RELOAD:
+			lua_module_reload_queued(env, env->queue[head].data.ptr);
+			break;
+
 		default:
 			break;
 		}
@@ -296,10 +340,27 @@ lua_allocator(void* env, void* block, size_t osize, size_t nsize) {
 		if (!block && env && ((lua_t*)env)->state)
 			log_panicf(HASH_LUA, ERROR_OUT_OF_MEMORY, STRING_CONST("Unable to allocate Lua memory (%" PRIsize " bytes)"),
 			           nsize);
+		else if (env && ((lua_t*)env)->profile && (nsize > osize))
+			lua_profile_allocation_sample(env, nsize - osize);
 	}
 	return block;
 }
 
+static FOUNDATION_NOINLINE int
+lua_panic(lua_State* state);
+
+LUA_EXTERN lua_State*
+lua_state_allocate_bare(void);
+
+//State with no libraries and no lua_t environment, used for compiling only
+lua_State*
+lua_state_allocate_bare(void) {
+	lua_State* state = lua_newstate(lua_allocator, nullptr);
+	if (state)
+		lua_atpanic(state, lua_panic);
+	return state;
+}
+
 static FOUNDATION_NOINLINE int
 lua_panic(lua_State* state) {
 	string_const_t errmsg = {0, 0};
@@ -316,9 +377,83 @@ lua_instances(void) {
 	return _lua_instances;
 }
 
+void
+lua_instances_lock(void) {
+	if (_lua_instances_lock)
+		mutex_lock(_lua_instances_lock);
+}
+
+void
+lua_instances_unlock(void) {
+	if (_lua_instances_lock)
+		mutex_unlock(_lua_instances_lock);
+}
+
+//Libraries like ffi only return their table, set the global for all named libraries
+static void
+lua_open_library(lua_State* state, lua_CFunction fn, const char* name) {
+	lua_pushcfunction(state, fn);
+	lua_pushstring(state, name);
+	lua_call(state, 1, 1);
+	if (*name && lua_istable(state, -1))
+		lua_setfield(state, LUA_GLOBALSINDEX, name);
+	else
+		lua_pop(state, 1);
+}
+
+static void
+lua_open_libraries(lua_State* state, unsigned int libraries) {
+	static const struct {
+		unsigned int  flag;
+		const char*   name;
+		lua_CFunction fn;
+	} library[] = {
+#if LJ_HASFFI
+		{ LUALIB_FFI, LUA_FFILIBNAME, luaopen_ffi },
+#endif
+		{ LUALIB_TABLE, LUA_TABLIBNAME, luaopen_table },
+		{ LUALIB_STRING, LUA_STRLIBNAME, luaopen_string },
+		{ LUALIB_MATH, LUA_MATHLIBNAME, luaopen_math },
+		{ LUALIB_DEBUG, LUA_DBLIBNAME, luaopen_debug },
+		{ LUALIB_BIT, LUA_BITLIBNAME, luaopen_bit },
+		{ LUALIB_JIT, LUA_JITLIBNAME, luaopen_jit }
+	};
+	const size_t count = sizeof(library) / sizeof(library[0]);
+
+	if (libraries & LUALIB_BASE)
+		lua_open_library(state, luaopen_base, "");
+
+	if (!(libraries & LUALIB_PACKAGE)) {
+		//No require, open libraries directly
+		for (size_t ilib = 0; ilib < count; ++ilib) {
+			if (libraries & library[ilib].flag)
+				lua_open_library(state, library[ilib].fn, library[ilib].name);
+		}
+		return;
+	}
+
+	//Same as luaL_openlibs, libraries other than base and package are loaded on require
+	lua_open_library(state, luaopen_package, LUA_LOADLIBNAME);
+	luaL_findtable(state, LUA_REGISTRYINDEX, "_PRELOAD", (int)count);
+	for (size_t ilib = 0; ilib < count; ++ilib) {
+		if (libraries & library[ilib].flag) {
+			lua_pushcfunction(state, library[ilib].fn);
+			lua_setfield(state, -2, library[ilib].name);
+		}
+	}
+	lua_pop(state, 1);
+}
+
 lua_t*
 lua_allocate(void) {
+	return lua_allocate_libraries(_lua_config.libraries);
+}
+
+lua_t*
+lua_allocate_libraries(unsigned int libraries) {
 	lua_t* env = lua_allocator(0, 0, 0, sizeof(lua_t));
+	if (env)
+		memset(env, 0, sizeof(lua_t));
 
 	//Foundation allocators can meet demands of luajit on both 32 and 64 bit platforms
 	lua_State* state = env ? lua_newstate(lua_allocator, env) : nullptr;
@@ -347,13 +482,17 @@ lua_allocate(void) {
 
 	int stacksize = lua_gettop(state);
 
-	luaL_openlibs(state);
+	lua_open_libraries(state, libraries ? libraries : LUALIB_PROFILE_FULL);
+
+	lua_module_registry_initialize(env);
 
-	lua_module_registry_initialize(state);
+	lua_eval_cache_initialize(env);
 
 	lua_pop(state, lua_gettop(state) - stacksize);
 
+	lua_instances_lock();
 	array_push(_lua_instances, env);
+	lua_instances_unlock();
 
 	return env;
 }
@@ -366,23 +505,36 @@ lua_deallocate(lua_t* env) {
 	FOUNDATION_ASSERT(env->calldepth == 0);
 	FOUNDATION_ASSERT(env->state);
 
+	//Remove first so resource event reloads no longer reach the state
+	lua_instances_lock();
+	for (size_t ienv = 0, esize = array_size(_lua_instances); ienv != esize; ++ienv) {
+		if (_lua_instances[ienv] == env) {
+			array_erase(_lua_instances, ienv);
+			break;
+		}
+	}
+	lua_instances_unlock();
+
 	lua_gc(env->state, LUA_GCCOLLECT, 0);
 
-	lua_module_registry_finalize(env->state);
+	lua_module_registry_finalize(env);
+
+	lua_eval_cache_finalize(env);
+
+	lua_profile_deallocate(env);
 
 	lua_close(env->state);
 
 #if BUILD_ENABLE_LUA_THREAD_SAFE
+	//Release module references held by reloads never applied
+	for (unsigned int iop = 0; iop < BUILD_LUA_CALL_QUEUE_SIZE; ++iop) {
+		if (env->queue[iop].cmd == LUACMD_RELOAD)
+			lua_module_reload_discard(env->queue[iop].data.ptr);
+	}
+
 	semaphore_finalize(&env->execution_right);
 #endif
 
-	for (size_t ienv = 0, esize = array_size(_lua_instances); ienv != esize; ++ienv) {
-		if (_lua_instances[ienv] == env) {
-			array_erase(_lua_instances, ienv);
-			break;
-		}
-	}
-
 	memory_deallocate(env);
 }
 
@@ -581,6 +733,36 @@ lua_modulemap_initialize(void);
 extern void
 lua_modulemap_finalize(void);
 
+extern int
+lua_event_initialize(void);
+
+extern void
+lua_event_finalize(void);
+
+extern int
+lua_archive_initialize(void);
+
+extern void
+lua_archive_finalize(void);
+
+extern int
+lua_import_initialize(void);
+
+extern void
+lua_import_finalize(void);
+
+extern int
+lua_jobs_initialize(void);
+
+extern void
+lua_jobs_finalize(void);
+
+extern int
+lua_compile_initialize(void);
+
+extern void
+lua_compile_finalize(void);
+
 extern int
 lua_symbol_initialize(void);
 
@@ -591,14 +773,12 @@ static bool _module_initialized;
 
 int
 lua_module_initialize(const lua_config_t config) {
-	FOUNDATION_UNUSED(config);
-
 	if (_module_initialized)
 		return 0;
 
 	_module_initialized = true;
 
-	memset(&_lua_config, 0, sizeof(_lua_config));
+	_lua_config = config;
 
 	if (lua_symbol_initialize() < 0)
 		return -1;
@@ -606,6 +786,23 @@ lua_module_initialize(const lua_config_t config) {
 	if (lua_modulemap_initialize() < 0)
 		return -1;
 
+	if (lua_archive_initialize() < 0)
+		return -1;
+
+	if (lua_event_initialize() < 0)
+		return -1;
+
+	if (lua_compile_initialize() < 0)
+		return -1;
+
+	if (lua_import_initialize() < 0)
+		return -1;
+
+	if (lua_jobs_initialize() < 0)
+		return -1;
+
+	_lua_instances_lock = mutex_allocate(STRING_CONST("lua-instances"));
+
 	hashmap_t* symbol_map = lua_symbol_lookup_map();
 	hashmap_insert(symbol_map, hash(STRING_CONST("lua_symbol_load_foundation")), (void*)(uintptr_t)lua_symbol_load_foundation);
 	hashmap_insert(symbol_map, hash(STRING_CONST("lua_symbol_load_network")), (void*)(uintptr_t)lua_symbol_load_network);
@@ -621,6 +818,9 @@ lua_module_initialize(const lua_config_t config) {
 	lua_module_register(STRING_CONST("window"), LUA_WINDOW_UUID, lua_module_loader,
 	                    lua_symbol_load_window);
 
+	if (!_lua_config.disable_embedded_modules)
+		lua_archive_mount_embedded();
+
 	resource_import_register(lua_import);
 	resource_compile_register(lua_compile);
 
@@ -637,10 +837,18 @@ lua_module_finalize(void) {
 	if (!_module_initialized)
 		return;
 
+	//Workers close their compile states as they exit
+	lua_jobs_finalize();
+	lua_import_finalize();
+	lua_compile_finalize();
+	lua_event_finalize();
 	lua_modulemap_finalize();
+	lua_archive_finalize();
 	lua_symbol_finalize();
 
 	array_deallocate(_lua_instances);
+	mutex_deallocate(_lua_instances_lock);
+	_lua_instances_lock = nullptr;
 
 	_module_initialized = false;
 }
@@ -661,8 +869,37 @@ lua_module_parse_config(const char* path, size_t path_size,
                         const json_token_t* tokens, size_t num_tokens) {
 	FOUNDATION_UNUSED(path);
 	FOUNDATION_UNUSED(path_size);
-	FOUNDATION_UNUSED(buffer);
 	FOUNDATION_UNUSED(size);
-	FOUNDATION_UNUSED(tokens);
-	FOUNDATION_UNUSED(num_tokens);
+
+	if (!num_tokens || (tokens[0].type != JSON_OBJECT))
+		return;
+
+	//lua = { compile_profile = "release" compile_platforms = { <platform> = "development" } compress_resources = true }
+	for (size_t igroup = tokens[0].child; igroup && (igroup < num_tokens); igroup = tokens[igroup].sibling) {
+		string_const_t group = json_token_identifier(buffer, tokens + igroup);
+		if ((tokens[igroup].type != JSON_OBJECT) || !string_equal(STRING_ARGS(group), STRING_CONST("lua")))
+			continue;
+		for (size_t itok = tokens[igroup].child; itok && (itok < num_tokens); itok = tokens[itok].sibling) {
+			const json_token_t* token = tokens + itok;
+			string_const_t id = json_token_identifier(buffer, token);
+			if ((token->type == JSON_STRING) && string_equal(STRING_ARGS(id), STRING_CONST("compile_profile"))) {
+				string_const_t value = json_token_value(buffer, token);
+				_lua_config.compile_profile = lua_compile_profile_parse(STRING_ARGS(value));
+			}
+			else if ((token->type == JSON_PRIMITIVE) &&
+			         string_equal(STRING_ARGS(id), STRING_CONST("compress_resources"))) {
+				string_const_t value = json_token_value(buffer, token);
+				_lua_config.compress_resources = string_equal(STRING_ARGS(value), STRING_CONST("true"));
+			}
+			else if ((token->type == JSON_OBJECT) &&
+			         string_equal(STRING_ARGS(id), STRING_CONST("compile_platforms"))) {
+				for (size_t iplat = token->child; iplat && (iplat < num_tokens); iplat = tokens[iplat].sibling) {
+					string_const_t decl = json_token_identifier(buffer, tokens + iplat);
+					string_const_t value = json_token_value(buffer, tokens + iplat);
+					lua_compile_set_profile(resource_platform_parse(STRING_ARGS(decl)),
+					                        lua_compile_profile_parse(STRING_ARGS(value)));
+				}
+			}
+		}
+	}
 }
@@ -23,13 +23,19 @@
 #include <lua/hashstrings.h>
 #include <lua/bind.h>
 #include <lua/module.h>
+#include <lua/archive.h>
 #include <lua/symbol.h>
 #include <lua/event.h>
 #include <lua/read.h>
 #include <lua/import.h>
 #include <lua/compile.h>
+#include <lua/compress.h>
 #include <lua/eval.h>
 #include <lua/call.h>
+#include <lua/heap.h>
+#include <lua/profile.h>
+#include <lua/template.h>
+#include <lua/subenv.h>
 
 #include <lua/foundation.h>
 #include <lua/network.h>
@@ -64,10 +70,16 @@ lua_module_parse_config(const char* path, size_t path_size,
                         const json_token_t* tokens, size_t num_tokens);
 
 
-//! Allocate environment
+//! Allocate environment with libraries given by module config
 LUA_API lua_t*
 lua_allocate(void);
 
+/*! Allocate environment with the given set of standard libraries
+\param libraries Libraries (lua_library_t flags or a LUALIB_PROFILE_* profile), 0 for full profile
+\return New environment, null if failed */
+LUA_API lua_t*
+lua_allocate_libraries(unsigned int libraries);
+
 //! Shutdown and free resources
 LUA_API void
 lua_deallocate(lua_t* env);
@@ -113,8 +125,8 @@ lua_acquire_execution_right(lua_t* env, bool force);
 void
 lua_release_execution_right(lua_t* env);
 
-void
-lua_push_op(lua_t* env, lua_op_t* op);
+bool
+lua_push_op(lua_t* env, lua_op_t* op, bool force);
 
 void
 lua_execute_pending(lua_t* env);
@@ -124,7 +136,7 @@ lua_execute_pending(lua_t* env);
 #define lua_has_execution_right(env) ((void)sizeof(env)), true
 #define lua_acquire_execution_right(env, force) ((void)sizeof(env)), ((void)sizeof(force))
 #define lua_release_execution_right(env) ((void)sizeof(env))
-#define lua_push_op(env, op) ((void)sizeof(env)), ((void)sizeof(op))
+#define lua_push_op(env, op, force) ((void)sizeof(env)), ((void)sizeof(op)), ((void)sizeof(force)), true
 #define lua_execute_pending(env) ((void)sizeof(env))
 
 #endif
@@ -25,6 +25,7 @@
 #include "lj_vm.h"
 #include "lj_strscan.h"
 #include "lj_strfmt.h"
+#include "lj_ctype.h"
 
 /* -- Common helper functions --------------------------------------------- */
 
@@ -1308,3 +1309,140 @@ LUA_API int (lua_is_fr2) (void);
 LUA_API int lua_is_fr2(void) {
   return LJ_FR2;
 }
+
+/* -- Heap inspection ----------------------------------------------------- */
+
+/* Fill heap object descriptor for a collectable object. */
+static void api_heapobj(global_State *g, GCobj *o, lua_HeapObject *ho)
+{
+  memset(ho, 0, sizeof(lua_HeapObject));
+  ho->ptr = o;
+  ho->type = (int)o->gch.gct - (int)~LJ_TSTR;
+  switch (o->gch.gct) {
+  case ~LJ_TSTR:
+    ho->size = sizestring(gco2str(o));
+    break;
+  case ~LJ_TUPVAL:
+    ho->size = sizeof(GCupval);
+    break;
+  case ~LJ_TTHREAD:
+    ho->size = sizeof(lua_State) + gco2th(o)->stacksize*sizeof(TValue);
+    break;
+  case ~LJ_TPROTO: {
+    GCproto *pt = gco2pt(o);
+    ho->size = pt->sizept;
+    ho->chunkname = proto_chunknamestr(pt);
+    ho->linedefined = (int)pt->firstline;
+    break;
+    }
+  case ~LJ_TFUNC: {
+    GCfunc *fn = gco2func(o);
+    if (isluafunc(fn)) {
+      GCproto *pt = funcproto(fn);
+      ho->size = sizeLfunc((MSize)fn->l.nupvalues);
+      ho->chunkname = proto_chunknamestr(pt);
+      ho->linedefined = (int)pt->firstline;
+    } else {
+      ho->size = sizeCfunc((MSize)fn->c.nupvalues);
+    }
+    break;
+    }
+#if LJ_HASJIT
+  case ~LJ_TTRACE: {
+    GCtrace *T = gco2trace(o);
+    ho->size = ((sizeof(GCtrace)+7)&~7) + (T->nins-T->nk)*sizeof(IRIns) +
+	       T->nsnap*sizeof(SnapShot) + T->nsnapmap*sizeof(SnapEntry);
+    break;
+    }
+#endif
+#if LJ_HASFFI
+  case ~LJ_TCDATA: {
+    GCcdata *cd = gco2cd(o);
+    ho->ctypeid = cd->ctypeid;
+    if (cdataisv(cd)) {
+      ho->size = sizecdatav(cd);
+    } else {
+      CType *ct = ctype_raw(ctype_ctsG(g), cd->ctypeid);
+      ho->size = sizeof(GCcdata) +
+		 (ctype_hassize(ct->info) ? ct->size : CTSIZE_PTR);
+    }
+    break;
+    }
+#endif
+  case ~LJ_TTAB: {
+    GCtab *t = gco2tab(o);
+    ho->size = sizeof(GCtab);
+    if (LJ_MAX_COLOSIZE != 0 && t->colo)
+      ho->size = sizetabcolo((uint32_t)t->colo & 0x7f);
+    ho->arraysize = t->asize*sizeof(TValue);
+    if (t->asize > 0 && !(LJ_MAX_COLOSIZE != 0 && t->colo > 0))
+      ho->size += ho->arraysize;
+    if (t->hmask > 0) {
+      ho->hashsize = (t->hmask+1)*sizeof(Node);
+      ho->size += ho->hashsize;
+    }
+    break;
+    }
+  case ~LJ_TUDATA:
+    ho->size = sizeudata(gco2ud(o));
+    break;
+  default:
+    break;
+  }
+  UNUSED(g);
+}
+
+/* Walk all collectable objects. Must not allocate or run the collector. */
+LUA_API void lua_heapwalk(lua_State *L, lua_HeapWalker walker, void *ud)
+{
+  global_State *g = G(L);
+  lua_HeapObject ho;
+  GCobj *o;
+  MSize i;
+  for (o = gcref(g->gc.root); o != NULL; o = gcref(o->gch.nextgc)) {
+    api_heapobj(g, o, &ho);
+    walker(ud, &ho);
+  }
+  for (i = 0; i <= g->strmask; i++) {
+    for (o = gcref(g->strhash[i]); o != NULL; o = gcref(o->gch.nextgc)) {
+      api_heapobj(g, o, &ho);
+      walker(ud, &ho);
+    }
+  }
+}
+
+/* Size of the collectable object at a stack index, or 0. */
+LUA_API size_t lua_heapsize(lua_State *L, int idx)
+{
+  cTValue *o = index2adr(L, idx);
+  lua_HeapObject ho;
+  if (o == niltv(L) || !tvisgcv(o))
+    return 0;
+  api_heapobj(G(L), gcV(o), &ho);
+  return ho.size;
+}
+
+/* Push the declaration string of a C type ID. */
+LUA_API const char *lua_pushctypename(lua_State *L, unsigned int id)
+{
+#if LJ_HASFFI
+  CTState *cts = ctype_ctsG(G(L));
+  if (cts != NULL && id > 0 && id < cts->top) {
+    GCstr *s = lj_ctype_repr(L, (CTypeID)id, NULL);
+    setstrV(L, L->top, s);
+    incr_top(L);
+    return strdata(s);
+  }
+#endif
+  UNUSED(id);
+  lua_pushliteral(L, "cdata");
+  return lua_tostring(L, -1);
+}
+
+/* Currently executing thread, or main thread if not executing. */
+LUA_API lua_State *lua_currentthread(lua_State *L)
+{
+  global_State *g = G(L);
+  GCobj *o = gcref(g->cur_L);
+  return o ? gco2th(o) : mainthread(g);
+}
@@ -166,3 +166,13 @@ LUA_API int lua_dump(lua_State *L, lua_Writer writer, void *data)
     return 1;
 }
 
+LUA_API int lua_dumpx(lua_State *L, lua_Writer writer, void *data, int strip)
+{
+  cTValue *o = L->top-1;
+  api_check(L, L->top > L->base);
+  if (tvisfunc(o) && isluafunc(funcV(o)))
+    return lj_bcwrite(L, funcproto(funcV(o)), writer, data, strip);
+  else
+    return 1;
+}
+
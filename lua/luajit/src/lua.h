@@ -249,6 +249,41 @@ LUA_API lua_Alloc (lua_getallocf) (lua_State *L, void **ud);
 LUA_API void lua_setallocf (lua_State *L, lua_Alloc f, void *ud);
 
 
+/*
+** heap inspection (object types in collector order)
+*/
+
+#define LUA_HEAP_TSTRING	0
+#define LUA_HEAP_TUPVAL		1
+#define LUA_HEAP_TTHREAD	2
+#define LUA_HEAP_TPROTO		3
+#define LUA_HEAP_TFUNCTION	4
+#define LUA_HEAP_TTRACE		5
+#define LUA_HEAP_TCDATA		6
+#define LUA_HEAP_TTABLE		7
+#define LUA_HEAP_TUSERDATA	8
+#define LUA_HEAP_NUMTYPES	9
+
+typedef struct lua_HeapObject {
+  const void *ptr;		/* Object address. */
+  int type;			/* LUA_HEAP_T* type. */
+  size_t size;			/* Total size including owned parts. */
+  size_t arraysize;		/* Size of table array part. */
+  size_t hashsize;		/* Size of table hash part. */
+  unsigned int ctypeid;		/* C type ID of cdata. */
+  const char *chunkname;	/* Chunk name of Lua function or prototype. */
+  int linedefined;		/* First line of Lua function or prototype. */
+} lua_HeapObject;
+
+typedef void (*lua_HeapWalker) (void *ud, const lua_HeapObject *obj);
+
+LUA_API void (lua_heapwalk) (lua_State *L, lua_HeapWalker walker, void *ud);
+LUA_API size_t (lua_heapsize) (lua_State *L, int idx);
+LUA_API const char *(lua_pushctypename) (lua_State *L, unsigned int id);
+LUA_API lua_State *(lua_currentthread) (lua_State *L);
+LUA_API int (lua_dumpx) (lua_State *L, lua_Writer writer, void *data, int strip);
+
+
 
 /*
 ** ===============================================================
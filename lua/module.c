@@ -30,14 +30,32 @@
 LUA_EXTERN int
 lj_cf_package_loader_registry(lua_State* state);
 
-static hashmap_t* _lua_modulemap;
+/* Read-mostly module map used by require from all states. Entries are never removed, so the
+   table is insert-only: writers serialize on the lock and publish slots with release stores,
+   readers probe with acquire loads and never lock. Growing publishes a new table, retired
+   tables are kept until finalize since readers may still be probing them. */
+struct lua_modulemap_t {
+	size_t capacity;
+	atomicptr_t slot[];
+};
+typedef struct lua_modulemap_t lua_modulemap_t;
+
+static atomicptr_t _lua_modulemap;
+static lua_modulemap_t** _lua_modulemap_retired;
+static size_t _lua_modulemap_count;
 static mutex_t* _lua_modulemap_lock;
 
-struct lua_module_t {
-	void* bytecode;
-	size_t size;
+//Module load in progress outside of the cache lock, flagged if the module is invalidated meanwhile
+struct lua_module_loading_t {
+	uuid_t uuid;
+	bool invalidated;
 };
-typedef struct lua_module_t lua_module_t;
+typedef struct lua_module_loading_t lua_module_loading_t;
+
+static lua_module_t** _lua_module_cache;
+static lua_module_loading_t** _lua_module_cache_loading;
+static mutex_t* _lua_module_cache_lock;
+static lua_module_cache_statistics_t _lua_module_cache_stats;
 
 LUA_EXTERN int
 lua_modulemap_initialize(void);
@@ -46,77 +64,153 @@ LUA_EXTERN void
 lua_modulemap_finalize(void);
 
 LUA_EXTERN void
-lua_module_registry_initialize(lua_State* state);
+lua_module_registry_initialize(lua_t* env);
 
 LUA_EXTERN void
-lua_module_registry_finalize(lua_State* state);
+lua_module_registry_finalize(lua_t* env);
 
-#if FOUNDATION_COMPILER_GCC
-#  pragma GCC diagnostic ignored "-Wpedantic"
-#endif
+LUA_EXTERN lua_module_t*
+lua_module_load_resource(const uuid_t uuid, uint64_t platform, bool map, unsigned int* opened);
 
-#define LOADED_MODULES_ENTRY_ARRAY "entry"
+LUA_EXTERN void
+lua_module_release(lua_module_t* module);
 
-static void
-lua_module_registry_add(lua_State* state, lua_modulemap_entry_t* entry) {
-	lua_pushlstring(state, STRING_CONST(BUILD_REGISTRY_LOADED_MODULES));
-	lua_gettable(state, LUA_REGISTRYINDEX);
+LUA_EXTERN lua_module_t*
+lua_archive_load(const uuid_t uuid, uint64_t platform);
 
-	lua_pushlstring(state, STRING_CONST(LOADED_MODULES_ENTRY_ARRAY));
-	lua_gettable(state, -2);
+LUA_EXTERN void
+lua_archive_release(lua_archive_t* archive);
 
-	lua_modulemap_entry_t** entryarr = lua_touserdata(state, -1);
-	array_push(entryarr, entry);
+LUA_EXTERN void
+lua_module_reload_queued(lua_t* env, void* data);
 
-	lua_pushlstring(state, STRING_CONST(LOADED_MODULES_ENTRY_ARRAY));
-	lua_pushlightuserdata(state, entryarr);
-	lua_settable(state, -4);
+LUA_EXTERN void
+lua_module_reload_discard(void* data);
 
-	lua_pop(state, 2);
-}
+LUA_EXTERN lua_t**
+lua_instances(void);
 
-static lua_modulemap_entry_t*
-lua_module_registry_lookup(lua_State* state, const uuid_t uuid) {
-	lua_pushlstring(state, STRING_CONST(BUILD_REGISTRY_LOADED_MODULES));
-	lua_gettable(state, LUA_REGISTRYINDEX);
+LUA_EXTERN void
+lua_instances_lock(void);
 
-	lua_pushlstring(state, STRING_CONST(LOADED_MODULES_ENTRY_ARRAY));
-	lua_gettable(state, -2);
+LUA_EXTERN void
+lua_instances_unlock(void);
+
+LUA_EXTERN size_t
+lua_jobs_run(bool (*work)(void*, size_t), void* data, size_t count, size_t threads);
 
-	lua_modulemap_entry_t** entryarr = lua_touserdata(state, -1);
+#if FOUNDATION_COMPILER_GCC
+#  pragma GCC diagnostic ignored "-Wpedantic"
+#endif
 
-	lua_pop(state, 2);
+static hash_t
+lua_module_uuid_key(const uuid_t uuid) {
+	return hash(&uuid, sizeof(uuid_t));
+}
 
-	if (entryarr) {
-		for (size_t ient = 0, esize = array_size(entryarr); ient != esize; ++ient) {
-			if (uuid_equal(entryarr[ient]->uuid, uuid))
-				return entryarr[ient];
-		}
-	}
-	return nullptr;
+static int
+lua_module_require(lua_State* state);
+
+static lua_modulemap_entry_t*
+lua_module_registry_lookup(lua_t* env, const uuid_t uuid) {
+	if (!env || !env->modules_uuid)
+		return nullptr;
+	lua_modulemap_entry_t* entry = hashmap_lookup(env->modules_uuid, lua_module_uuid_key(uuid));
+	return (entry && uuid_equal(entry->uuid, uuid)) ? entry : nullptr;
 }
 
 void
-lua_module_registry_initialize(lua_State* state) {
+lua_module_registry_initialize(lua_t* env) {
+	lua_State* state = env->state;
+
 	lua_pushlstring(state, STRING_CONST(BUILD_REGISTRY_LOADED_MODULES));
 	lua_newtable(state);
 	lua_settable(state, LUA_REGISTRYINDEX);
+
+	env->modules_uuid = hashmap_allocate(BUILD_SIZE_LUA_MODULE_BUCKETS, 4);
+	env->modules_name = hashmap_allocate(BUILD_SIZE_LUA_MODULE_BUCKETS, 4);
+
+	//Wrap require to record dependency edges, loaders only see the first require of a module
+	lua_getglobal(state, "require");
+	if (lua_isfunction(state, -1)) {
+		lua_pushcclosure(state, lua_module_require, 1);
+		lua_setglobal(state, "require");
+	}
+	else {
+		lua_pop(state, 1);
+	}
 }
 
 void
-lua_module_registry_finalize(lua_State* state) {
-	lua_pushlstring(state, STRING_CONST(BUILD_REGISTRY_LOADED_MODULES));
-	lua_gettable(state, LUA_REGISTRYINDEX);
+lua_module_registry_finalize(lua_t* env) {
+	if (env->modules_uuid)
+		hashmap_deallocate(env->modules_uuid);
+	if (env->modules_name)
+		hashmap_deallocate(env->modules_name);
+	array_deallocate(env->modules_order);
+	array_deallocate(env->modules_edges);
+	array_deallocate(env->modules_requiring);
+	env->modules_uuid = nullptr;
+	env->modules_name = nullptr;
+}
+
+void
+lua_module_set_loaded(lua_t* lua, lua_modulemap_entry_t* entry) {
+	if (!lua || !entry || !lua->modules_uuid)
+		return;
+	if (!hashmap_insert(lua->modules_uuid, lua_module_uuid_key(entry->uuid), entry))
+		array_push(lua->modules_order, entry);
+	hashmap_insert(lua->modules_name, entry->name, entry);
+}
 
-	lua_pushlstring(state, STRING_CONST(LOADED_MODULES_ENTRY_ARRAY));
-	lua_gettable(state, -2);
+static lua_modulemap_t*
+lua_modulemap_allocate(size_t capacity) {
+	lua_modulemap_t* map = memory_allocate(HASH_LUA, sizeof(lua_modulemap_t) + (sizeof(atomicptr_t) * capacity),
+	                                       0, MEMORY_PERSISTENT | MEMORY_ZERO_INITIALIZED);
+	map->capacity = capacity;
+	return map;
+}
 
-	lua_modulemap_entry_t** entryarr = lua_touserdata(state, -1);
+static lua_modulemap_entry_t*
+lua_modulemap_lookup(hash_t namehash) {
+	lua_modulemap_t* map = atomic_load_ptr(&_lua_modulemap, memory_order_acquire);
+	size_t mask = map->capacity - 1;
+	for (size_t islot = (size_t)namehash & mask;; islot = (islot + 1) & mask) {
+		lua_modulemap_entry_t* entry = atomic_load_ptr(&map->slot[islot], memory_order_acquire);
+		if (!entry || (entry->name == namehash))
+			return entry;
+	}
+}
 
-	lua_pop(state, 2);
+//Caller must hold modulemap lock
+static void
+lua_modulemap_insert(lua_modulemap_entry_t* entry) {
+	lua_modulemap_t* map = atomic_load_ptr(&_lua_modulemap, memory_order_relaxed);
+
+	//Keep load factor below one half so probe sequences stay short
+	if ((_lua_modulemap_count + 1) * 2 > map->capacity) {
+		lua_modulemap_t* grown = lua_modulemap_allocate(map->capacity * 2);
+		size_t mask = grown->capacity - 1;
+		for (size_t iold = 0; iold < map->capacity; ++iold) {
+			lua_modulemap_entry_t* moved = atomic_load_ptr(&map->slot[iold], memory_order_relaxed);
+			if (!moved)
+				continue;
+			size_t islot = (size_t)moved->name & mask;
+			while (atomic_load_ptr(&grown->slot[islot], memory_order_relaxed))
+				islot = (islot + 1) & mask;
+			atomic_store_ptr(&grown->slot[islot], moved, memory_order_relaxed);
+		}
+		atomic_store_ptr(&_lua_modulemap, grown, memory_order_release);
+		array_push(_lua_modulemap_retired, map);
+		map = grown;
+	}
 
-	if (entryarr)
-		array_deallocate(entryarr);
+	size_t mask = map->capacity - 1;
+	size_t islot = (size_t)entry->name & mask;
+	while (atomic_load_ptr(&map->slot[islot], memory_order_relaxed))
+		islot = (islot + 1) & mask;
+	atomic_store_ptr(&map->slot[islot], entry, memory_order_release);
+	++_lua_modulemap_count;
 }
 
 //This is our custom callback point from luajit lib_package loader
@@ -125,12 +219,8 @@ lj_cf_package_loader_registry(lua_State* state) {
 	size_t length = 0;
 	const char* name = luaL_checklstring(state, 1, &length);
 
-	mutex_lock(_lua_modulemap_lock);
-
 	hash_t namehash = hash(name, length);
-	lua_modulemap_entry_t* entry = hashmap_lookup(_lua_modulemap, namehash);
-
-	mutex_unlock(_lua_modulemap_lock);
+	lua_modulemap_entry_t* entry = lua_modulemap_lookup(namehash);
 
 	if (entry) {
 		lua_pushlstring(state, name, length);
@@ -143,21 +233,45 @@ lj_cf_package_loader_registry(lua_State* state) {
 	return 1;
 }
 
+void
+lua_module_release(lua_module_t* module) {
+	if (module && !atomic_decr32(&module->ref, memory_order_release)) {
+		if (module->archive)
+			lua_archive_release(module->archive);
+		else
+			lua_stream_unmap(&module->mapping);
+		memory_deallocate(module);
+	}
+}
+
 int
 lua_modulemap_initialize(void) {
-	_lua_modulemap = hashmap_allocate(13, 7);
+	atomic_store_ptr(&_lua_modulemap, lua_modulemap_allocate(BUILD_SIZE_LUA_MODULEMAP_CAPACITY),
+	                 memory_order_release);
+	_lua_modulemap_count = 0;
 	_lua_modulemap_lock = mutex_allocate(STRING_CONST("lua-modulemap"));
+	_lua_module_cache_lock = mutex_allocate(STRING_CONST("lua-module-cache"));
+	memset(&_lua_module_cache_stats, 0, sizeof(_lua_module_cache_stats));
 	return 0;
 }
 
 void
 lua_modulemap_finalize(void) {
-	for (size_t ibucket = 0; ibucket < _lua_modulemap->num_buckets; ++ibucket) {
-		hashmap_node_t* bucket = _lua_modulemap->bucket[ibucket];
-		for (size_t inode = 0, nsize = array_size(bucket); inode < nsize; ++inode)
-			memory_deallocate(bucket[inode].value);
-	}
-	hashmap_deallocate(_lua_modulemap);
+	for (size_t imod = 0, msize = array_size(_lua_module_cache); imod < msize; ++imod)
+		lua_module_release(_lua_module_cache[imod]);
+	array_deallocate(_lua_module_cache);
+	array_deallocate(_lua_module_cache_loading);
+	mutex_deallocate(_lua_module_cache_lock);
+
+	lua_modulemap_t* map = atomic_load_ptr(&_lua_modulemap, memory_order_acquire);
+	for (size_t islot = 0; islot < map->capacity; ++islot)
+		memory_deallocate(atomic_load_ptr(&map->slot[islot], memory_order_relaxed));
+	memory_deallocate(map);
+	atomic_store_ptr(&_lua_modulemap, nullptr, memory_order_release);
+
+	for (size_t imap = 0, msize = array_size(_lua_modulemap_retired); imap < msize; ++imap)
+		memory_deallocate(_lua_modulemap_retired[imap]);
+	array_deallocate(_lua_modulemap_retired);
 	mutex_deallocate(_lua_modulemap_lock);
 }
 
@@ -168,28 +282,107 @@ lua_module_register(const char* name, size_t length, const uuid_t uuid, lua_fn l
 
 	mutex_lock(_lua_modulemap_lock);
 
-	lua_modulemap_entry_t* entry = hashmap_lookup(_lua_modulemap, namehash);
+	lua_modulemap_entry_t* entry = lua_modulemap_lookup(namehash);
 	if (!entry) {
 		entry = memory_allocate(HASH_LUA, sizeof(lua_modulemap_entry_t), 0, MEMORY_PERSISTENT);
 		entry->name = namehash;
 		entry->uuid = uuid;
 		entry->loader = loader;
 		entry->preload = preload;
-		hashmap_insert(_lua_modulemap, hash(name, length), entry);
+		lua_modulemap_insert(entry);
 	}
 
 	mutex_unlock(_lua_modulemap_lock);
 }
 
-static lua_module_t
-lua_module_load_resource(const uuid_t uuid) {
+uuid_t
+lua_module_lookup(const char* name, size_t length) {
+	lua_modulemap_entry_t* entry = lua_modulemap_lookup(hash(name, length));
+	return entry ? entry->uuid : uuid_null();
+}
+
+//Decompress stored data straight from a mapped view, or through a read buffer if the stream cannot be mapped
+static bool
+lua_module_read_compressed(stream_t* stream, size_t stored, void* buffer, size_t size) {
+	lua_mapping_t mapping;
+	bool success;
+	if (lua_stream_map(stream, stored, &mapping)) {
+		success = lua_decompress(mapping.data, stored, buffer, size);
+		lua_stream_unmap(&mapping);
+	}
+	else {
+		void* compressed = memory_allocate(HASH_LUA, stored, 0, MEMORY_TEMPORARY);
+		success = (stream_read(stream, compressed, stored) == stored) &&
+		          lua_decompress(compressed, stored, buffer, size);
+		memory_deallocate(compressed);
+	}
+	return success;
+}
+
+//Read bytecode following the version word, verifying checksum if bundled. The blob is owned by
+//the module unless map is set, cached blobs outlive the file which can be rewritten in place by a
+//recompile and must not be mapped. Uncompressed local files are mapped if map is set
+static lua_module_t*
+lua_module_read_bytecode(stream_t* stream, const uuid_t uuid, uint64_t platform, bool bundled,
+                         bool compressed, bool map) {
+	size_t size = (size_t)stream_read_uint64(stream);
+	size_t stored = compressed ? (size_t)stream_read_uint64(stream) : size;
+	hash_t checksum = bundled ? stream_read_uint64(stream) : 0;
+
+	lua_mapping_t mapping;
+	bool mapped = map && !compressed && lua_stream_map(stream, size, &mapping);
+	if (!mapped)
+		memset(&mapping, 0, sizeof(mapping));
+	lua_module_t* module = memory_allocate(HASH_LUA, sizeof(lua_module_t) + (mapped ? 0 : size), 0,
+	                                       MEMORY_PERSISTENT);
+	module->uuid = uuid;
+	module->platform = platform;
+	module->version = LUA_RESOURCE_MODULE_VERSION;
+	module->size = size;
+	module->mapping = mapping;
+	module->archive = nullptr;
+	atomic_store32(&module->ref, 1, memory_order_relaxed);
+	if (mapped) {
+		module->bytecode = mapping.data;
+	}
+	else {
+		void* buffer = pointer_offset(module, sizeof(lua_module_t));
+		module->bytecode = buffer;
+		bool read = compressed ? lua_module_read_compressed(stream, stored, buffer, size) :
+		            (stream_read(stream, buffer, size) == size);
+		if (!size || !stored || !read) {
+			memory_deallocate(module);
+			log_warn(HASH_LUA, WARNING_SYSTEM_CALL_FAIL, STRING_CONST("Unable to read module data"));
+			return nullptr;
+		}
+	}
+
+	if (bundled && (hash(module->bytecode, size) != checksum)) {
+		log_warn(HASH_LUA, WARNING_INVALID_VALUE, STRING_CONST("Module data checksum mismatch"));
+		lua_module_release(module);
+		return nullptr;
+	}
+
+	return module;
+}
+
+lua_module_t*
+lua_module_load_resource(const uuid_t uuid, uint64_t platform, bool map, unsigned int* opened) {
 	const uint32_t expected_version = LUA_RESOURCE_MODULE_VERSION;
-	lua_module_t module = {0, 0};
-	uint64_t platform = 0;
+	lua_module_t* module = nullptr;
 	stream_t* stream;
 	bool success = false;
 	bool recompile = false;
 	bool recompiled = false;
+	unsigned int opens = 0;
+
+	//Mounted archives take precedence over individual resource streams
+	module = lua_archive_load(uuid, platform);
+	if (module) {
+		if (opened)
+			*opened = 0;
+		return module;
+	}
 
 	error_context_declare_local(
 	    char uuidbuf[40];
@@ -197,14 +390,21 @@ lua_module_load_resource(const uuid_t uuid) {
 	);
 	error_context_push(STRING_CONST("loading module"), STRING_ARGS(uuidstr));
 
-	platform = lua_resource_platform();
-
 retry:
 
+	++opens;
 	stream = resource_stream_open_static(uuid, platform);
 	if (stream) {
 		resource_header_t header = resource_stream_read_header(stream);
-		if ((header.type == HASH_LUA) && (header.version == expected_version)) {
+		if ((header.type == HASH_LUA) && (header.version == LUA_RESOURCE_BUNDLE_VERSION)) {
+			//Bytecode follows the header, no dynamic stream
+			uint32_t version = stream_read_uint32(stream);
+			if ((version & ~LUA_RESOURCE_MODULE_COMPRESSED) == expected_version)
+				module = lua_module_read_bytecode(stream, uuid, platform, true,
+				                                  (version & LUA_RESOURCE_MODULE_COMPRESSED) != 0, map);
+			recompile = !module;
+		}
+		else if ((header.type == HASH_LUA) && (header.version == expected_version)) {
 			success = true;
 		}
 		else {
@@ -216,21 +416,16 @@ retry:
 		stream_deallocate(stream);
 		stream = nullptr;
 	}
-	if (success)
+	if (success) {
+		success = false;
+		++opens;
 		stream = resource_stream_open_dynamic(uuid, platform);
+	}
 	if (stream) {
 		uint32_t version = stream_read_uint32(stream);
-		size_t size = (size_t)stream_read_uint64(stream);
-		if (version == expected_version) {
-			void* buffer = memory_allocate(HASH_LUA, size, 0, MEMORY_TEMPORARY);
-			if (stream_read(stream, buffer, size) == size) {
-				module.bytecode = buffer;
-				module.size = size;
-			}
-			else {
-				memory_deallocate(buffer);
-				log_warn(HASH_LUA, WARNING_SYSTEM_CALL_FAIL, STRING_CONST("Unable to read module data"));
-			}
+		if ((version & ~LUA_RESOURCE_MODULE_COMPRESSED) == expected_version) {
+			module = lua_module_read_bytecode(stream, uuid, platform, false,
+			                                  (version & LUA_RESOURCE_MODULE_COMPRESSED) != 0, map);
 		}
 		else {
 			log_warnf(HASH_LUA, WARNING_INVALID_VALUE,
@@ -244,15 +439,262 @@ retry:
 
 	if (recompile && !recompiled) {
 		recompiled = resource_compile(uuid, platform);
-		if (recompiled)
+		if (recompiled) {
+			recompile = false;
 			goto retry;
+		}
 	}
 
 	error_context_pop();
 
+	if (opened)
+		*opened = opens;
+
+	return module;
+}
+
+bool
+lua_module_write_bundle(stream_t* stream, const uint256_t source_hash, const void* bytecode, size_t size) {
+	resource_header_t header = {
+		.type = HASH_LUA,
+		.version = LUA_RESOURCE_BUNDLE_VERSION,
+		.source_hash = source_hash
+	};
+	resource_stream_write_header(stream, header);
+	return lua_module_write_bytecode(stream, bytecode, size, true, lua_module_config().compress_resources);
+}
+
+bool
+lua_module_write_bytecode(stream_t* stream, const void* bytecode, size_t size, bool bundled, bool compress) {
+	void* compressed = nullptr;
+	size_t stored = 0;
+
+	//Compressed data is only kept if it saves bytes
+	if (compress) {
+		size_t capacity = lua_compress_bound(size);
+		compressed = memory_allocate(HASH_LUA, capacity, 0, MEMORY_TEMPORARY);
+		stored = lua_compress(bytecode, size, compressed, capacity);
+		if (!stored || (stored >= size)) {
+			memory_deallocate(compressed);
+			compressed = nullptr;
+		}
+	}
+
+	stream_write_uint32(stream, LUA_RESOURCE_MODULE_VERSION | (compressed ? LUA_RESOURCE_MODULE_COMPRESSED : 0));
+	stream_write_uint64(stream, size);
+	if (compressed)
+		stream_write_uint64(stream, stored);
+	if (bundled)
+		stream_write_uint64(stream, hash(bytecode, size));
+
+	bool success;
+	if (compressed) {
+		success = (stream_write(stream, compressed, stored) == stored);
+		memory_deallocate(compressed);
+	}
+	else {
+		success = (stream_write(stream, bytecode, size) == size);
+	}
+	return success;
+}
+
+static lua_module_t*
+lua_module_cache_find(const uuid_t uuid, uint64_t platform, uint32_t version) {
+	for (size_t imod = 0, msize = array_size(_lua_module_cache); imod < msize; ++imod) {
+		lua_module_t* module = _lua_module_cache[imod];
+		if (uuid_equal(module->uuid, uuid) && (module->platform == platform) &&
+		        (module->version == version))
+			return module;
+	}
+	return nullptr;
+}
+
+//Get a reference to the shared bytecode blob for the module, loading it on cache miss
+static lua_module_t*
+lua_module_acquire(const uuid_t uuid) {
+	const uint32_t version = LUA_RESOURCE_MODULE_VERSION;
+	uint64_t platform = lua_resource_platform();
+	lua_module_loading_t loading;
+	lua_module_t* module;
+	lua_module_t* loaded;
+
+	loading.uuid = uuid;
+
+retry:
+
+	loading.invalidated = false;
+	mutex_lock(_lua_module_cache_lock);
+	module = lua_module_cache_find(uuid, platform, version);
+	if (module) {
+		atomic_incr32(&module->ref, memory_order_relaxed);
+		++_lua_module_cache_stats.hits;
+		_lua_module_cache_stats.bytes_saved += module->size;
+	}
+	else {
+		array_push(_lua_module_cache_loading, &loading);
+	}
+	mutex_unlock(_lua_module_cache_lock);
+	if (module)
+		return module;
+
+	//Load outside of lock, other states may load other modules concurrently
+	unsigned int opened = 0;
+	loaded = lua_module_load_resource(uuid, platform, false, &opened);
+
+	mutex_lock(_lua_module_cache_lock);
+	for (size_t iload = 0, lsize = array_size(_lua_module_cache_loading); iload < lsize; ++iload) {
+		if (_lua_module_cache_loading[iload] == &loading) {
+			array_erase(_lua_module_cache_loading, iload);
+			break;
+		}
+	}
+	++_lua_module_cache_stats.misses;
+	_lua_module_cache_stats.opens += opened;
+	if (loaded && loaded->archive)
+		++_lua_module_cache_stats.archived;
+	if (loaded && loading.invalidated) {
+		//Module was invalidated while loading, the blob may predate the change
+		mutex_unlock(_lua_module_cache_lock);
+		lua_module_release(loaded);
+		goto retry;
+	}
+	if (loaded) {
+		module = lua_module_cache_find(uuid, platform, version);
+		if (!module) {
+			module = loaded;
+			loaded = nullptr;
+			array_push(_lua_module_cache, module);
+			++_lua_module_cache_stats.count;
+			_lua_module_cache_stats.bytes += module->size;
+		}
+		atomic_incr32(&module->ref, memory_order_relaxed);
+	}
+	mutex_unlock(_lua_module_cache_lock);
+
+	//Lost a race with a concurrent load of the same module
+	lua_module_release(loaded);
+
 	return module;
 }
 
+void
+lua_module_cache_invalidate(const uuid_t uuid) {
+	mutex_lock(_lua_module_cache_lock);
+	for (size_t iload = 0, lsize = array_size(_lua_module_cache_loading); iload < lsize; ++iload) {
+		if (uuid_equal(_lua_module_cache_loading[iload]->uuid, uuid))
+			_lua_module_cache_loading[iload]->invalidated = true;
+	}
+	for (size_t imod = 0; imod < array_size(_lua_module_cache);) {
+		lua_module_t* module = _lua_module_cache[imod];
+		if (uuid_equal(module->uuid, uuid)) {
+			--_lua_module_cache_stats.count;
+			_lua_module_cache_stats.bytes -= module->size;
+			array_erase(_lua_module_cache, imod);
+			lua_module_release(module);
+		}
+		else {
+			++imod;
+		}
+	}
+	mutex_unlock(_lua_module_cache_lock);
+}
+
+lua_module_cache_statistics_t
+lua_module_cache_statistics(void) {
+	mutex_lock(_lua_module_cache_lock);
+	lua_module_cache_statistics_t stats = _lua_module_cache_stats;
+	mutex_unlock(_lua_module_cache_lock);
+	return stats;
+}
+
+//Loading puts bytecode in the shared cache, later requires pick it up from there
+static bool
+lua_module_prefetch_job(void* data, size_t index) {
+	lua_module_t* module = lua_module_acquire(((const uuid_t*)data)[index]);
+	if (!module)
+		return false;
+	lua_module_release(module);
+	return true;
+}
+
+size_t
+lua_module_prefetch(const uuid_t* uuids, size_t count) {
+	return lua_jobs_run(lua_module_prefetch_job, (void*)uuids, count, BUILD_LUA_PREFETCH_THREADS);
+}
+
+static bool
+lua_module_uuid_in(const uuid_t* uuids, const uuid_t uuid) {
+	for (size_t iuuid = 0, usize = array_size(uuids); iuuid < usize; ++iuuid) {
+		if (uuid_equal(uuids[iuuid], uuid))
+			return true;
+	}
+	return false;
+}
+
+size_t
+lua_module_prefetch_manifest(stream_t* stream, const uuid_t uuid) {
+	uuid_t* edges = nullptr; //Pairs of module and dependency
+	uuid_t* modules = nullptr;
+
+	while (!stream_eos(stream)) {
+		string_t linestr = stream_read_line(stream, '\n');
+		string_const_t line = string_strip(STRING_ARGS(linestr), STRING_CONST(" \t\r"));
+		uuid_t module = uuid_null();
+		size_t offset = 0;
+		while (line.length && (line.str[0] != '#') && (offset < line.length)) {
+			size_t end = string_find_first_of(STRING_ARGS(line), STRING_CONST(" \t"), offset);
+			if (end == STRING_NPOS)
+				end = line.length;
+			if (end > offset) {
+				uuid_t token = string_to_uuid(line.str + offset, end - offset);
+				if (uuid_is_null(token)) {
+					log_warnf(HASH_LUA, WARNING_INVALID_VALUE, STRING_CONST("Invalid uuid in module manifest: %.*s"),
+					          (int)(end - offset), line.str + offset);
+				}
+				else if (uuid_is_null(module)) {
+					module = token;
+					if (!lua_module_uuid_in(modules, module))
+						array_push(modules, module);
+				}
+				else {
+					array_push(edges, module);
+					array_push(edges, token);
+				}
+			}
+			offset = end + 1;
+		}
+		string_deallocate(linestr.str);
+	}
+
+	//Collect the module and its transitive dependencies, or every listed module if no root given
+	uuid_t* fetch = nullptr;
+	if (uuid_is_null(uuid)) {
+		for (size_t imod = 0, msize = array_size(modules); imod < msize; ++imod)
+			array_push(fetch, modules[imod]);
+		for (size_t iedge = 1, esize = array_size(edges); iedge < esize; iedge += 2) {
+			if (!lua_module_uuid_in(fetch, edges[iedge]))
+				array_push(fetch, edges[iedge]);
+		}
+	}
+	else {
+		array_push(fetch, uuid);
+		for (size_t ifetch = 0; ifetch < array_size(fetch); ++ifetch) {
+			for (size_t iedge = 0, esize = array_size(edges); iedge < esize; iedge += 2) {
+				if (uuid_equal(edges[iedge], fetch[ifetch]) && !lua_module_uuid_in(fetch, edges[iedge + 1]))
+					array_push(fetch, edges[iedge + 1]);
+			}
+		}
+	}
+
+	size_t fetched = lua_module_prefetch(fetch, array_size(fetch));
+
+	array_deallocate(fetch);
+	array_deallocate(modules);
+	array_deallocate(edges);
+
+	return fetched;
+}
+
 /* Module garbage collection not enabled
 static int
 lua_module_gc(lua_State* state) {
@@ -293,24 +735,500 @@ lua_module_upload(lua_State* state, const void* bytecode, size_t size) {
 	return 0;
 }
 
-int
-lua_module_loader(lua_State* state) {
-	lua_modulemap_entry_t* entry = lua_touserdata(state, lua_upvalueindex(2));
-	if (!entry)
-		return 0;
+//Upload module bytecode with requires made by the chunk recorded as edges from the module
+static int
+lua_module_execute(lua_State* state, const uuid_t uuid, lua_module_t* module) {
+	lua_t* env = lua_from_state(state);
+	size_t depth = env ? array_size(env->modules_requiring) : 0;
+	if (env)
+		array_push(env->modules_requiring, uuid);
+	int ret = lua_module_upload(state, module->bytecode, module->size);
+	if (env)
+		array_resize(env->modules_requiring, depth);
+	return ret;
+}
 
-	size_t name_length = 0;
-	const char* name = luaL_checklstring(state, lua_upvalueindex(1), &name_length);
+typedef struct {
+	char*   bytecode;
+	size_t  bytecode_size;
+	size_t  capacity;
+} lua_module_dump_t;
+
+static FOUNDATION_NOINLINE int
+lua_module_dump_writer(lua_State* state, const void* buffer, size_t size, void* user_data) {
+	lua_module_dump_t* dump = user_data;
+
+	FOUNDATION_UNUSED(state);
+
+	if (dump->bytecode_size + size > dump->capacity) {
+		size_t capacity = (dump->capacity * 2) + size;
+		dump->bytecode = (dump->bytecode ?
+		                  memory_reallocate(dump->bytecode, capacity, 0, dump->bytecode_size, 0) :
+		                  memory_allocate(HASH_LUA, capacity, 0, MEMORY_PERSISTENT));
+		dump->capacity = capacity;
+	}
+
+	memcpy(dump->bytecode + dump->bytecode_size, buffer, size);
+	dump->bytecode_size += size;
+
+	return 0;
+}
+
+//Push hash of stripped bytecode of the Lua function at index as a string, nil if not a Lua function
+static void
+lua_module_push_function_hash(lua_State* state, int index, lua_module_dump_t* dump) {
+	dump->bytecode_size = 0;
+	lua_pushvalue(state, index);
+	bool dumped = !lua_iscfunction(state, -1) && !lua_dumpx(state, lua_module_dump_writer, dump, 1);
+	lua_pop(state, 1);
+	if (dumped) {
+		hash_t code = hash(dump->bytecode, dump->bytecode_size);
+		lua_pushlstring(state, (const char*)&code, sizeof(code));
+	}
+	else {
+		lua_pushnil(state);
+	}
+}
+
+#define LUA_MODULE_DIGEST_DEPTH 8
+
+/* Digest of the value at index as constructed by the module chunk. Table entries are combined
+   independent of traversal order, nested tables are followed to a fixed depth */
+static hash_t
+lua_module_value_digest(lua_State* state, int index, lua_module_dump_t* dump, int depth) {
+	int type = lua_type(state, index);
+	hash_t digest = 0;
+	if (index < 0)
+		index = lua_gettop(state) + index + 1;
+	switch (type) {
+	case LUA_TBOOLEAN:
+		digest = (hash_t)lua_toboolean(state, index);
+		break;
+
+	case LUA_TNUMBER: {
+		lua_Number number = lua_tonumber(state, index);
+		digest = hash(&number, sizeof(number));
+		break;
+	}
+
+	case LUA_TSTRING: {
+		size_t length = 0;
+		const char* str = lua_tolstring(state, index, &length);
+		digest = hash(str, length);
+		break;
+	}
+
+	case LUA_TFUNCTION:
+		lua_module_push_function_hash(state, index, dump);
+		if (lua_isstring(state, -1))
+			memcpy(&digest, lua_tostring(state, -1), sizeof(digest));
+		else
+			digest = (hash_t)(uintptr_t)lua_topointer(state, index);
+		lua_pop(state, 1);
+		break;
+
+	case LUA_TTABLE:
+		if (depth <= 0)
+			break;
+		lua_pushnil(state);
+		while (lua_next(state, index) != 0) {
+			hash_t key = lua_module_value_digest(state, -2, dump, depth - 1);
+			hash_t value = lua_module_value_digest(state, -1, dump, depth - 1);
+			digest += (key * 0x9E3779B97F4A7C15ULL) ^ value;
+			lua_pop(state, 1);
+		}
+		break;
+
+	default:
+		break;
+	}
+	return digest ^ ((hash_t)type * 0xC2B2AE3D27D4EB4FULL);
+}
+
+static void
+lua_module_push_digest(lua_State* state, int index, lua_module_dump_t* dump) {
+	hash_t digest = lua_module_value_digest(state, index, dump, LUA_MODULE_DIGEST_DEPTH);
+	lua_pushlstring(state, (const char*)&digest, sizeof(digest));
+}
+
+/* Push snapshot of the fields a module chunk returned: functions map to bytecode hashes in the
+   first subtable, other values are kept as is in the second subtable, and tables map to a digest
+   of their constructed content in the third subtable */
+static void
+lua_module_push_snapshot(lua_State* state, int table, lua_module_dump_t* dump) {
+	lua_createtable(state, 3, 0);
+	lua_newtable(state);
+	lua_newtable(state);
+	lua_newtable(state);
+	int snapshot = lua_gettop(state) - 3;
+	int code = snapshot + 1;
+	int data = snapshot + 2;
+	int shape = snapshot + 3;
+
+	lua_pushnil(state);
+	while (lua_next(state, table) != 0) {
+		lua_pushvalue(state, -2); //Copy key
+		if (lua_isfunction(state, -2)) {
+			lua_module_push_function_hash(state, -2, dump);
+			lua_rawset(state, code);
+		}
+		else {
+			if (lua_istable(state, -2)) {
+				lua_pushvalue(state, -1);
+				lua_module_push_digest(state, -3, dump);
+				lua_rawset(state, shape);
+			}
+			lua_pushvalue(state, -2); //Copy value
+			lua_rawset(state, data);
+		}
+		lua_pop(state, 1); //Pop value, leaving key for lua_next iteration
+	}
+
+	lua_rawseti(state, snapshot, 3);
+	lua_rawseti(state, snapshot, 2);
+	lua_rawseti(state, snapshot, 1);
+}
+
+//Store snapshot of module table at index as the source state of the module
+static void
+lua_module_store_snapshot(lua_State* state, lua_modulemap_entry_t* entry, int table) {
+	lua_module_dump_t dump = {0, 0, 0};
+
+	lua_pushlstring(state, STRING_CONST(BUILD_REGISTRY_LOADED_SOURCE));
+	lua_rawget(state, LUA_REGISTRYINDEX);
+	if (!lua_istable(state, -1)) {
+		lua_pop(state, 1);
+		lua_newtable(state);
+		lua_pushlstring(state, STRING_CONST(BUILD_REGISTRY_LOADED_SOURCE));
+		lua_pushvalue(state, -2);
+		lua_rawset(state, LUA_REGISTRYINDEX);
+	}
+	lua_pushlightuserdata(state, entry);
+	lua_module_push_snapshot(state, table, &dump);
+	lua_rawset(state, -3);
+	lua_pop(state, 1);
+
+	memory_deallocate(dump.bytecode);
+}
+
+static const char*
+lua_module_key_name(lua_State* state, int key) {
+	return (lua_type(state, key) == LUA_TSTRING) ? lua_tostring(state, key) : "?";
+}
+
+/* Map the upvalue names of the Lua functions in a table to the upvalue as a {function, index}
+   pair. A module chunk local is one upvalue shared by every function capturing it, a name
+   captured through distinct upvalues is a local of some inner scope and maps to false */
+static void
+lua_module_map_upvalues(lua_State* state, int table, int names) {
+	lua_pushnil(state);
+	while (lua_next(state, table) != 0) {
+		int function = lua_gettop(state);
+		const char* name;
+		for (int iup = 1; lua_isfunction(state, function) && !lua_iscfunction(state, function) &&
+		        ((name = lua_getupvalue(state, function, iup)) != nullptr); ++iup) {
+			lua_pop(state, 1);
+			//Stripped bytecode has no upvalue names
+			if (!*name)
+				break;
+			lua_pushstring(state, name);
+			lua_pushvalue(state, -1);
+			lua_rawget(state, names);
+			if (lua_isnil(state, -1)) {
+				lua_pop(state, 1);
+				lua_createtable(state, 2, 0);
+				lua_pushvalue(state, function);
+				lua_rawseti(state, -2, 1);
+				lua_pushinteger(state, iup);
+				lua_rawseti(state, -2, 2);
+				lua_rawset(state, names);
+			}
+			else if (lua_istable(state, -1)) {
+				lua_rawgeti(state, -1, 1);
+				lua_rawgeti(state, -2, 2);
+				bool shared = (lua_upvalueid(state, -2, (int)lua_tointeger(state, -1)) ==
+				               lua_upvalueid(state, function, iup));
+				lua_pop(state, 3);
+				if (!shared) {
+					lua_pushboolean(state, 0);
+					lua_rawset(state, names);
+				}
+				else {
+					lua_pop(state, 1);
+				}
+			}
+			else {
+				lua_pop(state, 2);
+			}
+		}
+		lua_pop(state, 1);
+	}
+}
+
+//Point upvalues holding the fresh module table at the live table, as for `local M = {} ... return M`
+static void
+lua_module_redirect_upvalues(lua_State* state, int function, int newtable, int oldtable) {
+	for (int iup = 1; lua_getupvalue(state, function, iup) != nullptr; ++iup) {
+		if (lua_rawequal(state, -1, newtable)) {
+			lua_pushvalue(state, oldtable);
+			lua_setupvalue(state, function, iup);
+		}
+		lua_pop(state, 1);
+	}
+}
+
+/* Join the upvalues of a patched function with the live module locals, so state stays shared with
+   the functions kept from the previous load. An upvalue shared with a kept function is joined
+   through it since unchanged bytecode has the same upvalue layout. Others are joined by name if
+   the name is a module chunk local in both the fresh and the live functions */
+static void
+lua_module_join_upvalues(lua_State* state, int function, int newtable, int kept, int fresh, int names) {
+	const char* name;
+	for (int iup = 1; (name = lua_getupvalue(state, function, iup)) != nullptr; ++iup) {
+		lua_pop(state, 1);
+		void* id = lua_upvalueid(state, function, iup);
+		bool joined = false;
+
+		lua_pushnil(state);
+		while (lua_next(state, kept) != 0) {
+			int old = lua_gettop(state);
+			lua_pushvalue(state, old - 1);
+			lua_rawget(state, newtable);
+			int counterpart = old + 1;
+			for (int ishared = 1; !joined && lua_isfunction(state, old) &&
+			        lua_getupvalue(state, counterpart, ishared); ++ishared) {
+				lua_pop(state, 1);
+				if (lua_upvalueid(state, counterpart, ishared) == id) {
+					lua_upvaluejoin(state, function, iup, old, ishared);
+					joined = true;
+				}
+			}
+			lua_pop(state, 2);
+			if (joined) {
+				lua_pop(state, 1);
+				break;
+			}
+		}
+
+		if (joined || !*name)
+			continue;
+		lua_pushstring(state, name);
+		lua_rawget(state, fresh);
+		bool local = lua_istable(state, -1);
+		lua_pop(state, 1);
+		if (!local)
+			continue;
+		lua_pushstring(state, name);
+		lua_rawget(state, names);
+		if (lua_istable(state, -1)) {
+			int live = lua_gettop(state);
+			lua_rawgeti(state, live, 1);
+			lua_rawgeti(state, live, 2);
+			lua_upvaluejoin(state, function, iup, live + 1, (int)lua_tointeger(state, live + 2));
+			lua_pop(state, 2);
+		}
+		lua_pop(state, 1);
+	}
+}
+
+/* Patch the live module table with the fields of a freshly loaded module table. Functions whose
+   bytecode is unchanged since the previous load keep their closure (and upvalues) unless rebind
+   is set, patched functions share the upvalues of the live module locals. Data fields unchanged in
+   source keep their current value, tables are kept unless their constructed content changed in
+   source, and fields no longer in source are removed. Fields added at runtime and never part of
+   the source are left alone. */
+static void
+lua_module_patch(lua_State* state, lua_modulemap_entry_t* entry, int oldtable, int newtable,
+                 string_const_t name, bool rebind) {
+	lua_module_dump_t dump = {0, 0, 0};
+	unsigned int patched = 0, unchanged = 0, added = 0, changed = 0, preserved = 0, removed = 0;
+	int top = lua_gettop(state);
+
+	//Previous source snapshot, nil if none
+	lua_pushlstring(state, STRING_CONST(BUILD_REGISTRY_LOADED_SOURCE));
+	lua_rawget(state, LUA_REGISTRYINDEX);
+	if (lua_istable(state, -1)) {
+		lua_pushlightuserdata(state, entry);
+		lua_rawget(state, -2);
+		lua_replace(state, -2);
+	}
+	bool has_snapshot = lua_istable(state, -1);
+	if (has_snapshot) {
+		lua_rawgeti(state, top + 1, 1);
+		lua_rawgeti(state, top + 1, 2);
+		lua_rawgeti(state, top + 1, 3);
+	}
+	else {
+		lua_pushnil(state);
+		lua_pushnil(state);
+		lua_pushnil(state);
+	}
+	int code = top + 2;
+	int data = top + 3;
+	int shape = top + 4;
+
+	//Functions unchanged in source, mapped to the live closure (true if no longer a Lua function)
+	lua_newtable(state);
+	int kept = top + 5;
+	//Upvalue names of the live and fresh functions, for joining upvalues by name
+	lua_newtable(state);
+	int names = top + 6;
+	lua_newtable(state);
+	int fresh = top + 7;
+	if (has_snapshot && !rebind) {
+		lua_pushnil(state);
+		while (lua_next(state, newtable) != 0) {
+			if (lua_isfunction(state, -1)) {
+				lua_module_push_function_hash(state, -1, &dump);
+				lua_pushvalue(state, -3);
+				lua_rawget(state, code);
+				bool same = !lua_isnil(state, -1) && lua_rawequal(state, -1, -2);
+				lua_pop(state, 2);
+				if (same) {
+					lua_pushvalue(state, -2);
+					lua_pushvalue(state, -1);
+					lua_rawget(state, oldtable);
+					if (!lua_isfunction(state, -1) || lua_iscfunction(state, -1)) {
+						lua_pop(state, 1);
+						lua_pushboolean(state, 1);
+					}
+					lua_rawset(state, kept);
+				}
+			}
+			lua_pop(state, 1);
+		}
+
+		lua_module_map_upvalues(state, oldtable, names);
+		lua_module_map_upvalues(state, newtable, fresh);
+	}
+
+	lua_pushnil(state);
+	while (lua_next(state, newtable) != 0) {
+		int key = lua_gettop(state) - 1;
+		int value = key + 1;
+		bool assign = true;
+		if (lua_isfunction(state, value)) {
+			lua_pushvalue(state, key);
+			lua_rawget(state, kept);
+			assign = lua_isnil(state, -1);
+			lua_pop(state, 1);
+			if (!assign) {
+				++unchanged;
+			}
+			else {
+				lua_pushvalue(state, key);
+				lua_rawget(state, oldtable);
+				if (lua_isnil(state, -1))
+					++added;
+				else
+					++patched;
+				lua_pop(state, 1);
+				if (!lua_iscfunction(state, value)) {
+					lua_module_redirect_upvalues(state, value, newtable, oldtable);
+					if (has_snapshot && !rebind)
+						lua_module_join_upvalues(state, value, newtable, kept, fresh, names);
+				}
+				log_debugf(HASH_LUA, STRING_CONST("Patched function %.*s.%s"), STRING_FORMAT(name),
+				           lua_module_key_name(state, key));
+			}
+		}
+		else {
+			lua_pushvalue(state, key);
+			lua_rawget(state, oldtable);
+			bool exists = !lua_isnil(state, -1);
+			lua_pop(state, 1);
+			if (has_snapshot && exists) {
+				lua_pushvalue(state, key);
+				if (lua_istable(state, value)) {
+					//Tables are rebuilt on every load and hold runtime state, keep them unless
+					//their constructor changed in source
+					lua_rawget(state, shape);
+					lua_module_push_digest(state, value, &dump);
+					assign = !lua_rawequal(state, -1, -2);
+					lua_pop(state, 2);
+				}
+				else {
+					lua_rawget(state, data);
+					assign = !lua_rawequal(state, -1, value);
+					lua_pop(state, 1);
+				}
+			}
+			if (!assign)
+				++preserved;
+			else if (exists)
+				++changed;
+			else
+				++added;
+		}
+		if (assign) {
+			lua_pushvalue(state, key);
+			lua_pushvalue(state, value);
+			lua_rawset(state, oldtable);
+		}
+		lua_pop(state, 1); //Pop value, leaving key for lua_next iteration
+	}
+
+	//Remove fields dropped from source, collect first since clearing during traversal is unsafe
+	if (has_snapshot) {
+		lua_newtable(state);
+		int dropped = lua_gettop(state);
+		for (int source = code; source <= data; ++source) {
+			lua_pushnil(state);
+			while (lua_next(state, source) != 0) {
+				lua_pop(state, 1);
+				lua_pushvalue(state, -1);
+				lua_rawget(state, newtable);
+				if (lua_isnil(state, -1)) {
+					lua_pushvalue(state, -2);
+					lua_rawseti(state, dropped, (int)lua_objlen(state, dropped) + 1);
+				}
+				lua_pop(state, 1);
+			}
+		}
+		for (int idrop = 1, dsize = (int)lua_objlen(state, dropped); idrop <= dsize; ++idrop) {
+			lua_rawgeti(state, dropped, idrop);
+			log_debugf(HASH_LUA, STRING_CONST("Removed field %.*s.%s"), STRING_FORMAT(name),
+			           lua_module_key_name(state, -1));
+			lua_pushnil(state);
+			lua_rawset(state, oldtable);
+			++removed;
+		}
+	}
+
+	lua_settop(state, top);
+
+	lua_module_store_snapshot(state, entry, newtable);
+	memory_deallocate(dump.bytecode);
+
+	log_infof(HASH_LUA, STRING_CONST("Reloaded module %.*s: %u functions patched, %u unchanged, %u fields changed, "
+	                                 "%u preserved, %u added, %u removed"),
+	          STRING_FORMAT(name), patched, unchanged, changed, preserved, added, removed);
+}
+
+static void
+lua_module_registry_set_table(lua_State* state, lua_modulemap_entry_t* entry, int table) {
+	lua_pushlstring(state, STRING_CONST(BUILD_REGISTRY_LOADED_MODULES));
+	lua_gettable(state, LUA_REGISTRYINDEX);
+
+	lua_pushlightuserdata(state, entry); //entry is key
+	lua_pushvalue(state, table); //copy the loaded module table as value
+	lua_settable(state, -3); //set table loaded-modules[entry] = moduletable
 
+	lua_pop(state, 1);
+}
+
+static int
+lua_module_load_entry(lua_State* state, lua_modulemap_entry_t* entry, const char* name,
+                      size_t name_length) {
 	int stacksize = lua_gettop(state);
 
 	if (entry->preload)
 		entry->preload();
 
-	lua_module_t module = lua_module_load_resource(entry->uuid);
-	if (module.size) {
-		if (lua_module_upload(state, module.bytecode, module.size) == 0) {
-			lua_module_registry_add(state, entry);
+	lua_module_t* module = lua_module_acquire(entry->uuid);
+	if (module) {
+		if (lua_module_execute(state, entry->uuid, module) == 0) {
+			lua_module_set_loaded(lua_from_state(state), entry);
 			if (lua_istable(state, -1)) {
 				/* Modules are never garbage collected anyway, since lib_package keeps a global
 				   registry reference in _LOADED table, and we keep a reference in loaded-modules
@@ -325,22 +1243,16 @@ lua_module_loader(lua_State* state) {
 				lua_setmetatable(state, -2); //Set metatable on proxy
 				lua_rawset(state, -3); //Set proxy in table index __gcproxy */
 
-				lua_pushlstring(state, STRING_CONST(BUILD_REGISTRY_LOADED_MODULES));
-				lua_gettable(state, LUA_REGISTRYINDEX);
-
-				lua_pushlightuserdata(state, entry); //entry is key
-				lua_pushvalue(state, -3); //copy the loaded module table as value
+				lua_module_store_snapshot(state, entry, lua_gettop(state));
 
 				lua_pushlstring(state, STRING_CONST("__modulename"));
 				lua_pushlstring(state, name, name_length);
 				lua_settable(state, -3); //set moduletable["__modulename"] = name
 
-				lua_settable(state, -3); //set table loaded-modules[entry] = moduletable
-
-				lua_pop(state, 1);
+				lua_module_registry_set_table(state, entry, lua_gettop(state));
 			}
 		}
-		memory_deallocate(module.bytecode);
+		lua_module_release(module);
 	}
 	else {
 		string_const_t uuidstr = string_from_uuid_static(entry->uuid);
@@ -351,68 +1263,277 @@ lua_module_loader(lua_State* state) {
 	return lua_gettop(state) - stacksize;
 }
 
+//Load the module behind a lazy proxy table (first argument) and turn the proxy into the module table
+static void
+lua_module_lazy_materialize(lua_State* state) {
+	lua_modulemap_entry_t* entry = lua_touserdata(state, lua_upvalueindex(2));
+	size_t name_length = 0;
+	const char* name = luaL_checklstring(state, lua_upvalueindex(1), &name_length);
+	luaL_checktype(state, 1, LUA_TTABLE);
+
+	tick_t start = time_current();
+	int top = lua_gettop(state);
+
+	//Drop proxy metatable first so accesses during module load do not recurse
+	lua_pushnil(state);
+	lua_setmetatable(state, 1);
+
+	if (!lua_module_load_entry(state, entry, name, name_length) || !lua_istable(state, -1)) {
+		lua_settop(state, top);
+		lua_pushfstring(state, "lazy module '%s' did not load as a table", name);
+		lua_error(state);
+	}
+
+	int module = lua_gettop(state);
+	lua_pushnil(state);
+	while (lua_next(state, module) != 0) {
+		lua_pushvalue(state, -2); //Copy key
+		lua_insert(state, -2); //Move key below value
+		lua_rawset(state, 1); //Set in proxy, leaving key for lua_next iteration
+	}
+	if (lua_getmetatable(state, module))
+		lua_setmetatable(state, 1);
+
+	//Proxy is now the module table, make reload update it
+	lua_module_registry_set_table(state, entry, 1);
+
+	lua_settop(state, top);
+
+	log_debugf(HASH_LUA, STRING_CONST("Lazy module loaded on first access: %.*s (%.3fms)"),
+	           (int)name_length, name, time_ticks_to_seconds(time_diff(start, time_current())) * 1000.0);
+}
+
+static int
+lua_module_lazy_index(lua_State* state) {
+	lua_module_lazy_materialize(state);
+	lua_settop(state, 2);
+	lua_gettable(state, 1);
+	return 1;
+}
+
+static int
+lua_module_lazy_newindex(lua_State* state) {
+	lua_module_lazy_materialize(state);
+	lua_settop(state, 3);
+	lua_settable(state, 1);
+	return 0;
+}
+
+int
+lua_module_loader(lua_State* state) {
+	lua_modulemap_entry_t* entry = lua_touserdata(state, lua_upvalueindex(2));
+	if (!entry)
+		return 0;
+
+	size_t name_length = 0;
+	const char* name = luaL_checklstring(state, lua_upvalueindex(1), &name_length);
+
+	lua_t* env = lua_from_state(state);
+	if (env && env->modules_lazy) {
+		lua_newtable(state); //Proxy table returned to require
+		lua_createtable(state, 0, 2); //Metatable loading the module on first access
+
+		lua_pushlstring(state, STRING_CONST("__index"));
+		lua_pushvalue(state, lua_upvalueindex(1));
+		lua_pushlightuserdata(state, entry);
+		lua_pushcclosure(state, lua_module_lazy_index, 2);
+		lua_rawset(state, -3);
+
+		lua_pushlstring(state, STRING_CONST("__newindex"));
+		lua_pushvalue(state, lua_upvalueindex(1));
+		lua_pushlightuserdata(state, entry);
+		lua_pushcclosure(state, lua_module_lazy_newindex, 2);
+		lua_rawset(state, -3);
+
+		lua_setmetatable(state, -2);
+		return 1;
+	}
+
+	return lua_module_load_entry(state, entry, name, name_length);
+}
+
+void
+lua_module_set_lazy(lua_t* lua, bool lazy) {
+	if (lua)
+		lua->modules_lazy = lazy;
+}
+
 bool
 lua_module_is_loaded(lua_t* lua, const uuid_t uuid) {
-	return lua_module_registry_lookup(lua_state(lua), uuid) != nullptr;
+	return lua_module_registry_lookup(lua, uuid) != nullptr;
 }
 
-int
-lua_module_reload(lua_t* lua, const uuid_t uuid) {
+bool
+lua_module_is_loaded_name(lua_t* lua, const char* name, size_t length) {
+	if (!lua || !lua->modules_name)
+		return false;
+	return hashmap_lookup(lua->modules_name, hash(name, length)) != nullptr;
+}
+
+static size_t
+lua_module_uuid_index(const uuid_t* uuids, const uuid_t uuid) {
+	size_t iuuid = 0, usize = array_size(uuids);
+	while ((iuuid < usize) && !uuid_equal(uuids[iuuid], uuid))
+		++iuuid;
+	return iuuid;
+}
+
+static void
+lua_module_add_edge(lua_t* env, const uuid_t module, const uuid_t dependency) {
+	if (uuid_equal(module, dependency))
+		return;
+	for (size_t iedge = 0, esize = array_size(env->modules_edges); iedge < esize; ++iedge) {
+		if (uuid_equal(env->modules_edges[iedge].module, module) &&
+		        uuid_equal(env->modules_edges[iedge].dependency, dependency))
+			return;
+	}
+	lua_module_edge_t edge = {module, dependency};
+	array_push(env->modules_edges, edge);
+}
+
+//Replacement for global require, recording an edge from the module being loaded (if any)
+static int
+lua_module_require(lua_State* state) {
+	size_t name_length = 0;
+	const char* name = luaL_checklstring(state, 1, &name_length);
+	lua_t* env = lua_from_state(state);
+	lua_modulemap_entry_t* entry = env ? lua_modulemap_lookup(hash(name, name_length)) : nullptr;
+
+	lua_pushvalue(state, lua_upvalueindex(1));
+	lua_insert(state, 1);
+	if (!entry) {
+		lua_call(state, lua_gettop(state) - 1, LUA_MULTRET);
+		return lua_gettop(state);
+	}
+
+	size_t depth = array_size(env->modules_requiring);
+	lua_module_add_edge(env, depth ? env->modules_requiring[depth - 1] : uuid_null(), entry->uuid);
+
+	//Requires made while the module chunk executes are edges from this module
+	array_push(env->modules_requiring, entry->uuid);
+	int err = lua_pcall(state, lua_gettop(state) - 1, LUA_MULTRET, 0);
+	array_resize(env->modules_requiring, depth);
+	if (err)
+		lua_error(state);
+	return lua_gettop(state);
+}
+
+size_t
+lua_module_dependencies(lua_t* lua, const uuid_t uuid, uuid_t* dependencies, size_t capacity) {
+	size_t count = 0;
+	if (!lua)
+		return 0;
+	for (size_t iedge = 0, esize = array_size(lua->modules_edges); iedge < esize; ++iedge) {
+		if (!uuid_equal(lua->modules_edges[iedge].module, uuid))
+			continue;
+		if (count < capacity)
+			dependencies[count] = lua->modules_edges[iedge].dependency;
+		++count;
+	}
+	return count;
+}
+
+static void
+lua_module_order_visit(lua_t* env, const uuid_t* set, bool* visited, size_t iset, uuid_t** order) {
+	if (visited[iset])
+		return;
+	visited[iset] = true;
+	for (size_t iedge = 0, esize = array_size(env->modules_edges); iedge < esize; ++iedge) {
+		if (!uuid_equal(env->modules_edges[iedge].module, set[iset]))
+			continue;
+		size_t idep = lua_module_uuid_index(set, env->modules_edges[iedge].dependency);
+		if (idep < array_size(set))
+			lua_module_order_visit(env, set, visited, idep, order);
+	}
+	array_push(*order, set[iset]);
+}
+
+/* Collect the given modules loaded in the state together with all their transitive dependents,
+   ordered so every module comes after the modules it requires (array, caller deallocates) */
+static uuid_t*
+lua_module_reload_order(lua_t* env, const uuid_t* uuids, size_t count) {
+	uuid_t* set = nullptr;
+	uuid_t* order = nullptr;
+
+	for (size_t iuuid = 0; iuuid < count; ++iuuid) {
+		if (lua_module_registry_lookup(env, uuids[iuuid]) &&
+		        (lua_module_uuid_index(set, uuids[iuuid]) == array_size(set)))
+			array_push(set, uuids[iuuid]);
+	}
+	for (size_t iset = 0; iset < array_size(set); ++iset) {
+		for (size_t iedge = 0, esize = array_size(env->modules_edges); iedge < esize; ++iedge) {
+			const lua_module_edge_t* edge = env->modules_edges + iedge;
+			if (uuid_equal(edge->dependency, set[iset]) && lua_module_registry_lookup(env, edge->module) &&
+			        (lua_module_uuid_index(set, edge->module) == array_size(set)))
+				array_push(set, edge->module);
+		}
+	}
+
+	if (set) {
+		//Visit in load order to keep unrelated modules in the order they were loaded
+		bool* visited = memory_allocate(HASH_LUA, sizeof(bool) * array_size(set), 0,
+		                                MEMORY_TEMPORARY | MEMORY_ZERO_INITIALIZED);
+		for (size_t iload = 0, lsize = array_size(env->modules_order); iload < lsize; ++iload) {
+			size_t iset = lua_module_uuid_index(set, env->modules_order[iload]->uuid);
+			if (iset < array_size(set))
+				lua_module_order_visit(env, set, visited, iset, &order);
+		}
+		memory_deallocate(visited);
+		array_deallocate(set);
+	}
+
+	return order;
+}
+
+size_t
+lua_module_dependents(lua_t* lua, const uuid_t uuid, uuid_t* dependents, size_t capacity) {
+	size_t count = 0;
+	if (!lua)
+		return 0;
+	uuid_t* order = lua_module_reload_order(lua, &uuid, 1);
+	for (size_t iorder = 0, osize = array_size(order); iorder < osize; ++iorder) {
+		if (uuid_equal(order[iorder], uuid))
+			continue;
+		if (count < capacity)
+			dependents[count] = order[iorder];
+		++count;
+	}
+	array_deallocate(order);
+	return count;
+}
+
+static int
+lua_module_reload_bytecode(lua_t* lua, const uuid_t uuid, lua_module_t* module, bool rebind) {
 	lua_State* state = lua_state(lua);
-	lua_modulemap_entry_t* entry = lua_module_registry_lookup(state, uuid);
+	lua_modulemap_entry_t* entry = lua_module_registry_lookup(lua, uuid);
 	if (!entry)
 		return -1;
 
 	int ret = -1;
 	int stacksize = lua_gettop(state);
 
-	lua_module_t module = lua_module_load_resource(uuid);
-	if (module.size) {
+	if (module) {
 		string_const_t uuidstr = string_from_uuid_static(uuid);
 		log_debugf(HASH_LUA, STRING_CONST("Reloading module: %.*s"), STRING_FORMAT(uuidstr));
-		if (lua_module_upload(state, module.bytecode, module.size) == 0) {
+		if (lua_module_execute(state, uuid, module) == 0) {
 			//Check if module loaded as a table
 			if (lua_istable(state, -1)) {
+				int newtable = lua_gettop(state);
+
 				lua_pushlstring(state, STRING_CONST(BUILD_REGISTRY_LOADED_MODULES));
 				lua_gettable(state, LUA_REGISTRYINDEX);
 
-				//Get and replace the old loaded module table
+				//Get the old loaded module table and patch it in place
 				lua_pushlightuserdata(state, entry);
 				lua_gettable(state, -2);
 				lua_replace(state, -2); //Get rid of loaded-modules registry table from stack
 				if (lua_istable(state, -1)) {
 					lua_pushlstring(state, STRING_CONST("__modulename"));
-					lua_gettable(state, -2);
-
+					lua_rawget(state, -2);
 					size_t name_length = 0;
-					const char* modulename = lua_isnil(state, -1)
-					                         ? nullptr
-					                         : luaL_checklstring(state, -1, &name_length);
-					log_debugf(HASH_LUA, STRING_CONST("Replacing module table: %.*s (%.*s)"),
-					           STRING_FORMAT(uuidstr), (int)name_length, modulename);
-					lua_pop(state, 1); //Get rid of name from stack
-
-					//Clear previous loaded-modules table
-					lua_pushnil(state);
-					while (lua_next(state, -2) != 0) {
-						lua_pop(state, 1); //Old value
-						lua_pushnil(state); //Replace with nil
-						lua_settable(state, -3); //Erase in previous loaded-modules table
-						lua_pushnil(state); //Restart lua_next
-					}
-
-					//Copy new module table to previous loaded-modules table
-					lua_pushnil(state);
-					while (lua_next(state, -3) != 0) { //Lookup in new module table
-						lua_pushvalue(state, -2); //Copy key
-						lua_pushvalue(state, -2); //Copy value
-						lua_settable(state, -5); //Set in previous loaded-modules table
-						lua_pop(state, 1); //Pop value, leaving key for lua_next iteration
-					}
-
-					lua_pushlstring(state, STRING_CONST("__modulename"));
-					lua_pushlstring(state, modulename, name_length);
-					lua_settable(state, -3);
+					const char* modulename = lua_isstring(state, -1) ? lua_tolstring(state, -1, &name_length) : "";
+					lua_module_patch(state, entry, lua_gettop(state) - 1, newtable,
+					                 string_const(modulename, name_length), rebind);
 				}
 			}
 			ret = 0;
@@ -433,3 +1554,199 @@ lua_module_reload(lua_t* lua, const uuid_t uuid) {
 
 	return ret;
 }
+
+struct lua_module_reload_entry_t {
+	uuid_t uuid;
+	lua_module_t* module;
+	bool rebind;
+};
+typedef struct lua_module_reload_entry_t lua_module_reload_entry_t;
+
+//Ordered reloads for one state queued as a single op, the call queue is a fixed size ring
+struct lua_module_reload_t {
+	tick_t queued;
+	size_t count;
+	lua_module_reload_entry_t entry[];
+};
+typedef struct lua_module_reload_t lua_module_reload_t;
+
+static void
+lua_module_reload_report(lua_t* env, const uuid_t uuid, tick_t queued, tick_t start, int ret) {
+	tick_t end = time_current();
+	string_const_t uuidstr = string_from_uuid_static(uuid);
+	log_debugf(HASH_LUA, STRING_CONST("Reloaded module %.*s in state %p: %s, %.3fms (%.3fms after event)"),
+	           STRING_FORMAT(uuidstr), (void*)env, ret ? "failed" : "ok",
+	           time_ticks_to_seconds(time_diff(start, end)) * 1000.0,
+	           time_ticks_to_seconds(time_diff(queued, end)) * 1000.0);
+}
+
+void
+lua_module_reload_queued(lua_t* env, void* data) {
+	lua_module_reload_t* reload = data;
+	for (size_t ientry = 0; ientry < reload->count; ++ientry) {
+		lua_module_reload_entry_t* entry = reload->entry + ientry;
+		tick_t start = time_current();
+		int ret = lua_module_reload_bytecode(env, entry->uuid, entry->module, entry->rebind);
+		lua_module_reload_report(env, entry->uuid, reload->queued, start, ret);
+	}
+	lua_module_reload_discard(reload);
+}
+
+void
+lua_module_reload_discard(void* data) {
+	lua_module_reload_t* reload = data;
+	for (size_t ientry = 0; ientry < reload->count; ++ientry)
+		lua_module_release(reload->entry[ientry].module);
+	memory_deallocate(reload);
+}
+
+//Bytecode must be either a LuaJIT bytecode dump or source text, never empty
+static bool
+lua_module_validate(lua_module_t* module) {
+	const unsigned char* bytecode = module->bytecode;
+	if (!module->size)
+		return false;
+	if (bytecode[0] != 0x1B)
+		return true;
+	return (module->size > 4) && (bytecode[1] == 'L') && (bytecode[2] == 'J');
+}
+
+/* Reload the given modules and their transitive dependents in the state, in dependency order.
+   Dependents are not changed themselves but are executed again with functions rebound, so
+   values they captured from the reloaded modules are refreshed. Modules are applied directly
+   or queued as one op if the state is executing on another thread. Returns <0 if any reload failed */
+static int
+lua_module_reload_env(lua_t* env, const uuid_t* uuids, lua_module_t** modules, size_t count, tick_t queued,
+                      bool queue) {
+	int result = 0;
+	uuid_t* order = lua_module_reload_order(env, uuids, count);
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+	lua_module_reload_t* reload = nullptr;
+	if (queue && order) {
+		reload = memory_allocate(HASH_LUA, sizeof(lua_module_reload_t) +
+		                         (sizeof(lua_module_reload_entry_t) * array_size(order)), 0, MEMORY_PERSISTENT);
+		reload->queued = queued;
+		reload->count = 0;
+	}
+#else
+	FOUNDATION_UNUSED(queue);
+#endif
+	for (size_t iorder = 0, osize = array_size(order); iorder < osize; ++iorder) {
+		size_t imod = 0;
+		while ((imod < count) && !uuid_equal(uuids[imod], order[iorder]))
+			++imod;
+		bool rebind = (imod == count);
+		lua_module_t* module = rebind ? lua_module_acquire(order[iorder]) : modules[imod];
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+		if (reload) {
+			lua_module_reload_entry_t* entry = reload->entry + reload->count++;
+			entry->uuid = order[iorder];
+			entry->module = module;
+			entry->rebind = rebind;
+			if (module && !rebind)
+				atomic_incr32(&module->ref, memory_order_relaxed);
+			continue;
+		}
+#endif
+		tick_t start = time_current();
+		int ret = lua_module_reload_bytecode(env, order[iorder], module, rebind);
+		lua_module_reload_report(env, order[iorder], queued, start, ret);
+		if (ret < 0)
+			result = ret;
+		if (rebind)
+			lua_module_release(module);
+	}
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+	if (reload) {
+		lua_op_t op;
+		op.cmd = LUACMD_RELOAD;
+		op.data.ptr = reload;
+		//Never block on a busy state here, callers hold the instance lock
+		if (!lua_push_op(env, &op, false)) {
+			log_warn(HASH_LUA, WARNING_SUSPICIOUS, STRING_CONST("Call queue of busy state full, reload dropped"));
+			lua_module_reload_discard(reload);
+			result = -1;
+		}
+	}
+#endif
+	array_deallocate(order);
+	return result;
+}
+
+int
+lua_module_reload(lua_t* lua, const uuid_t uuid) {
+	if (!lua_module_registry_lookup(lua, uuid))
+		return -1;
+	lua_module_t* module = lua_module_acquire(uuid);
+	int ret = lua_module_reload_env(lua, &uuid, &module, 1, time_current(), false);
+	lua_module_release(module);
+	return ret;
+}
+
+void
+lua_module_reload_batch(const uuid_t* uuids, size_t count) {
+	tick_t queued = time_current();
+	lua_module_t** modules = nullptr;
+	uuid_t* loaded = nullptr;
+	uuid_t* valid = nullptr;
+
+	//Only modules loaded in some state are reloaded, other resources are not touched at all
+	lua_instances_lock();
+	lua_t** instances = lua_instances();
+	for (size_t iuuid = 0; iuuid < count; ++iuuid) {
+		for (size_t ienv = 0, esize = array_size(instances); ienv < esize; ++ienv) {
+			if (lua_module_registry_lookup(instances[ienv], uuids[iuuid])) {
+				array_push(loaded, uuids[iuuid]);
+				break;
+			}
+		}
+	}
+	lua_instances_unlock();
+
+	if (!loaded)
+		return;
+
+	//Read and validate once, every state reloads from the same blobs
+	for (size_t iuuid = 0, usize = array_size(loaded); iuuid < usize; ++iuuid) {
+		lua_module_t* module = lua_module_acquire(loaded[iuuid]);
+		if (!module || !lua_module_validate(module)) {
+			string_const_t uuidstr = string_from_uuid_static(loaded[iuuid]);
+			log_warnf(HASH_LUA, WARNING_RESOURCE, STRING_CONST("Unable to load module '%.*s' for reload"),
+			          STRING_FORMAT(uuidstr));
+			lua_module_release(module);
+			continue;
+		}
+		array_push(modules, module);
+		array_push(valid, loaded[iuuid]);
+	}
+	array_deallocate(loaded);
+
+	lua_instances_lock();
+	instances = lua_instances();
+	for (size_t ienv = 0, esize = array_size(instances); ienv < esize; ++ienv) {
+		lua_t* env = instances[ienv];
+		bool queue = false;
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+		//States busy on another thread apply the reloads under their own execution right
+		queue = !lua_acquire_execution_right(env, false);
+		if (!queue)
+			lua_execute_pending(env);
+#endif
+		lua_module_reload_env(env, valid, modules, array_size(valid), queued, queue);
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+		if (!queue)
+			lua_release_execution_right(env);
+#endif
+	}
+	lua_instances_unlock();
+
+	for (size_t imod = 0, msize = array_size(modules); imod < msize; ++imod)
+		lua_module_release(modules[imod]);
+	array_deallocate(modules);
+	array_deallocate(valid);
+}
+
+void
+lua_module_reload_all(const uuid_t uuid) {
+	lua_module_reload_batch(&uuid, 1);
+}
@@ -28,13 +28,68 @@
 LUA_API bool
 lua_module_is_loaded(lua_t* lua, const uuid_t uuid);
 
-/*! Reload the given module into the given lua environment
+/*! Query if module is loaded in the given lua environment
+\param lua Lua environment
+\param name Module name
+\param length Length of module name
+\return true if loaded, false if not */
+LUA_API bool
+lua_module_is_loaded_name(lua_t* lua, const char* name, size_t length);
+
+/*! Mark module as loaded in the given lua environment, making it visible to
+lua_module_is_loaded and lua_module_reload. Called by lua_module_loader, custom
+loaders should call it once a module is successfully loaded.
+\param lua Lua environment
+\param entry Module entry, as passed to the loader in the second upvalue */
+LUA_API void
+lua_module_set_loaded(lua_t* lua, lua_modulemap_entry_t* entry);
+
+/*! Reload the given module into the given lua environment, followed by all modules
+depending on it (see lua_module_dependents)
 \param lua Lua environment
 \param uuid Module to reload
 \return 0 if successful, <0 if error */
 LUA_API int
 lua_module_reload(lua_t* lua, const uuid_t uuid);
 
+/*! Reload the given module in all lua environments where it is loaded. The bytecode is read
+and validated once. States executing on another thread get the reload queued and apply it under
+their own execution right (only if BUILD_ENABLE_LUA_THREAD_SAFE is set). Per state reload latency
+is logged at debug level.
+\param uuid Module to reload */
+LUA_API void
+lua_module_reload_all(const uuid_t uuid);
+
+/*! Reload the given modules in all lua environments where they are loaded, as one batch per
+environment. Modules requiring the reloaded modules, directly or indirectly, are executed again
+with their functions rebound. Each environment applies the reloads in dependency order, so
+modules are reloaded after the modules they require.
+\param uuids Modules to reload
+\param count Number of modules */
+LUA_API void
+lua_module_reload_batch(const uuid_t* uuids, size_t count);
+
+/*! Get the modules directly required by the given module in the given lua environment. Edges
+are recorded by require as modules execute, including requires of already loaded modules.
+\param lua Lua environment
+\param uuid Module, or null uuid for modules required outside of any module
+\param dependencies Array receiving module uuids
+\param capacity Capacity of dependencies array
+\return Number of dependencies, may be larger than capacity */
+LUA_API size_t
+lua_module_dependencies(lua_t* lua, const uuid_t uuid, uuid_t* dependencies, size_t capacity);
+
+/*! Get all modules in the given lua environment that directly or indirectly require the given
+module, in the order they are reloaded when the module is reloaded (every module after the
+modules it requires).
+\param lua Lua environment
+\param uuid Module
+\param dependents Array receiving module uuids
+\param capacity Capacity of dependents array
+\return Number of dependents, may be larger than capacity */
+LUA_API size_t
+lua_module_dependents(lua_t* lua, const uuid_t uuid, uuid_t* dependents, size_t capacity);
+
 /*! Register a module with the module loader.
 \param name Module name
 \param length Length of module name
@@ -44,6 +99,23 @@ lua_module_reload(lua_t* lua, const uuid_t uuid);
 LUA_API void
 lua_module_register(const char* name, size_t length, const uuid_t uuid, lua_fn loader, lua_preload_fn preload);
 
+/*! Get the uuid of a module registered with the module loader.
+\param name Module name
+\param length Length of module name
+\return Module uuid, null uuid if no module is registered with the given name */
+LUA_API uuid_t
+lua_module_lookup(const char* name, size_t length);
+
+/*! Enable or disable lazy module loading in the given lua environment. When enabled, require of
+a module using lua_module_loader returns an empty proxy table immediately, and the preload function
+and module chunk run on the first index or assignment of a field in the proxy, which then becomes
+the module table. Iterating a proxy with next or pairs does not trigger the load. Only modules
+returning a table can be loaded lazily.
+\param lua Lua environment
+\param lazy Flag for lazy loading */
+LUA_API void
+lua_module_set_lazy(lua_t* lua, bool lazy);
+
 /*! Standard module loader. Takes the module entry as the first upvalue index as a
 lua_modulemap_entry_t userdata pointer.
 \param state Lua state
@@ -51,4 +123,61 @@ lua_modulemap_entry_t userdata pointer.
 LUA_API int
 lua_module_loader(lua_State* state);
 
+/*! Drop the given module from the process wide bytecode cache. States currently loading the
+module keep their reference to the old bytecode, and loads in flight when invalidated are
+discarded and retried rather than cached. Called automatically on resource modification.
+\param uuid Module */
+LUA_API void
+lua_module_cache_invalidate(const uuid_t uuid);
+
+/*! Get statistics for the process wide module bytecode cache shared by all states
+\return Cache statistics */
+LUA_API lua_module_cache_statistics_t
+lua_module_cache_statistics(void);
+
+/*! Load the given modules in parallel on a pool of threads and put the bytecode in the process
+wide module cache, so that subsequent requires from any state do not block on stream I/O or
+recompilation. Blocks until all modules are fetched.
+\param uuids Modules
+\param count Number of modules
+\return Number of modules successfully fetched */
+LUA_API size_t
+lua_module_prefetch(const uuid_t* uuids, size_t count);
+
+/*! Prefetch modules listed in a dependency manifest. The manifest is a text stream with one
+module per line, the module uuid followed by the uuids of the modules it requires, separated
+by whitespace. Empty lines and lines starting with # are ignored.
+\param stream Manifest stream
+\param uuid Module to prefetch with its transitive dependencies, null uuid for all modules
+\return Number of modules successfully fetched */
+LUA_API size_t
+lua_module_prefetch_manifest(stream_t* stream, const uuid_t uuid);
+
+/*! Write compiled bytecode as a bundled resource, holding header, version, size, checksum and
+bytecode in the static resource stream so loading needs a single open.
+\param stream Static resource stream
+\param source_hash Source hash for resource header
+\param bytecode Bytecode
+\param size Size of bytecode
+\return true if successful, false if error */
+LUA_API bool
+lua_module_write_bundle(stream_t* stream, const uint256_t source_hash, const void* bytecode, size_t size);
+
+/*! Write compiled bytecode following the header of a static bundled or a dynamic resource
+stream, as version word, size, stored size if compressed, checksum if bundled and bytecode.
+\param stream Resource stream
+\param bytecode Bytecode
+\param size Size of bytecode
+\param bundled Flag if stream is a bundled static stream, adding a checksum
+\param compress Flag to compress bytecode, stored uncompressed if compression does not save bytes
+\return true if successful, false if error */
+LUA_API bool
+lua_module_write_bytecode(stream_t* stream, const void* bytecode, size_t size, bool bundled, bool compress);
+
 #define LUA_RESOURCE_MODULE_VERSION 1
+
+//! Flag in module version word of resource streams holding compressed bytecode (see lua_compress)
+#define LUA_RESOURCE_MODULE_COMPRESSED 0x80000000U
+
+//! Static resource stream header version of bundled resources (see lua_module_write_bundle)
+#define LUA_RESOURCE_BUNDLE_VERSION 2
@@ -0,0 +1,273 @@
+/* profile.c  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#define LUA_USE_INTERNAL_HEADER
+
+#include <lua/lua.h>
+#include <foundation/foundation.h>
+
+#undef LUA_API
+#define LUA_HAS_LUA_STATE_TYPE
+
+#include "luajit/src/lua.h"
+#include "luajit/src/luajit.h"
+
+#include <stdlib.h>
+
+#define LUA_PROFILE_FRAME_LENGTH 96
+
+struct lua_profile_t {
+	bool                sampling;
+	//! JIT engine was enabled when sampling began, restored when sampling ends
+	bool                jit_enabled;
+	int64_t             interval;
+	int64_t             countdown;
+	int64_t             samples;
+	int64_t             bytes;
+	lua_profile_site_t* sites;
+	hashmap_t*          sitemap;
+	lua_profile_site_t* stacks;
+	hashmap_t*          stackmap;
+};
+
+LUA_EXTERN void
+lua_profile_allocation_sample(lua_t* env, size_t size);
+
+LUA_EXTERN void
+lua_profile_deallocate(lua_t* env);
+
+static void
+lua_profile_clear(lua_profile_t* profile) {
+	for (size_t isite = 0, ssize = array_size(profile->sites); isite < ssize; ++isite)
+		string_deallocate(profile->sites[isite].name.str);
+	for (size_t istack = 0, ssize = array_size(profile->stacks); istack < ssize; ++istack)
+		string_deallocate(profile->stacks[istack].name.str);
+	array_clear(profile->sites);
+	array_clear(profile->stacks);
+	hashmap_clear(profile->sitemap);
+	hashmap_clear(profile->stackmap);
+	profile->samples = 0;
+	profile->bytes = 0;
+}
+
+static void
+lua_profile_add(lua_profile_site_t** sites, hashmap_t* map, const char* name, size_t length,
+                int64_t bytes) {
+	hash_t key = hash(name, length);
+	uintptr_t index = (uintptr_t)hashmap_lookup(map, key);
+	if (!index) {
+		lua_profile_site_t site = {string_clone(name, length), 0, 0};
+		array_push(*sites, site);
+		index = array_size(*sites);
+		hashmap_insert(map, key, (void*)index);
+	}
+	++(*sites)[index - 1].count;
+	(*sites)[index - 1].bytes += bytes;
+}
+
+//Called from the Lua allocator, must not allocate Lua objects or use the Lua stack
+void
+lua_profile_allocation_sample(lua_t* env, size_t size) {
+	lua_profile_t* profile = env->profile;
+	if (!profile->sampling)
+		return;
+
+	profile->bytes += (int64_t)size;
+	profile->countdown -= (int64_t)size;
+	if (profile->countdown > 0)
+		return;
+
+	//Each sample accounts for all intervals passed since the previous sample
+	int64_t weight = profile->interval * (1 + (-profile->countdown / profile->interval));
+	profile->countdown += weight;
+	++profile->samples;
+
+	char frame[BUILD_LUA_PROFILE_DEPTH][LUA_PROFILE_FRAME_LENGTH];
+	size_t frame_length[BUILD_LUA_PROFILE_DEPTH];
+	int depth = 0;
+	int leaf = -1;
+
+	lua_State* state = lua_currentthread(env->state);
+	lua_Debug ar;
+	while ((depth < BUILD_LUA_PROFILE_DEPTH) && lua_getstack(state, depth, &ar)) {
+		string_t label;
+		if (!lua_getinfo(state, "Sl", &ar))
+			break;
+		if (ar.currentline > 0)
+			label = string_format(frame[depth], LUA_PROFILE_FRAME_LENGTH, STRING_CONST("%s:%d"),
+			                      ar.short_src, ar.currentline);
+		else
+			label = string_format(frame[depth], LUA_PROFILE_FRAME_LENGTH, STRING_CONST("%s"),
+			                      ar.short_src);
+		frame_length[depth] = label.length;
+		if ((leaf < 0) && (ar.currentline > 0))
+			leaf = depth;
+		++depth;
+	}
+
+	if (leaf >= 0)
+		lua_profile_add(&profile->sites, profile->sitemap, frame[leaf], frame_length[leaf], weight);
+	else
+		lua_profile_add(&profile->sites, profile->sitemap, STRING_CONST("[C]"), weight);
+
+	//Folded stack format lists frames from outermost to innermost
+	char buffer[BUILD_LUA_PROFILE_DEPTH * (LUA_PROFILE_FRAME_LENGTH + 1)];
+	size_t offset = 0;
+	for (int iframe = depth - 1; iframe >= 0; --iframe) {
+		if (offset)
+			buffer[offset++] = ';';
+		memcpy(buffer + offset, frame[iframe], frame_length[iframe]);
+		offset += frame_length[iframe];
+	}
+	if (!offset) {
+		memcpy(buffer, "[C]", 3);
+		offset = 3;
+	}
+	lua_profile_add(&profile->stacks, profile->stackmap, buffer, offset, weight);
+}
+
+void
+lua_profile_deallocate(lua_t* env) {
+	lua_profile_t* profile = env->profile;
+	if (!profile)
+		return;
+	env->profile = nullptr;
+	lua_profile_clear(profile);
+	array_deallocate(profile->sites);
+	array_deallocate(profile->stacks);
+	hashmap_deallocate(profile->sitemap);
+	hashmap_deallocate(profile->stackmap);
+	memory_deallocate(profile);
+}
+
+//Engine mode is only queryable through jit.status, assume enabled if the jit library is not loaded
+static bool
+lua_profile_jit_enabled(lua_State* state) {
+	bool enabled = true;
+	lua_getfield(state, LUA_REGISTRYINDEX, "_LOADED");
+	if (lua_istable(state, -1)) {
+		lua_getfield(state, -1, "jit");
+		if (lua_istable(state, -1)) {
+			lua_getfield(state, -1, "status");
+			if (lua_isfunction(state, -1) && (lua_pcall(state, 0, 1, 0) == 0))
+				enabled = lua_toboolean(state, -1);
+			lua_pop(state, 1);
+		}
+		lua_pop(state, 1);
+	}
+	lua_pop(state, 1);
+	return enabled;
+}
+
+bool
+lua_profile_allocation_begin(lua_t* env, size_t interval) {
+	if (!env)
+		return false;
+
+	lua_profile_t* profile = env->profile;
+	if (!profile) {
+		profile = memory_allocate(HASH_LUA, sizeof(lua_profile_t), 0,
+		                          MEMORY_PERSISTENT | MEMORY_ZERO_INITIALIZED);
+		profile->sitemap = hashmap_allocate(BUILD_SIZE_LUA_LOOKUP_BUCKETS, 8);
+		profile->stackmap = hashmap_allocate(BUILD_SIZE_LUA_LOOKUP_BUCKETS, 8);
+		profile->jit_enabled = lua_profile_jit_enabled(env->state);
+	}
+	else if (profile->sampling) {
+		//Restarting keeps the engine mode saved by the first begin
+		profile->sampling = false;
+		lua_profile_clear(profile);
+	}
+	else {
+		lua_profile_clear(profile);
+		profile->jit_enabled = lua_profile_jit_enabled(env->state);
+	}
+
+	profile->interval = interval ? (int64_t)interval : BUILD_LUA_PROFILE_INTERVAL;
+	profile->countdown = profile->interval;
+
+	luaJIT_setmode(env->state, 0, LUAJIT_MODE_ENGINE | LUAJIT_MODE_FLUSH);
+	luaJIT_setmode(env->state, 0, LUAJIT_MODE_ENGINE | LUAJIT_MODE_OFF);
+
+	env->profile = profile;
+	profile->sampling = true;
+
+	return true;
+}
+
+void
+lua_profile_allocation_end(lua_t* env) {
+	if (!env || !env->profile || !env->profile->sampling)
+		return;
+
+	env->profile->sampling = false;
+
+	if (env->profile->jit_enabled)
+		luaJIT_setmode(env->state, 0, LUAJIT_MODE_ENGINE | LUAJIT_MODE_ON);
+
+	log_debugf(HASH_LUA, STRING_CONST("Allocation profile: %" PRId64 " samples over %" PRId64 " bytes"),
+	           env->profile->samples, env->profile->bytes);
+}
+
+const lua_profile_site_t*
+lua_profile_allocation_sites(lua_t* env) {
+	return (env && env->profile) ? env->profile->sites : nullptr;
+}
+
+bool
+lua_profile_allocation_write(lua_t* env, stream_t* stream) {
+	if (!env || !env->profile || !stream)
+		return false;
+
+	const lua_profile_site_t* stacks = env->profile->stacks;
+	for (size_t istack = 0, ssize = array_size(stacks); istack < ssize; ++istack)
+		stream_write_format(stream, STRING_CONST("%.*s %" PRId64 "\n"),
+		                    STRING_FORMAT(stacks[istack].name), stacks[istack].bytes);
+	stream_flush(stream);
+
+	return true;
+}
+
+static int
+lua_profile_site_compare(const void* first, const void* second) {
+	const lua_profile_site_t* lhs = first;
+	const lua_profile_site_t* rhs = second;
+	if (lhs->bytes != rhs->bytes)
+		return (lhs->bytes > rhs->bytes) ? -1 : 1;
+	return 0;
+}
+
+void
+lua_profile_allocation_log(lua_t* env, size_t limit) {
+	if (!env || !env->profile)
+		return;
+
+	lua_profile_t* profile = env->profile;
+	size_t ssize = array_size(profile->sites);
+	lua_profile_site_t* sorted = memory_allocate(HASH_LUA, sizeof(lua_profile_site_t) * (ssize + 1), 0,
+	                                             MEMORY_TEMPORARY);
+	if (ssize)
+		memcpy(sorted, profile->sites, sizeof(lua_profile_site_t) * ssize);
+	qsort(sorted, ssize, sizeof(lua_profile_site_t), lua_profile_site_compare);
+
+	log_infof(HASH_LUA, STRING_CONST("Allocation profile: %" PRId64 " samples over %" PRId64 " bytes"),
+	          profile->samples, profile->bytes);
+	for (size_t isite = 0; isite < ssize; ++isite) {
+		if (limit && (isite >= limit))
+			break;
+		log_infof(HASH_LUA, STRING_CONST("  %10" PRId64 " %14" PRId64 "  %.*s"),
+		          sorted[isite].count, sorted[isite].bytes, STRING_FORMAT(sorted[isite].name));
+	}
+
+	memory_deallocate(sorted);
+}
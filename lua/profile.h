@@ -0,0 +1,59 @@
+/* profile.h  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#pragma once
+
+/*! \file profile.h
+    Lua allocation profiling */
+
+#include <foundation/platform.h>
+
+#include <lua/types.h>
+
+/*! Start sampling allocations made by the given Lua environment. Every time the given
+number of bytes has been allocated the current Lua call stack is captured and attributed
+the sampled bytes. Any previously collected samples are discarded. JIT compiled code does
+not maintain call frames, so the JIT engine is turned off while sampling and restored to its
+previous mode by lua_profile_allocation_end.
+\param env Lua environment
+\param interval Sampling interval in bytes, 0 for default (BUILD_LUA_PROFILE_INTERVAL)
+\return true if sampling started, false if failed */
+LUA_API bool
+lua_profile_allocation_begin(lua_t* env, size_t interval);
+
+/*! Stop sampling allocations. Collected samples are kept until sampling is restarted or
+the environment is deallocated.
+\param env Lua environment */
+LUA_API void
+lua_profile_allocation_end(lua_t* env);
+
+/*! Get collected samples aggregated by the innermost Lua function and line
+\param env Lua environment
+\return Array of sites, null if no samples collected */
+LUA_API const lua_profile_site_t*
+lua_profile_allocation_sites(lua_t* env);
+
+/*! Write collected samples as folded stacks, one "frame;frame;frame bytes" line per
+unique call stack, suitable as input to flamegraph tools
+\param env Lua environment
+\param stream Output stream
+\return true if successful, false if failed */
+LUA_API bool
+lua_profile_allocation_write(lua_t* env, stream_t* stream);
+
+/*! Log collected samples by site, largest byte count first
+\param env Lua environment
+\param limit Maximum number of sites to log, 0 for all */
+LUA_API void
+lua_profile_allocation_log(lua_t* env, size_t limit);
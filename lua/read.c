@@ -15,6 +15,17 @@
 #include <lua/lua.h>
 
 #include <foundation/stream.h>
+#include <foundation/path.h>
+
+#if FOUNDATION_PLATFORM_WINDOWS
+#  include <foundation/windows.h>
+#elif FOUNDATION_PLATFORM_POSIX
+#  include <foundation/posix.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
 
 const char*
 lua_read_stream(lua_State* state, void* user_data, size_t* size) {
@@ -102,3 +113,76 @@ lua_read_string(lua_State* state, void* user_data, size_t* size) {
 
 	return read->string;
 }
+
+bool
+lua_stream_map(stream_t* stream, size_t size, lua_mapping_t* mapping) {
+	memset(mapping, 0, sizeof(lua_mapping_t));
+
+	//Only local files can be mapped, other streams must be read
+	string_const_t path = stream_path(stream);
+	if ((path.length <= 7) || !string_equal(path.str, 7, STRING_CONST("file://")))
+		return false;
+
+	size_t offset = stream_tell(stream);
+	size_t available = stream_size(stream);
+	if (!size || (offset > available) || (size > available - offset) ||
+	        (size < BUILD_LUA_MAP_MINIMUM_SIZE))
+		return false;
+
+	path = path_strip_protocol(STRING_ARGS(path));
+	string_t pathstr = string_clone(STRING_ARGS(path));
+	size_t mapsize = offset + size;
+	void* base = nullptr;
+
+#if FOUNDATION_PLATFORM_WINDOWS
+	HANDLE file = CreateFileA(pathstr.str, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+	                          OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file != INVALID_HANDLE_VALUE) {
+		HANDLE filemap = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (filemap) {
+			base = MapViewOfFile(filemap, FILE_MAP_READ, 0, 0, mapsize);
+			CloseHandle(filemap);
+		}
+		CloseHandle(file);
+	}
+#elif FOUNDATION_PLATFORM_POSIX
+	int fd = open(pathstr.str, O_RDONLY);
+	if (fd >= 0) {
+		struct stat st;
+		//Mapping past end of file faults on access, make sure the file was not truncated
+		if ((fstat(fd, &st) == 0) && ((size_t)st.st_size >= mapsize)) {
+			base = mmap(nullptr, mapsize, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (base == MAP_FAILED)
+				base = nullptr;
+		}
+		close(fd);
+	}
+#endif
+
+	string_deallocate(pathstr.str);
+
+	if (!base)
+		return false;
+
+	mapping->base = base;
+	mapping->size = mapsize;
+	mapping->data = pointer_offset_const(base, offset);
+	mapping->length = size;
+
+	//Keep stream position consistent with a read of the mapped data
+	stream_seek(stream, (ssize_t)size, STREAM_SEEK_CURRENT);
+
+	return true;
+}
+
+void
+lua_stream_unmap(lua_mapping_t* mapping) {
+	if (!mapping->base)
+		return;
+#if FOUNDATION_PLATFORM_WINDOWS
+	UnmapViewOfFile(mapping->base);
+#elif FOUNDATION_PLATFORM_POSIX
+	munmap(mapping->base, mapping->size);
+#endif
+	memset(mapping, 0, sizeof(lua_mapping_t));
+}
@@ -33,3 +33,20 @@ lua_read_buffer(lua_State* state, void* user_data, size_t* size);
 LUA_API const char*
 lua_read_string(lua_State* state, void* user_data, size_t* size);
 
+/*! Map the next bytes of a stream read-only into memory, for feeding a blob to lua_load
+in one chunk with lua_read_buffer instead of copying it. Only local file streams are mapped,
+and only blobs of at least BUILD_LUA_MAP_MINIMUM_SIZE bytes. On success the stream position is
+advanced past the mapped bytes, on failure the stream is untouched and the caller should fall
+back to reading the stream. Keep the mapping only for the duration of the load, the file can
+be rewritten in place by a recompile which tears or truncates a live mapping.
+\param stream Stream
+\param size Number of bytes to map from current stream position
+\param mapping Mapping to initialize
+\return true if mapped, false if stream must be read */
+LUA_API bool
+lua_stream_map(stream_t* stream, size_t size, lua_mapping_t* mapping);
+
+/*! Unmap memory mapped by lua_stream_map
+\param mapping Mapping */
+LUA_API void
+lua_stream_unmap(lua_mapping_t* mapping);
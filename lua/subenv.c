@@ -0,0 +1,141 @@
+/* subenv.c  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#define LUA_USE_INTERNAL_HEADER
+
+#include <lua/lua.h>
+
+#include <foundation/log.h>
+
+#undef LUA_API
+#define LUA_HAS_LUA_STATE_TYPE
+
+#include "luajit/src/lua.h"
+#include "luajit/src/lauxlib.h"
+
+static lua_subenv_t
+lua_do_subenv_allocate(lua_t* env) {
+	lua_State* state = env->state;
+
+	lua_newtable(state);
+
+	//All sub-environments share one metatable redirecting lookups to globals
+	lua_pushlstring(state, STRING_CONST(BUILD_REGISTRY_SUBENV_META));
+	lua_rawget(state, LUA_REGISTRYINDEX);
+	if (!lua_istable(state, -1)) {
+		lua_pop(state, 1);
+		lua_createtable(state, 0, 1);
+		lua_pushlstring(state, STRING_CONST("__index"));
+		lua_pushvalue(state, LUA_GLOBALSINDEX);
+		lua_rawset(state, -3);
+		lua_pushlstring(state, STRING_CONST(BUILD_REGISTRY_SUBENV_META));
+		lua_pushvalue(state, -2);
+		lua_rawset(state, LUA_REGISTRYINDEX);
+	}
+	lua_setmetatable(state, -2);
+
+	int ref = luaL_ref(state, LUA_REGISTRYINDEX);
+	return (ref > 0) ? ref : 0;
+}
+
+lua_subenv_t
+lua_subenv_allocate(lua_t* env) {
+	if (!env)
+		return 0;
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+	lua_acquire_execution_right(env, true);
+	lua_subenv_t subenv = lua_do_subenv_allocate(env);
+	lua_release_execution_right(env);
+	return subenv;
+#else
+	return lua_do_subenv_allocate(env);
+#endif
+}
+
+void
+lua_subenv_deallocate(lua_t* env, lua_subenv_t subenv) {
+	if (!env || (subenv <= 0))
+		return;
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+	lua_acquire_execution_right(env, true);
+#endif
+	luaL_unref(env->state, LUA_REGISTRYINDEX, subenv);
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+	lua_release_execution_right(env);
+#endif
+}
+
+bool
+lua_subenv_push(lua_t* env, lua_subenv_t subenv) {
+	if (!env || (subenv <= 0))
+		return false;
+	lua_rawgeti(env->state, LUA_REGISTRYINDEX, subenv);
+	if (!lua_istable(env->state, -1)) {
+		lua_pop(env->state, 1);
+		return false;
+	}
+	return true;
+}
+
+static lua_result_t
+lua_do_subenv_eval_string(lua_t* env, lua_subenv_t subenv, const char* code, size_t length) {
+	lua_State* state = env->state;
+
+	lua_readstring_t read_string = {
+		.string = code,
+		.size   = length
+	};
+
+	if (lua_load(state, lua_read_string, &read_string, "=eval") != 0) {
+		string_const_t errmsg = {0, 0};
+		errmsg.str = lua_tolstring(state, -1, &errmsg.length);
+		log_errorf(HASH_LUA, ERROR_INVALID_VALUE, STRING_CONST("Lua eval string failed on load: %.*s"),
+		           STRING_FORMAT(errmsg));
+		lua_pop(state, 1);
+		return LUA_ERROR;
+	}
+
+	if (!lua_subenv_push(env, subenv)) {
+		log_error(HASH_LUA, ERROR_INVALID_VALUE, STRING_CONST("Lua eval string failed, invalid sub-environment"));
+		lua_pop(state, 1);
+		return LUA_ERROR;
+	}
+	lua_setfenv(state, -2);
+
+	if (lua_pcall(state, 0, 0, 0) != 0) {
+		string_const_t errmsg = {0, 0};
+		errmsg.str = lua_tolstring(state, -1, &errmsg.length);
+		log_errorf(HASH_LUA, ERROR_INTERNAL_FAILURE, STRING_CONST("Lua eval string failed on pcall: %.*s"),
+		           STRING_FORMAT(errmsg));
+		lua_pop(state, 1);
+		return LUA_ERROR;
+	}
+
+	return LUA_OK;
+}
+
+lua_result_t
+lua_subenv_eval_string(lua_t* env, lua_subenv_t subenv, const char* code, size_t length) {
+	if (!env || !code || (subenv <= 0))
+		return LUA_ERROR;
+#if BUILD_ENABLE_LUA_THREAD_SAFE
+	lua_acquire_execution_right(env, true);
+	lua_execute_pending(env);
+	lua_result_t res = lua_do_subenv_eval_string(env, subenv, code, length);
+	lua_release_execution_right(env);
+	return res;
+#else
+	return lua_do_subenv_eval_string(env, subenv, code, length);
+#endif
+}
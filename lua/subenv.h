@@ -0,0 +1,55 @@
+/* subenv.h  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#pragma once
+
+/*! \file subenv.h
+    Lightweight sub-environments sharing one Lua state */
+
+#include <foundation/platform.h>
+
+#include <lua/types.h>
+
+/*! Allocate a sub-environment in the given Lua environment. A sub-environment is a globals
+table of its own which falls back to the shared globals on lookup, so loaded modules, bindings
+and compiled code are shared while global assignments stay local. Code evaluated in the
+sub-environment and functions it defines use it as function environment. Call methods defined
+in it with the lua_subenv_call_* functions.
+\param env Lua environment
+\return Sub-environment handle, 0 if failed */
+LUA_API lua_subenv_t
+lua_subenv_allocate(lua_t* env);
+
+/*! Deallocate a sub-environment. Functions defined in it keep their environment table alive
+until they are collected.
+\param env Lua environment
+\param subenv Sub-environment handle */
+LUA_API void
+lua_subenv_deallocate(lua_t* env, lua_subenv_t subenv);
+
+/*! Evaluate code in a sub-environment
+\param env Lua environment
+\param subenv Sub-environment handle
+\param code Code
+\param length Length of code
+\return LUA_OK if successful, LUA_ERROR if failed */
+LUA_API lua_result_t
+lua_subenv_eval_string(lua_t* env, lua_subenv_t subenv, const char* code, size_t length);
+
+/*! Push the globals table of a sub-environment on the Lua stack
+\param env Lua environment
+\param subenv Sub-environment handle
+\return true if pushed, false if invalid handle (nothing pushed) */
+LUA_API bool
+lua_subenv_push(lua_t* env, lua_subenv_t subenv);
@@ -0,0 +1,152 @@
+/* template.c  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#define LUA_USE_INTERNAL_HEADER
+
+#include <lua/lua.h>
+#include <foundation/foundation.h>
+
+#undef LUA_API
+#define LUA_HAS_LUA_STATE_TYPE
+
+#include "luajit/src/lua.h"
+
+struct lua_template_t {
+	string_t   code;
+	size_t     reserve;
+	lua_t**    ready;
+	mutex_t*   lock;
+	thread_t   thread;
+	atomic32_t terminate;
+	atomic32_t hits;
+	atomic32_t misses;
+};
+
+static lua_t*
+lua_template_build(lua_template_t* tmpl) {
+	lua_t* env = lua_allocate();
+	if (!env)
+		return nullptr;
+
+	if (tmpl->code.length && (lua_eval_string(env, STRING_ARGS(tmpl->code)) != LUA_OK)) {
+		log_error(HASH_LUA, ERROR_SCRIPT, STRING_CONST("Lua template warm up code failed"));
+		lua_deallocate(env);
+		return nullptr;
+	}
+
+	//Start instances with a compact heap
+	lua_gc(env->state, LUA_GCCOLLECT, 0);
+
+	return env;
+}
+
+static void*
+lua_template_thread(void* arg) {
+	lua_template_t* tmpl = arg;
+
+	while (!atomic_load32(&tmpl->terminate, memory_order_acquire)) {
+		while (!atomic_load32(&tmpl->terminate, memory_order_acquire)) {
+			mutex_lock(tmpl->lock);
+			size_t available = array_size(tmpl->ready);
+			mutex_unlock(tmpl->lock);
+			if (available >= tmpl->reserve)
+				break;
+
+			lua_t* env = lua_template_build(tmpl);
+			if (!env)
+				break;
+
+			mutex_lock(tmpl->lock);
+			array_push(tmpl->ready, env);
+			mutex_unlock(tmpl->lock);
+		}
+		thread_wait();
+	}
+
+	return 0;
+}
+
+lua_template_t*
+lua_template_allocate(const char* code, size_t length, size_t reserve) {
+	lua_template_t* tmpl = memory_allocate(HASH_LUA, sizeof(lua_template_t), 0,
+	                                       MEMORY_PERSISTENT | MEMORY_ZERO_INITIALIZED);
+
+	tmpl->code = string_clone(code, length);
+	tmpl->reserve = reserve ? reserve : BUILD_LUA_TEMPLATE_RESERVE;
+	tmpl->lock = mutex_allocate(STRING_CONST("lua-template"));
+
+	thread_initialize(&tmpl->thread, lua_template_thread, tmpl, STRING_CONST("lua_template"),
+	                  THREAD_PRIORITY_BELOWNORMAL, 0);
+	thread_start(&tmpl->thread);
+
+	return tmpl;
+}
+
+void
+lua_template_deallocate(lua_template_t* tmpl) {
+	if (!tmpl)
+		return;
+
+	atomic_store32(&tmpl->terminate, 1, memory_order_release);
+	thread_signal(&tmpl->thread);
+	thread_finalize(&tmpl->thread);
+
+	log_debugf(HASH_LUA, STRING_CONST("Lua template instantiated %d ready and %d on demand"),
+	           atomic_load32(&tmpl->hits, memory_order_relaxed),
+	           atomic_load32(&tmpl->misses, memory_order_relaxed));
+
+	for (size_t ienv = 0, esize = array_size(tmpl->ready); ienv < esize; ++ienv)
+		lua_deallocate(tmpl->ready[ienv]);
+	array_deallocate(tmpl->ready);
+
+	mutex_deallocate(tmpl->lock);
+	string_deallocate(tmpl->code.str);
+	memory_deallocate(tmpl);
+}
+
+lua_t*
+lua_template_instantiate(lua_template_t* tmpl) {
+	lua_t* env = nullptr;
+
+	if (!tmpl)
+		return nullptr;
+
+	mutex_lock(tmpl->lock);
+	size_t available = array_size(tmpl->ready);
+	if (available) {
+		env = tmpl->ready[available - 1];
+		array_pop(tmpl->ready);
+	}
+	mutex_unlock(tmpl->lock);
+
+	thread_signal(&tmpl->thread);
+
+	if (env) {
+		atomic_incr32(&tmpl->hits, memory_order_relaxed);
+		return env;
+	}
+
+	atomic_incr32(&tmpl->misses, memory_order_relaxed);
+	return lua_template_build(tmpl);
+}
+
+size_t
+lua_template_available(lua_template_t* tmpl) {
+	if (!tmpl)
+		return 0;
+	mutex_lock(tmpl->lock);
+	size_t available = array_size(tmpl->ready);
+	mutex_unlock(tmpl->lock);
+	return available;
+}
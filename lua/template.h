@@ -0,0 +1,52 @@
+/* template.h  -  Lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#pragma once
+
+/*! \file template.h
+    Pre-warmed Lua state templates */
+
+#include <foundation/platform.h>
+
+#include <lua/types.h>
+
+/*! Allocate a template producing Lua environments warmed up by the given code, for
+example requiring commonly used modules. A background thread keeps a reserve of ready
+environments so that instantiation does not pay the setup and warm up cost.
+\param code Warm up code evaluated in each new environment
+\param length Length of code
+\param reserve Number of environments to keep ready, 0 for default (BUILD_LUA_TEMPLATE_RESERVE)
+\return New template, null if failed */
+LUA_API lua_template_t*
+lua_template_allocate(const char* code, size_t length, size_t reserve);
+
+/*! Deallocate a template and all environments held in reserve. Environments already
+handed out by lua_template_instantiate are not affected.
+\param tmpl Template */
+LUA_API void
+lua_template_deallocate(lua_template_t* tmpl);
+
+/*! Get a warmed up environment from the template reserve, or create one on the calling
+thread if the reserve is empty. The returned environment is owned by the caller and
+should be released with lua_deallocate.
+\param tmpl Template
+\return Lua environment, null if failed */
+LUA_API lua_t*
+lua_template_instantiate(lua_template_t* tmpl);
+
+/*! Get number of environments currently held in reserve
+\param tmpl Template
+\return Number of ready environments */
+LUA_API size_t
+lua_template_available(lua_template_t* tmpl);
@@ -236,6 +236,7 @@ main_initialize(void) {
 #if BUILD_MONOLITHIC
 extern int test_bind_run(void);
 extern int test_foundation_run(void);
+extern int test_lua_run(void);
 typedef int (*test_run_fn)(void);
 
 static void*
@@ -349,6 +350,7 @@ main_run(void* main_arg) {
 	test_run_fn tests[] = {
 		test_bind_run,
 		test_foundation_run,
+		test_lua_run,
 		0
 	};
 
@@ -0,0 +1,1604 @@
+/* main.c  -  Core test for lua library  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#include <foundation/foundation.h>
+#include <resource/resource.h>
+#include <network/network.h>
+#include <lua/lua.h>
+#include <test/test.h>
+
+static application_t
+test_lua_application(void) {
+	application_t app;
+	memset(&app, 0, sizeof(app));
+	app.name = string_const(STRING_CONST("Lua core tests"));
+	app.short_name = string_const(STRING_CONST("test_lua_core"));
+	app.company = string_const(STRING_CONST("Rampant Pixels"));
+	app.flags = APPLICATION_UTILITY;
+	app.exception_handler = test_exception_handler;
+	return app;
+}
+
+static memory_system_t
+test_lua_memory_system(void) {
+	return memory_system_malloc();
+}
+
+static foundation_config_t
+test_lua_config(void) {
+	foundation_config_t config;
+	memset(&config, 0, sizeof(config));
+	return config;
+}
+
+static void
+test_parse_config(const char* path, size_t path_size,
+                  const char* buffer, size_t size,
+                  const json_token_t* tokens, size_t num_tokens) {
+	resource_module_parse_config(path, path_size, buffer, size, tokens, num_tokens);
+	lua_module_parse_config(path, path_size, buffer, size, tokens, num_tokens);
+}
+
+static int
+test_lua_initialize(void) {
+	lua_config_t lua_config;
+	resource_config_t resource_config;
+	network_config_t network_config;
+
+	memset(&lua_config, 0, sizeof(lua_config));
+	memset(&resource_config, 0, sizeof(resource_config));
+	memset(&network_config, 0, sizeof(network_config));
+
+	lua_config.reload_delay = BUILD_LUA_RELOAD_DELAY;
+
+	resource_config.enable_local_source = true;
+	resource_config.enable_local_cache = true;
+	resource_config.enable_remote_sourced = true;
+	resource_config.enable_remote_compiled = true;
+	resource_config.enable_local_autoimport = true;
+
+	if (network_module_initialize(network_config) < 0)
+		return -1;
+
+	if (resource_module_initialize(resource_config) < 0)
+		return -1;
+
+	if (lua_module_initialize(lua_config) < 0)
+		return -1;
+
+	test_set_suitable_working_directory();
+	test_load_config(test_parse_config);
+
+	return 0;
+}
+
+static void
+test_lua_finalize(void) {
+	lua_module_finalize();
+	resource_module_finalize();
+	network_module_finalize();
+}
+
+static void
+test_lua_event(event_t* event) {
+	resource_event_handle(event);
+}
+
+static lua_heap_entry_t*
+test_lua_heap_entry(lua_heap_snapshot_t* snapshot, lua_heap_group_t group, const char* name,
+                    size_t length) {
+	for (size_t ient = 0, esize = array_size(snapshot->entries); ient < esize; ++ient) {
+		lua_heap_entry_t* entry = snapshot->entries + ient;
+		if ((entry->group == group) && string_equal(STRING_ARGS(entry->name), name, length))
+			return entry;
+	}
+	return nullptr;
+}
+
+DECLARE_TEST(lua, heap) {
+	lua_t* env = lua_allocate();
+	lua_heap_entry_t* entry;
+
+	EXPECT_NE(env, 0);
+
+	lua_heap_snapshot_t* before = lua_heap_snapshot(env);
+	EXPECT_NE(before, 0);
+	EXPECT_GT(before->count, 0);
+	EXPECT_GT(before->bytes, 0);
+
+	string_const_t testcode = string_const(STRING_CONST(
+	    "heaptest = {}\n"
+	    "for i = 1, 1000 do\n"
+	    "  heaptest[i] = { value = i, fn = function() return i end }\n"
+	    "end\n"
+	));
+	EXPECT_EQ(lua_eval_string(env, STRING_ARGS(testcode)), LUA_OK);
+
+	lua_heap_snapshot_t* after = lua_heap_snapshot(env);
+	EXPECT_NE(after, 0);
+	EXPECT_GT(after->bytes, before->bytes);
+
+	lua_heap_snapshot_t* diff = lua_heap_snapshot_diff(before, after);
+	EXPECT_NE(diff, 0);
+	EXPECT_EQ(diff->bytes, after->bytes - before->bytes);
+
+	entry = test_lua_heap_entry(diff, LUAHEAP_TYPE, STRING_CONST("table"));
+	EXPECT_NE(entry, 0);
+	EXPECT_GE(entry->count, 1001);
+
+	entry = test_lua_heap_entry(diff, LUAHEAP_TYPE, STRING_CONST("function"));
+	EXPECT_NE(entry, 0);
+	EXPECT_GE(entry->count, 1000);
+
+	entry = test_lua_heap_entry(diff, LUAHEAP_SITE, STRING_CONST("eval:3"));
+	EXPECT_NE(entry, 0);
+	EXPECT_GE(entry->count, 1000);
+
+	//Write and read back
+	stream_t* stream = buffer_stream_allocate(nullptr, STREAM_IN | STREAM_OUT, 0, 0, true, true);
+	EXPECT_TRUE(lua_heap_snapshot_write(after, stream));
+	stream_seek(stream, 0, STREAM_SEEK_BEGIN);
+	lua_heap_snapshot_t* read = lua_heap_snapshot_read(stream);
+	stream_deallocate(stream);
+
+	EXPECT_NE(read, 0);
+	EXPECT_EQ(read->count, after->count);
+	EXPECT_EQ(read->bytes, after->bytes);
+	EXPECT_EQ(array_size(read->entries), array_size(after->entries));
+
+	lua_heap_snapshot_t* empty = lua_heap_snapshot_diff(after, read);
+	EXPECT_EQ(array_size(empty->entries), 0);
+
+	lua_heap_snapshot_log(diff, 10);
+
+	lua_heap_snapshot_deallocate(empty);
+	lua_heap_snapshot_deallocate(read);
+	lua_heap_snapshot_deallocate(diff);
+	lua_heap_snapshot_deallocate(after);
+	lua_heap_snapshot_deallocate(before);
+
+	lua_deallocate(env);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, profile) {
+	lua_t* env = lua_allocate();
+
+	EXPECT_NE(env, 0);
+	EXPECT_EQ(lua_profile_allocation_sites(env), 0);
+
+	string_const_t testcode = string_const(STRING_CONST(
+	    "local function churn()\n"
+	    "  local t = {}\n"
+	    "  for i = 1, 10000 do\n"
+	    "    t[i] = { i }\n"
+	    "  end\n"
+	    "  return t\n"
+	    "end\n"
+	    "churn()\n"
+	));
+
+	EXPECT_TRUE(lua_profile_allocation_begin(env, 1024));
+	EXPECT_EQ(lua_eval_string(env, STRING_ARGS(testcode)), LUA_OK);
+	lua_profile_allocation_end(env);
+
+	const lua_profile_site_t* sites = lua_profile_allocation_sites(env);
+	const lua_profile_site_t* churn = nullptr;
+	EXPECT_GT(array_size(sites), 0);
+	for (size_t isite = 0, ssize = array_size(sites); isite < ssize; ++isite) {
+		if (string_equal(STRING_ARGS(sites[isite].name), STRING_CONST("eval:4")))
+			churn = sites + isite;
+	}
+	EXPECT_NE(churn, 0);
+	EXPECT_GT(churn->bytes, 1024 * 64);
+
+	//Sampling is stopped, further allocations are not counted
+	int64_t bytes = churn->bytes;
+	EXPECT_EQ(lua_eval_string(env, STRING_ARGS(testcode)), LUA_OK);
+	EXPECT_EQ(churn->bytes, bytes);
+
+	stream_t* stream = buffer_stream_allocate(nullptr, STREAM_IN | STREAM_OUT, 0, 0, true, true);
+	EXPECT_TRUE(lua_profile_allocation_write(env, stream));
+	EXPECT_GT(stream_size(stream), 0);
+	stream_seek(stream, 0, STREAM_SEEK_BEGIN);
+	string_t line = stream_read_line(stream, '\n');
+	EXPECT_NE(string_rfind(STRING_ARGS(line), ' ', STRING_NPOS), STRING_NPOS);
+	string_deallocate(line.str);
+	stream_deallocate(stream);
+
+	lua_profile_allocation_log(env, 10);
+
+	//Engine mode from before sampling is restored
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("jit.off()")), LUA_OK);
+	EXPECT_TRUE(lua_profile_allocation_begin(env, 1024));
+	lua_profile_allocation_end(env);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("assert(not jit.status())")), LUA_OK);
+
+	lua_deallocate(env);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, template) {
+	const size_t count = 8;
+	lua_t* env[8];
+
+	string_const_t warmup = string_const(STRING_CONST(
+	    "local ffi = require(\"ffi\")\n"
+	    "local foundation = require(\"foundation\")\n"
+	));
+	string_const_t testcode = string_const(STRING_CONST(
+	    "assert(package.loaded.foundation ~= nil)\n"
+	));
+
+	//Current path, allocate and warm up on demand
+	tick_t start = time_current();
+	for (size_t ienv = 0; ienv < count; ++ienv) {
+		env[ienv] = lua_allocate();
+		EXPECT_NE(env[ienv], 0);
+		EXPECT_EQ(lua_eval_string(env[ienv], STRING_ARGS(warmup)), LUA_OK);
+	}
+	deltatime_t direct_time = time_elapsed(start);
+	for (size_t ienv = 0; ienv < count; ++ienv)
+		lua_deallocate(env[ienv]);
+
+	lua_template_t* tmpl = lua_template_allocate(STRING_ARGS(warmup), count);
+	EXPECT_NE(tmpl, 0);
+
+	tick_t wait = time_current();
+	while ((lua_template_available(tmpl) < count) && (time_elapsed(wait) < 30.0))
+		thread_sleep(10);
+	EXPECT_EQ(lua_template_available(tmpl), count);
+
+	start = time_current();
+	for (size_t ienv = 0; ienv < count; ++ienv) {
+		env[ienv] = lua_template_instantiate(tmpl);
+		EXPECT_NE(env[ienv], 0);
+	}
+	deltatime_t template_time = time_elapsed(start);
+
+	log_infof(HASH_LUA, STRING_CONST("Startup of %" PRIsize " states: %.3fms direct, %.3fms from template"),
+	          count, direct_time * 1000.0, template_time * 1000.0);
+
+	for (size_t ienv = 0; ienv < count; ++ienv) {
+		EXPECT_EQ(lua_eval_string(env[ienv], STRING_ARGS(testcode)), LUA_OK);
+		lua_deallocate(env[ienv]);
+	}
+
+	//Reserve is refilled in the background, or the state is built on demand
+	lua_t* extra = lua_template_instantiate(tmpl);
+	EXPECT_NE(extra, 0);
+	EXPECT_EQ(lua_eval_string(extra, STRING_ARGS(testcode)), LUA_OK);
+	lua_deallocate(extra);
+
+	lua_template_deallocate(tmpl);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, libraries) {
+	const unsigned int profile[] = {
+		LUALIB_PROFILE_MINIMAL, LUALIB_PROFILE_FFI, LUALIB_PROFILE_FULL
+	};
+	const char* profile_name[] = {"minimal", "ffi", "full"};
+	const size_t count = 32;
+	lua_t* env[32];
+	int64_t bytes[3];
+
+	for (size_t iprof = 0; iprof < 3; ++iprof) {
+		tick_t start = time_current();
+		for (size_t ienv = 0; ienv < count; ++ienv) {
+			env[ienv] = lua_allocate_libraries(profile[iprof]);
+			EXPECT_NE(env[ienv], 0);
+		}
+		deltatime_t elapsed = time_elapsed(start);
+
+		lua_heap_snapshot_t* snapshot = lua_heap_snapshot(env[0]);
+		EXPECT_NE(snapshot, 0);
+		bytes[iprof] = snapshot->bytes;
+		lua_heap_snapshot_deallocate(snapshot);
+
+		log_infof(HASH_LUA, STRING_CONST("Library profile %s: %.2fus and %" PRId64 " bytes per state"),
+		          profile_name[iprof], (elapsed * 1000000.0) / (deltatime_t)count, bytes[iprof]);
+
+		for (size_t ienv = 0; ienv < count; ++ienv)
+			lua_deallocate(env[ienv]);
+	}
+
+	EXPECT_LT(bytes[0], bytes[1]);
+	EXPECT_LT(bytes[1], bytes[2]);
+
+	lua_t* minimal = lua_allocate_libraries(LUALIB_PROFILE_MINIMAL);
+	EXPECT_EQ(lua_eval_string(minimal, STRING_CONST("assert(require == nil)")), LUA_OK);
+	lua_deallocate(minimal);
+
+	lua_t* eager = lua_allocate_libraries(LUALIB_BASE | LUALIB_STRING);
+	EXPECT_EQ(lua_eval_string(eager, STRING_CONST("assert(string.format('%d', 1) == '1')")), LUA_OK);
+	lua_deallocate(eager);
+
+	lua_t* eagerffi = lua_allocate_libraries(LUALIB_BASE | LUALIB_FFI);
+	EXPECT_EQ(lua_eval_string(eagerffi, STRING_CONST("assert(type(ffi) == \"table\" and ffi.new ~= nil)")), LUA_OK);
+	lua_deallocate(eagerffi);
+
+	lua_t* ffi = lua_allocate_libraries(LUALIB_PROFILE_FFI);
+	EXPECT_EQ(lua_eval_string(ffi, STRING_CONST("local ffi = require(\"ffi\")")), LUA_OK);
+	EXPECT_EQ(lua_eval_string(ffi, STRING_CONST("assert(not pcall(require, \"debug\"))")), LUA_OK);
+	lua_deallocate(ffi);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, subenv) {
+	const size_t count = 1000;
+	lua_t* env = lua_allocate();
+	lua_subenv_t* subenv = memory_allocate(HASH_TEST, sizeof(lua_subenv_t) * count, 0, MEMORY_PERSISTENT);
+
+	EXPECT_NE(env, 0);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("shared = 10")), LUA_OK);
+
+	lua_heap_snapshot_t* before = lua_heap_snapshot(env);
+	for (size_t isub = 0; isub < count; ++isub) {
+		subenv[isub] = lua_subenv_allocate(env);
+		EXPECT_GT(subenv[isub], 0);
+	}
+	lua_heap_snapshot_t* after = lua_heap_snapshot(env);
+	int64_t bytes = (after->bytes - before->bytes) / (int64_t)count;
+	log_infof(HASH_LUA, STRING_CONST("Sub-environment cost: %" PRId64 " bytes"), bytes);
+	EXPECT_LT(bytes, 256);
+	lua_heap_snapshot_deallocate(after);
+	lua_heap_snapshot_deallocate(before);
+
+	string_const_t behaviour = string_const(STRING_CONST(
+	    "counter = shared\n"
+	    "entity = { step = 0 }\n"
+	    "function tick(n) counter = counter + n entity.step = entity.step + 1 end\n"
+	));
+	for (size_t isub = 0; isub < count; ++isub)
+		EXPECT_EQ(lua_subenv_eval_string(env, subenv[isub], STRING_ARGS(behaviour)), LUA_OK);
+
+	for (size_t isub = 0; isub < count; ++isub) {
+		EXPECT_EQ(lua_subenv_call_int(env, subenv[isub], STRING_CONST("tick"), (int)isub), LUA_OK);
+		EXPECT_EQ(lua_subenv_call_void(env, subenv[isub], STRING_CONST("tick")), LUA_ERROR);
+	}
+
+	EXPECT_EQ(lua_subenv_eval_string(env, subenv[0], STRING_CONST("assert(counter == 10)")), LUA_OK);
+	EXPECT_EQ(lua_subenv_eval_string(env, subenv[7], STRING_CONST("assert(counter == 17)")), LUA_OK);
+	EXPECT_EQ(lua_subenv_eval_string(env, subenv[7], STRING_CONST("assert(entity.step == 1)")), LUA_OK);
+
+	//Sub-environment globals do not leak into the shared globals
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("assert(counter == nil and tick == nil)")), LUA_OK);
+	EXPECT_EQ(lua_call_void(env, STRING_CONST("tick")), LUA_ERROR);
+
+	for (size_t isub = 0; isub < count; ++isub)
+		lua_subenv_deallocate(env, subenv[isub]);
+	memory_deallocate(subenv);
+
+	lua_deallocate(env);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, modulecache) {
+	lua_t* first = lua_allocate();
+	lua_t* second = lua_allocate();
+
+	EXPECT_NE(first, 0);
+	EXPECT_NE(second, 0);
+
+	lua_module_cache_invalidate(LUA_FOUNDATION_UUID);
+	lua_module_cache_statistics_t initial = lua_module_cache_statistics();
+
+	string_const_t code = string_const(STRING_CONST("local foundation = require(\"foundation\")"));
+	EXPECT_EQ(lua_eval_string(first, STRING_ARGS(code)), LUA_OK);
+	lua_module_cache_statistics_t loaded = lua_module_cache_statistics();
+	EXPECT_EQ(loaded.misses, initial.misses + 1);
+	EXPECT_EQ(loaded.hits, initial.hits);
+	EXPECT_EQ(loaded.count, initial.count + 1);
+	EXPECT_GT(loaded.bytes, initial.bytes);
+
+	EXPECT_EQ(lua_eval_string(second, STRING_ARGS(code)), LUA_OK);
+	lua_module_cache_statistics_t shared = lua_module_cache_statistics();
+	EXPECT_EQ(shared.misses, loaded.misses);
+	EXPECT_EQ(shared.hits, loaded.hits + 1);
+	EXPECT_EQ(shared.bytes_saved, loaded.bytes_saved + (loaded.bytes - initial.bytes));
+
+	//Invalidation drops the blob, the next load reads the resource again
+	lua_module_cache_invalidate(LUA_FOUNDATION_UUID);
+	lua_module_cache_statistics_t invalidated = lua_module_cache_statistics();
+	EXPECT_EQ(invalidated.count, initial.count);
+	EXPECT_EQ(lua_module_reload(first, LUA_FOUNDATION_UUID), 0);
+	EXPECT_EQ(lua_module_cache_statistics().misses, shared.misses + 1);
+
+	lua_deallocate(second);
+	lua_deallocate(first);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, mapped) {
+	const size_t lines = 64 * 1024;
+	string_const_t line = string_const(STRING_CONST("count = count + 1\n"));
+	size_t size = lines * line.length;
+	char* code = memory_allocate(HASH_TEST, size, 0, MEMORY_PERSISTENT);
+	for (size_t iline = 0; iline < lines; ++iline)
+		memcpy(code + (iline * line.length), line.str, line.length);
+
+	string_t path = path_allocate_concat(STRING_ARGS(environment_temporary_directory()),
+	                                     STRING_CONST("lua_mapped.lua"));
+	stream_t* stream = stream_open(STRING_ARGS(path), STREAM_OUT | STREAM_CREATE | STREAM_TRUNCATE | STREAM_BINARY);
+	EXPECT_NE(stream, 0);
+	EXPECT_EQ(stream_write(stream, code, size), size);
+	stream_deallocate(stream);
+
+	//Mapping advances stream position like a read
+	lua_mapping_t mapping;
+	stream = stream_open(STRING_ARGS(path), STREAM_IN | STREAM_BINARY);
+	EXPECT_TRUE(lua_stream_map(stream, size, &mapping));
+	EXPECT_EQ(mapping.length, size);
+	EXPECT_EQ(memcmp(mapping.data, code, size), 0);
+	EXPECT_EQ(stream_tell(stream), size);
+	lua_stream_unmap(&mapping);
+	stream_seek(stream, 0, STREAM_SEEK_BEGIN);
+	EXPECT_FALSE(lua_stream_map(stream, 16, &mapping));
+	EXPECT_EQ(stream_tell(stream), 0);
+	stream_deallocate(stream);
+
+	lua_t* env = lua_allocate();
+	EXPECT_NE(env, 0);
+
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("count = 0")), LUA_OK);
+	stream = stream_open(STRING_ARGS(path), STREAM_IN | STREAM_BINARY);
+	tick_t start = time_current();
+	EXPECT_EQ(lua_eval_stream(env, stream), LUA_OK);
+	deltatime_t mapped = time_ticks_to_seconds(time_diff(start, time_current()));
+	stream_deallocate(stream);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("assert(count == 65536)")), LUA_OK);
+
+	//Memory streams cannot be mapped and fall back to chunked reads
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("count = 0")), LUA_OK);
+	stream = buffer_stream_allocate(code, STREAM_IN | STREAM_BINARY, size, size, false, false);
+	start = time_current();
+	EXPECT_EQ(lua_eval_stream(env, stream), LUA_OK);
+	deltatime_t chunked = time_ticks_to_seconds(time_diff(start, time_current()));
+	stream_deallocate(stream);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("assert(count == 65536)")), LUA_OK);
+
+	log_infof(HASH_LUA, STRING_CONST("Loaded %" PRIsize " bytes: %.2fms mapped, %.2fms chunked"),
+	          size, mapped * 1000.0, chunked * 1000.0);
+
+	lua_deallocate(env);
+
+	fs_remove_file(STRING_ARGS(path));
+	string_deallocate(path.str);
+	memory_deallocate(code);
+
+	return 0;
+}
+
+static int
+test_lua_module_loader(lua_State* state) {
+	lua_modulemap_entry_t* entry = lua_touserdata(state, lua_upvalueindex(2));
+	lua_newtable(state);
+	lua_module_set_loaded(lua_from_state(state), entry);
+	return 1;
+}
+
+DECLARE_TEST(lua, moduleindex) {
+	const int count = 512;
+	char buffer[64];
+	lua_t* env = lua_allocate();
+
+	EXPECT_NE(env, 0);
+
+	for (int imod = 0; imod < count; ++imod) {
+		string_t name = string_format(buffer, sizeof(buffer), STRING_CONST("indexmodule%d"), imod);
+		lua_module_register(STRING_ARGS(name), uuid_make(0x5eed000000000000ULL + (uint64_t)imod, 0x1dULL),
+		                    test_lua_module_loader, nullptr);
+	}
+
+	//Load every other module
+	for (int imod = 0; imod < count; imod += 2) {
+		string_t code = string_format(buffer, sizeof(buffer), STRING_CONST("require(\"indexmodule%d\")"), imod);
+		EXPECT_EQ(lua_eval_string(env, STRING_ARGS(code)), LUA_OK);
+	}
+
+	for (int imod = 0; imod < count; ++imod) {
+		bool expect_loaded = !(imod % 2);
+		string_t name = string_format(buffer, sizeof(buffer), STRING_CONST("indexmodule%d"), imod);
+		EXPECT_EQ(lua_module_is_loaded_name(env, STRING_ARGS(name)), expect_loaded);
+		EXPECT_EQ(lua_module_is_loaded(env, uuid_make(0x5eed000000000000ULL + (uint64_t)imod, 0x1dULL)),
+		          expect_loaded);
+	}
+	EXPECT_FALSE(lua_module_is_loaded(env, uuid_make(0x5eed000000000000ULL, 0x1eULL)));
+	EXPECT_FALSE(lua_module_is_loaded_name(env, STRING_CONST("indexmodule")));
+
+	tick_t start = time_current();
+	size_t found = 0;
+	for (int iloop = 0; iloop < 256; ++iloop) {
+		for (int imod = 0; imod < count; ++imod)
+			found += lua_module_is_loaded(env, uuid_make(0x5eed000000000000ULL + (uint64_t)imod, 0x1dULL)) ? 1 : 0;
+	}
+	deltatime_t elapsed = time_ticks_to_seconds(time_diff(start, time_current()));
+	EXPECT_EQ(found, (size_t)(256 * count / 2));
+	log_infof(HASH_LUA, STRING_CONST("Module lookup: %.1fns"),
+	          (elapsed * 1000000000.0) / (deltatime_t)(256 * count));
+
+	lua_deallocate(env);
+
+	return 0;
+}
+
+static atomic32_t test_lua_concurrent_failed;
+
+static void*
+test_lua_concurrent_thread(void* arg) {
+	char buffer[64];
+	FOUNDATION_UNUSED(arg);
+	for (int istate = 0; istate < 16; ++istate) {
+		lua_t* env = lua_allocate();
+		for (int imod = 0; imod < 64; ++imod) {
+			string_t code = string_format(buffer, sizeof(buffer),
+			                              STRING_CONST("require(\"concurrentmodule%d\")"), imod);
+			if (lua_eval_string(env, STRING_ARGS(code)) != LUA_OK)
+				atomic_incr32(&test_lua_concurrent_failed, memory_order_relaxed);
+		}
+		lua_deallocate(env);
+	}
+	return 0;
+}
+
+static void*
+test_lua_register_thread(void* arg) {
+	char buffer[64];
+	FOUNDATION_UNUSED(arg);
+	for (int imod = 0; imod < 256; ++imod) {
+		string_t name = string_format(buffer, sizeof(buffer), STRING_CONST("growmodule%d"), imod);
+		lua_module_register(STRING_ARGS(name), uuid_make(0x6eed000000000000ULL + (uint64_t)imod, 0x1dULL),
+		                    test_lua_module_loader, nullptr);
+	}
+	return 0;
+}
+
+DECLARE_TEST(lua, modulemap) {
+	char buffer[64];
+	thread_t thread[8];
+	thread_t writer;
+
+	for (int imod = 0; imod < 64; ++imod) {
+		string_t name = string_format(buffer, sizeof(buffer), STRING_CONST("concurrentmodule%d"), imod);
+		lua_module_register(STRING_ARGS(name), uuid_make(0x7eed000000000000ULL + (uint64_t)imod, 0x1dULL),
+		                    test_lua_module_loader, nullptr);
+	}
+
+	//Concurrent state startup while the map grows from another thread
+	atomic_store32(&test_lua_concurrent_failed, 0, memory_order_relaxed);
+	thread_initialize(&writer, test_lua_register_thread, nullptr, STRING_CONST("register"),
+	                  THREAD_PRIORITY_NORMAL, 0);
+	for (size_t ith = 0; ith < sizeof(thread) / sizeof(thread[0]); ++ith)
+		thread_initialize(&thread[ith], test_lua_concurrent_thread, nullptr, STRING_CONST("startup"),
+		                  THREAD_PRIORITY_NORMAL, 0);
+
+	tick_t start = time_current();
+	thread_start(&writer);
+	for (size_t ith = 0; ith < sizeof(thread) / sizeof(thread[0]); ++ith)
+		thread_start(&thread[ith]);
+	for (size_t ith = 0; ith < sizeof(thread) / sizeof(thread[0]); ++ith)
+		thread_finalize(&thread[ith]);
+	deltatime_t elapsed = time_ticks_to_seconds(time_diff(start, time_current()));
+	thread_finalize(&writer);
+
+	EXPECT_EQ(atomic_load32(&test_lua_concurrent_failed, memory_order_relaxed), 0);
+	log_infof(HASH_LUA, STRING_CONST("Concurrent startup of %d states with 64 requires each: %.2fms"),
+	          (int)(16 * (sizeof(thread) / sizeof(thread[0]))), elapsed * 1000.0);
+
+	lua_t* env = lua_allocate();
+	for (int imod = 0; imod < 256; imod += 17) {
+		string_t code = string_format(buffer, sizeof(buffer), STRING_CONST("require(\"growmodule%d\")"), imod);
+		EXPECT_EQ(lua_eval_string(env, STRING_ARGS(code)), LUA_OK);
+	}
+	lua_deallocate(env);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, lazymodule) {
+	lua_t* env = lua_allocate();
+	EXPECT_NE(env, 0);
+
+	lua_module_set_lazy(env, true);
+
+	tick_t start = time_current();
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("lazyfoundation = require(\"foundation\")")), LUA_OK);
+	deltatime_t required = time_ticks_to_seconds(time_diff(start, time_current()));
+	EXPECT_FALSE(lua_module_is_loaded(env, LUA_FOUNDATION_UUID));
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("assert(next(lazyfoundation) == nil)")), LUA_OK);
+
+	//First field access loads the module into the proxy table
+	start = time_current();
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("assert(lazyfoundation.log ~= nil)")), LUA_OK);
+	deltatime_t accessed = time_ticks_to_seconds(time_diff(start, time_current()));
+	EXPECT_TRUE(lua_module_is_loaded(env, LUA_FOUNDATION_UUID));
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST(
+	    "assert(require(\"foundation\") == lazyfoundation)\n"
+	    "assert(lazyfoundation.__modulename == \"foundation\")\n"
+	)), LUA_OK);
+
+	log_infof(HASH_LUA, STRING_CONST("Lazy module require: %.3fms, first access: %.3fms"),
+	          required * 1000.0, accessed * 1000.0);
+
+	lua_deallocate(env);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, prefetch) {
+	uuid_t uuids[] = { LUA_FOUNDATION_UUID, LUA_NETWORK_UUID, LUA_RESOURCE_UUID, LUA_WINDOW_UUID };
+	const size_t count = sizeof(uuids) / sizeof(uuids[0]);
+	char buffer[256];
+
+	for (size_t imod = 0; imod < count; ++imod)
+		lua_module_cache_invalidate(uuids[imod]);
+
+	lua_module_cache_statistics_t initial = lua_module_cache_statistics();
+	tick_t start = time_current();
+	EXPECT_EQ(lua_module_prefetch(uuids, count), count);
+	deltatime_t elapsed = time_ticks_to_seconds(time_diff(start, time_current()));
+	lua_module_cache_statistics_t prefetched = lua_module_cache_statistics();
+	EXPECT_EQ(prefetched.count, initial.count + count);
+	log_infof(HASH_LUA, STRING_CONST("Prefetched %" PRIsize " modules: %.2fms"), count, elapsed * 1000.0);
+
+	//Requires are served from the cache
+	lua_t* env = lua_allocate();
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("require(\"foundation\") require(\"resource\")")), LUA_OK);
+	EXPECT_EQ(lua_module_cache_statistics().misses, prefetched.misses);
+	lua_deallocate(env);
+
+	//Manifest lists window depending on foundation and resource, network standalone
+	for (size_t imod = 0; imod < count; ++imod)
+		lua_module_cache_invalidate(uuids[imod]);
+	char uuidbuf[4][40];
+	string_t uuidstr[4];
+	for (size_t imod = 0; imod < count; ++imod)
+		uuidstr[imod] = string_from_uuid(uuidbuf[imod], sizeof(uuidbuf[imod]), uuids[imod]);
+	string_t manifest = string_format(buffer, sizeof(buffer),
+	                                  STRING_CONST("# module dependencies\n%.*s %.*s\t%.*s\n\n%.*s\n"),
+	                                  STRING_FORMAT(uuidstr[3]), STRING_FORMAT(uuidstr[0]),
+	                                  STRING_FORMAT(uuidstr[2]), STRING_FORMAT(uuidstr[1]));
+
+	stream_t* stream = buffer_stream_allocate(manifest.str, STREAM_IN, manifest.length, manifest.length, false, false);
+	EXPECT_EQ(lua_module_prefetch_manifest(stream, uuids[3]), 3);
+	stream_deallocate(stream);
+	EXPECT_EQ(lua_module_cache_statistics().count, initial.count + 3);
+
+	stream = buffer_stream_allocate(manifest.str, STREAM_IN, manifest.length, manifest.length, false, false);
+	EXPECT_EQ(lua_module_prefetch_manifest(stream, uuid_null()), count);
+	stream_deallocate(stream);
+	EXPECT_EQ(lua_module_cache_statistics().count, initial.count + count);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, reloadall) {
+	lua_t* env[3];
+	const size_t count = sizeof(env) / sizeof(env[0]);
+
+	for (size_t ienv = 0; ienv < count; ++ienv) {
+		env[ienv] = lua_allocate();
+		EXPECT_NE(env[ienv], 0);
+		EXPECT_EQ(lua_eval_string(env[ienv], STRING_CONST(
+		    "reloadfoundation = require(\"foundation\")")), LUA_OK);
+	}
+
+	lua_module_cache_invalidate(LUA_FOUNDATION_UUID);
+	lua_module_cache_statistics_t before = lua_module_cache_statistics();
+
+	//One load serves every state
+	lua_module_reload_all(LUA_FOUNDATION_UUID);
+	lua_module_cache_statistics_t after = lua_module_cache_statistics();
+	EXPECT_EQ(after.misses, before.misses + 1);
+	EXPECT_EQ(after.hits, before.hits);
+
+	//Resources not loaded as a module in any state are never opened
+	lua_module_reload_all(uuid_make(0x0ad0000000000000ULL, 0x37ULL));
+	EXPECT_EQ(lua_module_cache_statistics().misses, after.misses);
+	EXPECT_EQ(lua_module_cache_statistics().opens, after.opens);
+
+	for (size_t ienv = 0; ienv < count; ++ienv) {
+		EXPECT_TRUE(lua_module_is_loaded(env[ienv], LUA_FOUNDATION_UUID));
+		EXPECT_EQ(lua_eval_string(env[ienv], STRING_CONST(
+		    "assert(require(\"foundation\") == reloadfoundation)\n"
+		    "assert(reloadfoundation.log ~= nil)\n"
+		)), LUA_OK);
+		lua_deallocate(env[ienv]);
+	}
+
+	return 0;
+}
+
+DECLARE_TEST(lua, reloadpatch) {
+	lua_t* env = lua_allocate();
+	EXPECT_NE(env, 0);
+
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST(
+	    "patchfoundation = require(\"foundation\")\n"
+	    "patchlog = patchfoundation.log\n"
+	    "patchfoundation.runtimefield = 7\n"
+	)), LUA_OK);
+
+	//Unchanged source keeps module state, tables and runtime fields
+	EXPECT_EQ(lua_module_reload(env, LUA_FOUNDATION_UUID), 0);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST(
+	    "assert(require(\"foundation\") == patchfoundation)\n"
+	    "assert(patchfoundation.log == patchlog)\n"
+	    "assert(patchfoundation.runtimefield == 7)\n"
+	    "assert(patchfoundation.__modulename == \"foundation\")\n"
+	)), LUA_OK);
+
+	lua_deallocate(env);
+
+	//Module source changes, written as bundled source text which loads like bytecode
+	const uuid_t patchuuid = uuid_make(0x9a7c000000000000ULL, 0x38ULL);
+	const char* version[] = {
+		"local M = {} local counter = 0 local private = 10\n"
+		"M.value = 1 M.config = {a = 1} M.list = {1, 2} M.gone = 5\n"
+		"function M.inc() counter = counter + 1 return counter end\n"
+		"function M.peek() return counter, \"old\" end\n"
+		"function M.bump() private = private + 1 return private end\n"
+		"function M.drop() end\n"
+		"return M\n",
+		"local M = {} local counter = 0 local private = 10\n"
+		"M.value = 2 M.config = {a = 1} M.list = {1, 2, 5}\n"
+		"function M.inc() counter = counter + 1 return counter end\n"
+		"function M.peek() return counter, \"new\" end\n"
+		"function M.bump() private = private + 2 return private end\n"
+		"function M.self() return M end\n"
+		"return M\n"
+	};
+	stream_t* stream = resource_local_create_static(patchuuid, lua_resource_platform());
+	EXPECT_NE(stream, 0);
+	EXPECT_TRUE(lua_module_write_bundle(stream, uint256_null(), version[0], string_length(version[0])));
+	stream_deallocate(stream);
+	lua_module_register(STRING_CONST("patchmodule"), patchuuid, lua_module_loader, nullptr);
+
+	env = lua_allocate();
+	EXPECT_NE(env, 0);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST(
+	    "patchmodule = require(\"patchmodule\")\n"
+	    "patchinc = patchmodule.inc\n"
+	    "patchmodule.inc() patchmodule.inc() patchmodule.bump()\n"
+	    "patchmodule.config.a = 9\n"
+	)), LUA_OK);
+
+	stream = resource_local_create_static(patchuuid, lua_resource_platform());
+	EXPECT_NE(stream, 0);
+	EXPECT_TRUE(lua_module_write_bundle(stream, uint256_null(), version[1], string_length(version[1])));
+	stream_deallocate(stream);
+	lua_module_cache_invalidate(patchuuid);
+
+	//Changed functions are patched and share module locals with unchanged functions, changed
+	//data fields and tables are replaced, unchanged tables keep runtime state, removed fields go
+	EXPECT_EQ(lua_module_reload(env, patchuuid), 0);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST(
+	    "assert(require(\"patchmodule\") == patchmodule)\n"
+	    "assert(patchmodule.inc == patchinc)\n"
+	    "local count, tag = patchmodule.peek()\n"
+	    "assert(tag == \"new\" and count == 2)\n"
+	    "assert(patchmodule.inc() == 3 and patchmodule.peek() == 3)\n"
+	    "assert(patchmodule.bump() == 13)\n"
+	    "assert(patchmodule.self() == patchmodule)\n"
+	    "assert(patchmodule.value == 2)\n"
+	    "assert(patchmodule.config.a == 9)\n"
+	    "assert(#patchmodule.list == 3 and patchmodule.list[3] == 5)\n"
+	    "assert(patchmodule.gone == nil and patchmodule.drop == nil)\n"
+	)), LUA_OK);
+
+	lua_deallocate(env);
+	lua_module_cache_invalidate(patchuuid);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, reloadbatch) {
+	lua_t* env[2];
+	const size_t count = sizeof(env) / sizeof(env[0]);
+
+	for (size_t ienv = 0; ienv < count; ++ienv) {
+		env[ienv] = lua_allocate();
+		EXPECT_NE(env[ienv], 0);
+		EXPECT_EQ(lua_eval_string(env[ienv], STRING_CONST(
+		    "batchfoundation = require(\"foundation\")")), LUA_OK);
+	}
+
+	lua_module_cache_statistics_t before = lua_module_cache_statistics();
+
+	//Burst of events for the same module is coalesced into one reload
+	for (int ievent = 0; ievent < 8; ++ievent)
+		lua_event_queue_reload(LUA_FOUNDATION_UUID, true);
+
+	EXPECT_GT(lua_event_process_reloads(false), 0);
+	EXPECT_EQ(lua_module_cache_statistics().misses, before.misses);
+
+	EXPECT_EQ(lua_event_process_reloads(true), 0);
+	EXPECT_EQ(lua_module_cache_statistics().misses, before.misses + 1);
+	EXPECT_EQ(lua_event_process_reloads(false), 0);
+
+	for (size_t ienv = 0; ienv < count; ++ienv) {
+		EXPECT_EQ(lua_eval_string(env[ienv], STRING_CONST(
+		    "assert(require(\"foundation\") == batchfoundation)\n"
+		    "assert(batchfoundation.log ~= nil)\n"
+		)), LUA_OK);
+		lua_deallocate(env[ienv]);
+	}
+
+	return 0;
+}
+
+//Graph test modules, graphtop requires graphmid which requires graphbase
+static int
+test_lua_graph_loader(lua_State* state) {
+	lua_modulemap_entry_t* entry = lua_touserdata(state, lua_upvalueindex(2));
+	lua_t* env = lua_from_state(state);
+	if (entry->name == hash(STRING_CONST("graphtop")))
+		lua_eval_string(env, STRING_CONST("require(\"graphmid\")"));
+	else if (entry->name == hash(STRING_CONST("graphmid")))
+		lua_eval_string(env, STRING_CONST("require(\"graphbase\")"));
+	lua_newtable(state);
+	lua_module_set_loaded(env, entry);
+	return 1;
+}
+
+DECLARE_TEST(lua, modulegraph) {
+	const uuid_t base = uuid_make(0x9eed000000000000ULL, 0x1dULL);
+	const uuid_t mid = uuid_make(0x9eed000000000001ULL, 0x1dULL);
+	const uuid_t top = uuid_make(0x9eed000000000002ULL, 0x1dULL);
+	const uuid_t other = uuid_make(0x9eed000000000003ULL, 0x1dULL);
+	uuid_t uuids[4];
+
+	lua_module_register(STRING_CONST("graphbase"), base, test_lua_graph_loader, nullptr);
+	lua_module_register(STRING_CONST("graphmid"), mid, test_lua_graph_loader, nullptr);
+	lua_module_register(STRING_CONST("graphtop"), top, test_lua_graph_loader, nullptr);
+	lua_module_register(STRING_CONST("graphother"), other, test_lua_graph_loader, nullptr);
+
+	lua_t* env = lua_allocate();
+	EXPECT_NE(env, 0);
+
+	//Require of an already loaded module is recorded too
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST(
+	    "require(\"graphtop\")\n"
+	    "require(\"graphother\")\n"
+	    "require(\"graphbase\")\n"
+	)), LUA_OK);
+
+	EXPECT_EQ(lua_module_dependencies(env, top, uuids, 4), 1);
+	EXPECT_TRUE(uuid_equal(uuids[0], mid));
+	EXPECT_EQ(lua_module_dependencies(env, mid, uuids, 4), 1);
+	EXPECT_TRUE(uuid_equal(uuids[0], base));
+	EXPECT_EQ(lua_module_dependencies(env, base, uuids, 4), 0);
+	EXPECT_EQ(lua_module_dependencies(env, uuid_null(), uuids, 4), 3);
+
+	EXPECT_EQ(lua_module_dependents(env, base, uuids, 4), 2);
+	EXPECT_TRUE(uuid_equal(uuids[0], mid));
+	EXPECT_TRUE(uuid_equal(uuids[1], top));
+	EXPECT_EQ(lua_module_dependents(env, mid, uuids, 1), 1);
+	EXPECT_TRUE(uuid_equal(uuids[0], top));
+	EXPECT_EQ(lua_module_dependents(env, top, uuids, 4), 0);
+	EXPECT_EQ(lua_module_dependents(env, other, uuids, 4), 0);
+
+	lua_deallocate(env);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, evalcache) {
+	const char* snippet[] = {
+		"evalcounter = (evalcounter or 0) + 1",
+		"local a, b = 3, 4 evalhyp = math.sqrt(a * a + b * b)",
+		"evaltable = { x = 1, y = 2 }",
+		"if evalcounter > 10 then evalflag = true end"
+	};
+	const size_t snippets = sizeof(snippet) / sizeof(snippet[0]);
+	const size_t loops = 4096;
+	lua_t* env = lua_allocate();
+	EXPECT_NE(env, 0);
+
+	//Same snippets without and with the cache
+	lua_eval_cache_configure(env, 0, 0);
+	tick_t start = time_current();
+	for (size_t iloop = 0; iloop < loops; ++iloop)
+		lua_eval_string(env, snippet[iloop % snippets], string_length(snippet[iloop % snippets]));
+	deltatime_t uncached = time_ticks_to_seconds(time_diff(start, time_current()));
+
+	lua_eval_cache_statistics_t statistics = lua_eval_cache_statistics(env);
+	EXPECT_EQ(statistics.hits, 0);
+	EXPECT_EQ(statistics.count, 0);
+
+	lua_eval_cache_configure(env, BUILD_LUA_EVAL_CACHE_CAPACITY, BUILD_LUA_EVAL_CACHE_LIMIT);
+	start = time_current();
+	for (size_t iloop = 0; iloop < loops; ++iloop)
+		lua_eval_string(env, snippet[iloop % snippets], string_length(snippet[iloop % snippets]));
+	deltatime_t cached = time_ticks_to_seconds(time_diff(start, time_current()));
+
+	statistics = lua_eval_cache_statistics(env);
+	EXPECT_EQ(statistics.misses, snippets);
+	EXPECT_EQ(statistics.hits, loops - snippets);
+	EXPECT_EQ(statistics.count, snippets);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("assert(evalcounter == 2048 and evalhyp == 5)")), LUA_OK);
+
+	log_infof(HASH_LUA, STRING_CONST("Eval of %" PRIsize " small snippets: %.3fms uncached, %.3fms cached (%.1fx)"),
+	          loops, uncached * 1000.0, cached * 1000.0, cached > 0 ? uncached / cached : 0.0);
+
+	//Least recently used chunks are evicted at capacity
+	lua_eval_cache_configure(env, 2, BUILD_LUA_EVAL_CACHE_LIMIT);
+	statistics = lua_eval_cache_statistics(env);
+	EXPECT_EQ(statistics.count, 2);
+	EXPECT_EQ(statistics.evictions, snippets - 2);
+	lua_eval_string(env, snippet[0], string_length(snippet[0]));
+	EXPECT_EQ(lua_eval_cache_statistics(env).misses, statistics.misses + 1);
+	lua_eval_string(env, snippet[snippets - 1], string_length(snippet[snippets - 1]));
+	EXPECT_EQ(lua_eval_cache_statistics(env).hits, statistics.hits + 1);
+
+	//Sources larger than the byte limit are never cached
+	lua_eval_cache_configure(env, 2, 8);
+	EXPECT_EQ(lua_eval_cache_statistics(env).count, 0);
+	lua_eval_string(env, snippet[0], string_length(snippet[0]));
+	EXPECT_EQ(lua_eval_cache_statistics(env).count, 0);
+
+	lua_deallocate(env);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, bundle) {
+	const uuid_t bundled = uuid_make(0xb0dd1e0000000000ULL, 0x1dULL);
+	const uint64_t platform = lua_resource_platform();
+	const uuid_t uuids[2] = {LUA_FOUNDATION_UUID, bundled};
+	const int loads = 64;
+
+	//Measures loads from resource streams, not the built-in modules
+	lua_archive_unmount(STRING_CONST(LUA_ARCHIVE_EMBEDDED));
+
+	//Make sure compiled foundation module exists, then bundle a copy of its bytecode
+	EXPECT_EQ(lua_module_prefetch(uuids, 1), 1);
+	stream_t* stream = resource_stream_open_dynamic(LUA_FOUNDATION_UUID, platform);
+	EXPECT_NE(stream, 0);
+	EXPECT_EQ(stream_read_uint32(stream), LUA_RESOURCE_MODULE_VERSION);
+	size_t size = (size_t)stream_read_uint64(stream);
+	void* bytecode = memory_allocate(HASH_LUA, size, 0, MEMORY_PERSISTENT);
+	EXPECT_EQ(stream_read(stream, bytecode, size), size);
+	stream_deallocate(stream);
+
+	stream = resource_local_create_static(bundled, platform);
+	EXPECT_NE(stream, 0);
+	EXPECT_TRUE(lua_module_write_bundle(stream, uint256_null(), bytecode, size));
+	stream_deallocate(stream);
+	memory_deallocate(bytecode);
+
+	lua_module_register(STRING_CONST("bundledfoundation"), bundled, lua_module_loader,
+	                    lua_symbol_load_foundation);
+
+	//Stream opens and time per load for separate and bundled streams
+	size_t opens[2];
+	deltatime_t elapsed[2];
+	for (int iformat = 0; iformat < 2; ++iformat) {
+		lua_module_cache_statistics_t before = lua_module_cache_statistics();
+		tick_t start = time_current();
+		for (int iload = 0; iload < loads; ++iload) {
+			lua_module_cache_invalidate(uuids[iformat]);
+			EXPECT_EQ(lua_module_prefetch(&uuids[iformat], 1), 1);
+		}
+		elapsed[iformat] = time_ticks_to_seconds(time_diff(start, time_current()));
+		opens[iformat] = lua_module_cache_statistics().opens - before.opens;
+	}
+	EXPECT_GE(opens[0], (size_t)(2 * loads));
+	EXPECT_EQ(opens[1], (size_t)loads);
+	log_infof(HASH_LUA, STRING_CONST("Module load: %.1f opens %.3fms separate streams, %.1f opens %.3fms bundled"),
+	          (double)opens[0] / (double)loads, (elapsed[0] * 1000.0) / (double)loads,
+	          (double)opens[1] / (double)loads, (elapsed[1] * 1000.0) / (double)loads);
+
+	lua_t* env = lua_allocate();
+	EXPECT_NE(env, 0);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST(
+	    "assert(require(\"bundledfoundation\").log ~= nil)")), LUA_OK);
+	EXPECT_EQ(lua_eval_resource(env, bundled), LUA_OK);
+	lua_deallocate(env);
+
+	lua_archive_mount_embedded();
+
+	return 0;
+}
+
+DECLARE_TEST(lua, archive) {
+	const uuid_t uuids[] = {LUA_FOUNDATION_UUID, LUA_NETWORK_UUID, LUA_RESOURCE_UUID, LUA_WINDOW_UUID};
+	const size_t count = sizeof(uuids) / sizeof(uuids[0]);
+	const uint64_t platform = lua_resource_platform();
+	const uint64_t platforms[] = {platform, platform, platform, platform};
+	const int rounds = 16;
+
+	lua_archive_unmount(STRING_CONST(LUA_ARCHIVE_EMBEDDED));
+
+	//Pack compiled modules in an archive
+	EXPECT_EQ(lua_module_prefetch(uuids, count), count);
+	string_t path = path_allocate_concat(STRING_ARGS(environment_temporary_directory()),
+	                                     STRING_CONST("lua_modules.archive"));
+	stream_t* stream = stream_open(STRING_ARGS(path), STREAM_OUT | STREAM_CREATE | STREAM_TRUNCATE | STREAM_BINARY);
+	EXPECT_NE(stream, 0);
+	EXPECT_TRUE(lua_archive_write(stream, uuids, platforms, count));
+	stream_deallocate(stream);
+
+	//Cold startup loading all modules from resource streams and from a mounted archive
+	size_t opens[2];
+	deltatime_t elapsed[2];
+	for (int iformat = 0; iformat < 2; ++iformat) {
+		tick_t start = time_current();
+		if (iformat)
+			EXPECT_TRUE(lua_archive_mount(STRING_ARGS(path)));
+		lua_module_cache_statistics_t before = lua_module_cache_statistics();
+		for (int iround = 0; iround < rounds; ++iround) {
+			for (size_t imod = 0; imod < count; ++imod)
+				lua_module_cache_invalidate(uuids[imod]);
+			EXPECT_EQ(lua_module_prefetch(uuids, count), count);
+		}
+		elapsed[iformat] = time_ticks_to_seconds(time_diff(start, time_current()));
+		lua_module_cache_statistics_t after = lua_module_cache_statistics();
+		opens[iformat] = after.opens - before.opens;
+		EXPECT_EQ(after.archived - before.archived, iformat ? count * (size_t)rounds : 0);
+	}
+	EXPECT_GE(opens[0], 2 * count * (size_t)rounds);
+	EXPECT_EQ(opens[1], 0);
+	EXPECT_EQ(lua_archive_count(), 1);
+	log_infof(HASH_LUA, STRING_CONST("Cold startup of %" PRIsize " modules: %" PRIsize " opens %.3fms from resources, "
+	                                 "1 open %.3fms from archive"),
+	          count, opens[0] / (size_t)rounds, (elapsed[0] * 1000.0) / (double)rounds,
+	          (elapsed[1] * 1000.0) / (double)rounds);
+
+	lua_t* env = lua_allocate();
+	EXPECT_NE(env, 0);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("assert(require(\"foundation\").log ~= nil)")), LUA_OK);
+	EXPECT_EQ(lua_eval_resource(env, LUA_NETWORK_UUID), LUA_OK);
+	lua_deallocate(env);
+
+	//Modified modules fall back to resource streams
+	lua_module_cache_statistics_t before = lua_module_cache_statistics();
+	lua_event_queue_reload(LUA_WINDOW_UUID, true);
+	EXPECT_EQ(lua_module_prefetch(uuids + 3, 1), 1);
+	lua_event_process_reloads(true);
+	EXPECT_GT(lua_module_cache_statistics().opens, before.opens);
+	EXPECT_EQ(lua_module_cache_statistics().archived, before.archived);
+
+	lua_archive_unmount(STRING_ARGS(path));
+	EXPECT_EQ(lua_archive_count(), 0);
+	for (size_t imod = 0; imod < count; ++imod)
+		lua_module_cache_invalidate(uuids[imod]);
+	fs_remove_file(STRING_ARGS(path));
+	string_deallocate(path.str);
+
+	lua_archive_mount_embedded();
+
+	return 0;
+}
+
+DECLARE_TEST(lua, embedded) {
+	const uuid_t uuids[] = {LUA_FOUNDATION_UUID, LUA_NETWORK_UUID, LUA_RESOURCE_UUID, LUA_WINDOW_UUID};
+	const size_t count = sizeof(uuids) / sizeof(uuids[0]);
+
+	//Library built without embedded modules
+	if (!lua_archive_mount_embedded())
+		return 0;
+	EXPECT_EQ(lua_archive_count(), 1);
+
+	//Built-in modules load from memory without opening any resource stream, modules with headers
+	//not regenerated after their script in resource/script changed load from resources
+	for (size_t imod = 0; imod < count; ++imod)
+		lua_module_cache_invalidate(uuids[imod]);
+	lua_module_cache_statistics_t before = lua_module_cache_statistics();
+	EXPECT_EQ(lua_module_prefetch(uuids, count), count);
+	lua_module_cache_statistics_t after = lua_module_cache_statistics();
+	EXPECT_EQ(after.opens, before.opens);
+	EXPECT_EQ(after.archived - before.archived, count);
+
+	lua_t* env = lua_allocate();
+	EXPECT_NE(env, 0);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("assert(require(\"foundation\").log ~= nil)")), LUA_OK);
+	EXPECT_EQ(lua_eval_resource(env, LUA_NETWORK_UUID), LUA_OK);
+	lua_deallocate(env);
+
+	//Modified modules fall back to resource streams
+	before = lua_module_cache_statistics();
+	lua_event_queue_reload(LUA_WINDOW_UUID, true);
+	EXPECT_EQ(lua_module_prefetch(uuids + 3, 1), 1);
+	lua_event_process_reloads(true);
+	EXPECT_GT(lua_module_cache_statistics().opens, before.opens);
+	EXPECT_EQ(lua_module_cache_statistics().archived, before.archived);
+
+	lua_archive_unmount(STRING_CONST(LUA_ARCHIVE_EMBEDDED));
+	EXPECT_EQ(lua_archive_count(), 0);
+	for (size_t imod = 0; imod < count; ++imod)
+		lua_module_cache_invalidate(uuids[imod]);
+
+	//Remounted for the following tests, like after lua_module_initialize
+	lua_archive_mount_embedded();
+
+	return 0;
+}
+
+DECLARE_TEST(lua, compress) {
+	const uuid_t uuids[] = {LUA_FOUNDATION_UUID, LUA_NETWORK_UUID, LUA_RESOURCE_UUID, LUA_WINDOW_UUID};
+	const char* names[] = {"foundation", "network", "resource", "window"};
+	const size_t count = sizeof(uuids) / sizeof(uuids[0]);
+	const uuid_t compressed_uuid[2] = {uuid_make(0xc0c0c0c000000000ULL, 0x1ULL), uuid_make(0xc0c0c0c000000000ULL, 0x2ULL)};
+	const uint64_t platform = lua_resource_platform();
+	const int loads = 64;
+	void* foundation = nullptr;
+	size_t foundation_size = 0;
+
+	lua_archive_unmount(STRING_CONST(LUA_ARCHIVE_EMBEDDED));
+
+	//Size and decompression speed table of the bundled scripts
+	EXPECT_EQ(lua_module_prefetch(uuids, count), count);
+	for (size_t imod = 0; imod < count; ++imod) {
+		stream_t* stream = resource_stream_open_dynamic(uuids[imod], platform);
+		EXPECT_NE(stream, 0);
+		EXPECT_EQ(stream_read_uint32(stream), LUA_RESOURCE_MODULE_VERSION);
+		size_t size = (size_t)stream_read_uint64(stream);
+		void* bytecode = memory_allocate(HASH_LUA, size, 0, MEMORY_PERSISTENT);
+		EXPECT_EQ(stream_read(stream, bytecode, size), size);
+		stream_deallocate(stream);
+
+		size_t capacity = lua_compress_bound(size);
+		void* compressed = memory_allocate(HASH_LUA, capacity, 0, MEMORY_PERSISTENT);
+		void* decompressed = memory_allocate(HASH_LUA, size, 0, MEMORY_PERSISTENT);
+		size_t compressed_size = lua_compress(bytecode, size, compressed, capacity);
+		EXPECT_GT(compressed_size, 0);
+		EXPECT_LT(compressed_size, size);
+
+		tick_t start = time_current();
+		for (int iload = 0; iload < loads; ++iload)
+			EXPECT_TRUE(lua_decompress(compressed, compressed_size, decompressed, size));
+		deltatime_t elapsed = time_ticks_to_seconds(time_diff(start, time_current())) / (deltatime_t)loads;
+		EXPECT_EQ(memcmp(decompressed, bytecode, size), 0);
+		EXPECT_FALSE(lua_decompress(compressed, compressed_size, decompressed, size - 1));
+		EXPECT_FALSE(lua_decompress(compressed, compressed_size - 1, decompressed, size));
+
+		log_infof(HASH_LUA, STRING_CONST("%-10s %7" PRIsize " bytes -> %7" PRIsize " bytes (%5.1f%%) %.3fms decompress (%.0f MiB/s)"),
+		          names[imod], size, compressed_size, (100.0 * (double)compressed_size) / (double)size, elapsed * 1000.0,
+		          (elapsed > 0) ? ((double)size / (1024.0 * 1024.0)) / elapsed : 0.0);
+
+		memory_deallocate(compressed);
+		memory_deallocate(decompressed);
+		if (imod) {
+			memory_deallocate(bytecode);
+		}
+		else {
+			foundation = bytecode;
+			foundation_size = size;
+		}
+	}
+
+	//Compressed dynamic stream and compressed bundle of the foundation module bytecode
+	stream_t* stream = resource_local_create_static(compressed_uuid[0], platform);
+	EXPECT_NE(stream, 0);
+	resource_header_t header = {
+		.type = HASH_LUA,
+		.version = LUA_RESOURCE_MODULE_VERSION,
+		.source_hash = uint256_null()
+	};
+	resource_stream_write_header(stream, header);
+	stream_deallocate(stream);
+	stream = resource_local_create_dynamic(compressed_uuid[0], platform);
+	EXPECT_NE(stream, 0);
+	EXPECT_TRUE(lua_module_write_bytecode(stream, foundation, foundation_size, false, true));
+	EXPECT_LT(stream_size(stream), foundation_size);
+	stream_deallocate(stream);
+
+	stream = resource_local_create_static(compressed_uuid[1], platform);
+	EXPECT_NE(stream, 0);
+	header.version = LUA_RESOURCE_BUNDLE_VERSION;
+	resource_stream_write_header(stream, header);
+	EXPECT_TRUE(lua_module_write_bytecode(stream, foundation, foundation_size, true, true));
+	stream_deallocate(stream);
+	memory_deallocate(foundation);
+
+	lua_module_register(STRING_CONST("compressedfoundation"), compressed_uuid[0], lua_module_loader,
+	                    lua_symbol_load_foundation);
+	lua_module_register(STRING_CONST("compressedbundle"), compressed_uuid[1], lua_module_loader,
+	                    lua_symbol_load_foundation);
+
+	lua_t* env = lua_allocate();
+	EXPECT_NE(env, 0);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST(
+	    "assert(require(\"compressedfoundation\").log ~= nil)\n"
+	    "assert(require(\"compressedbundle\").log ~= nil)")), LUA_OK);
+	EXPECT_EQ(lua_eval_resource(env, compressed_uuid[0]), LUA_OK);
+	EXPECT_EQ(lua_eval_resource(env, compressed_uuid[1]), LUA_OK);
+	lua_deallocate(env);
+
+	lua_archive_mount_embedded();
+
+	return 0;
+}
+
+DECLARE_TEST(lua, compile) {
+	void* bytecode = nullptr;
+	size_t size = 0;
+
+	//Chunks are never executed when compiled
+	string_const_t failing = string_const(STRING_CONST("compileexecuted = true\nerror(\"executed\")\n"));
+	EXPECT_EQ(lua_compile_bytecode(STRING_ARGS(failing), LUACOMPILE_DEVELOPMENT, &bytecode, &size), 0);
+	EXPECT_GT(size, 0);
+	EXPECT_EQ(((const char*)bytecode)[0], 0x1B);
+	memory_deallocate(bytecode);
+
+	bytecode = nullptr;
+	string_const_t invalid = string_const(STRING_CONST("local function ("));
+	EXPECT_LT(lua_compile_bytecode(STRING_ARGS(invalid), LUACOMPILE_DEVELOPMENT, &bytecode, &size), 0);
+	EXPECT_EQ(bytecode, 0);
+
+	//Throughput on a corpus of generated scripts, compared to a fresh state executing each script
+	const int scripts = 256;
+	const int functions = 64;
+	char buffer[256];
+	string_t* corpus = nullptr;
+	size_t corpus_size = 0;
+	for (int iscript = 0; iscript < scripts; ++iscript) {
+		const size_t capacity = 16384;
+		string_t script = string_allocate(0, capacity);
+		script = string_append(STRING_ARGS(script), capacity, STRING_CONST("local M = {}\n"));
+		for (int ifunc = 0; ifunc < functions; ++ifunc) {
+			string_t line = string_format(buffer, sizeof(buffer), STRING_CONST(
+			    "function M.f%d(a, b)\n\tlocal t = { a = a, b = b, n = %d }\n"
+			    "\tif a > b then return t.a * %d else return t.b + M.f%d(b, a) end\nend\n"),
+			    ifunc, iscript, ifunc, ifunc ? ifunc - 1 : 0);
+			script = string_append(STRING_ARGS(script), capacity, STRING_ARGS(line));
+		}
+		script = string_append(STRING_ARGS(script), capacity, STRING_CONST("return M\n"));
+		corpus_size += script.length;
+		array_push(corpus, script);
+	}
+
+	tick_t start = time_current();
+	for (int iscript = 0; iscript < scripts; ++iscript) {
+		EXPECT_EQ(lua_compile_bytecode(STRING_ARGS(corpus[iscript]), LUACOMPILE_DEVELOPMENT, &bytecode, &size), 0);
+		memory_deallocate(bytecode);
+	}
+	deltatime_t compiled = time_ticks_to_seconds(time_diff(start, time_current()));
+
+	start = time_current();
+	for (int iscript = 0; iscript < scripts; ++iscript) {
+		lua_t* env = lua_allocate();
+		EXPECT_EQ(lua_eval_string(env, STRING_ARGS(corpus[iscript])), LUA_OK);
+		lua_deallocate(env);
+	}
+	deltatime_t executed = time_ticks_to_seconds(time_diff(start, time_current()));
+
+	log_infof(HASH_LUA, STRING_CONST("Compiled %d scripts (%" PRIsize " bytes) in %.2fms, %.1fMiB/s "
+	                                 "(state per script with execution: %.2fms)"),
+	          scripts, corpus_size, compiled * 1000.0,
+	          compiled > 0 ? ((double)corpus_size / (1024.0 * 1024.0)) / compiled : 0.0, executed * 1000.0);
+
+	for (int iscript = 0; iscript < scripts; ++iscript)
+		string_deallocate(corpus[iscript].str);
+	array_deallocate(corpus);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, compilejobs) {
+	const uuid_t uuids[] = {LUA_FOUNDATION_UUID, LUA_NETWORK_UUID, LUA_RESOURCE_UUID, LUA_WINDOW_UUID};
+	const size_t count = sizeof(uuids) / sizeof(uuids[0]);
+	lua_compile_job_t jobs[sizeof(uuids) / sizeof(uuids[0])];
+	deltatime_t elapsed[2];
+	deltatime_t serial = 0;
+
+	//Serial and parallel compilation of the same resources
+	for (int ipass = 0; ipass < 2; ++ipass) {
+		memset(jobs, 0, sizeof(jobs));
+		for (size_t ijob = 0; ijob < count; ++ijob) {
+			jobs[ijob].uuid = uuids[ijob];
+			jobs[ijob].platform = lua_resource_platform();
+		}
+		tick_t start = time_current();
+		EXPECT_EQ(lua_compile_jobs(jobs, count, ipass ? 0 : 1), count);
+		elapsed[ipass] = time_ticks_to_seconds(time_diff(start, time_current()));
+		for (size_t ijob = 0; ijob < count; ++ijob) {
+			EXPECT_TRUE(jobs[ijob].success);
+			EXPECT_GT(jobs[ijob].time, 0);
+			if (ipass)
+				serial += jobs[ijob].time;
+		}
+	}
+
+	log_infof(HASH_LUA, STRING_CONST("Compiled %" PRIsize " resources: %.2fms serial, %.2fms parallel "
+	                                 "(%.2fms summed job time)"),
+	          count, elapsed[0] * 1000.0, elapsed[1] * 1000.0, serial * 1000.0);
+
+	//Compiled resources still load
+	lua_t* env = lua_allocate();
+	EXPECT_NE(env, 0);
+	lua_module_cache_invalidate(LUA_FOUNDATION_UUID);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("assert(require(\"foundation\").log ~= nil)")), LUA_OK);
+	lua_deallocate(env);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, compilecache) {
+	string_t path = path_allocate_concat(STRING_ARGS(environment_temporary_directory()),
+	                                     STRING_CONST("lua_compilecache"));
+	fs_remove_directory(STRING_ARGS(path));
+
+	//Cold cache compiles and stores artifacts
+	lua_compile_cache_set_path(STRING_ARGS(path));
+	lua_compile_cache_statistics_t before = lua_compile_cache_statistics();
+	EXPECT_TRUE(resource_compile(LUA_FOUNDATION_UUID, lua_resource_platform()));
+	lua_compile_cache_statistics_t cold = lua_compile_cache_statistics();
+	EXPECT_GT(cold.misses, before.misses);
+	EXPECT_EQ(cold.hits, before.hits);
+	EXPECT_EQ(cold.stores - before.stores, cold.misses - before.misses);
+	EXPECT_TRUE(fs_is_directory(STRING_ARGS(path)));
+
+	//Unchanged source is served from the cache
+	EXPECT_TRUE(resource_compile(LUA_FOUNDATION_UUID, lua_resource_platform()));
+	lua_compile_cache_statistics_t warm = lua_compile_cache_statistics();
+	EXPECT_EQ(warm.hits - cold.hits, cold.misses - before.misses);
+	EXPECT_EQ(warm.misses, cold.misses);
+	EXPECT_EQ(warm.stores, cold.stores);
+
+	log_infof(HASH_LUA, STRING_CONST("Compile cache: %" PRIsize " hits, %" PRIsize " misses, %.2fms saved"),
+	          warm.hits, warm.misses, warm.time_saved * 1000.0);
+
+	//Resource compiled from cache still loads
+	lua_t* env = lua_allocate();
+	EXPECT_NE(env, 0);
+	lua_module_cache_invalidate(LUA_FOUNDATION_UUID);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("assert(require(\"foundation\").log ~= nil)")), LUA_OK);
+	lua_deallocate(env);
+
+	lua_compile_cache_set_path(nullptr, 0);
+	EXPECT_EQ(lua_compile_cache_path().length, 0);
+	fs_remove_directory(STRING_ARGS(path));
+	string_deallocate(path.str);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, compileprofile) {
+	void* bytecode[LUACOMPILE_PROFILE_COUNT];
+	size_t size[LUACOMPILE_PROFILE_COUNT];
+	lua_compile_report_t report;
+
+	string_const_t source = string_const(STRING_CONST(
+	    "local function accumulate(values, scale)\n"
+	    "\tlocal total = 0\n"
+	    "\tfor index, value in ipairs(values) do total = total + value * scale end\n"
+	    "\treturn total\n"
+	    "end\n"
+	    "profileresult = (profileresult or 0) + accumulate({1, 2, 3}, 2)\n"));
+
+	//Release profile strips debug info
+	for (int profile = 0; profile < LUACOMPILE_PROFILE_COUNT; ++profile)
+		EXPECT_EQ(lua_compile_bytecode(STRING_ARGS(source), (lua_compile_profile_t)profile,
+		                               bytecode + profile, size + profile), 0);
+	EXPECT_LT(size[LUACOMPILE_RELEASE], size[LUACOMPILE_DEVELOPMENT]);
+
+	EXPECT_EQ(lua_compile_report(STRING_ARGS(source), &report), 0);
+	EXPECT_EQ(report.size[LUACOMPILE_DEVELOPMENT], size[LUACOMPILE_DEVELOPMENT]);
+	EXPECT_EQ(report.size[LUACOMPILE_RELEASE], size[LUACOMPILE_RELEASE]);
+	log_infof(HASH_LUA, STRING_CONST("Bytecode development %" PRIsize " bytes %.3fms load, "
+	                                 "release %" PRIsize " bytes %.3fms load"),
+	          report.size[LUACOMPILE_DEVELOPMENT], report.load_time[LUACOMPILE_DEVELOPMENT] * 1000.0,
+	          report.size[LUACOMPILE_RELEASE], report.load_time[LUACOMPILE_RELEASE] * 1000.0);
+
+	//Stripped and unstripped chunks run side by side in one state
+	lua_t* env = lua_allocate();
+	EXPECT_NE(env, 0);
+	for (int profile = 0; profile < LUACOMPILE_PROFILE_COUNT; ++profile) {
+		EXPECT_EQ(lua_eval_string(env, bytecode[profile], size[profile]), LUA_OK);
+		memory_deallocate(bytecode[profile]);
+	}
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("assert(profileresult == 24)")), LUA_OK);
+
+	//Most specific platform profile applies
+	uint64_t platform = lua_resource_platform();
+	EXPECT_EQ(lua_compile_profile(platform), LUACOMPILE_DEVELOPMENT);
+	lua_compile_set_profile(RESOURCE_PLATFORM_ALL, LUACOMPILE_RELEASE);
+	EXPECT_EQ(lua_compile_profile(platform), LUACOMPILE_RELEASE);
+	lua_compile_set_profile(platform, LUACOMPILE_DEVELOPMENT);
+	EXPECT_EQ(lua_compile_profile(platform), LUACOMPILE_DEVELOPMENT);
+
+	//Stripped resource module loads next to unstripped modules
+	lua_compile_set_profile(platform, LUACOMPILE_RELEASE);
+	EXPECT_TRUE(resource_compile(LUA_FOUNDATION_UUID, platform));
+	lua_module_cache_invalidate(LUA_FOUNDATION_UUID);
+	EXPECT_EQ(lua_eval_string(env, STRING_CONST("assert(require(\"foundation\").log ~= nil)\n"
+	                                            "assert(require(\"resource\") ~= nil)")), LUA_OK);
+	lua_deallocate(env);
+
+	lua_compile_set_profile(RESOURCE_PLATFORM_ALL, LUACOMPILE_DEVELOPMENT);
+	lua_compile_set_profile(platform, LUACOMPILE_DEVELOPMENT);
+	EXPECT_TRUE(resource_compile(LUA_FOUNDATION_UUID, platform));
+	lua_module_cache_invalidate(LUA_FOUNDATION_UUID);
+
+	return 0;
+}
+
+DECLARE_TEST(lua, import) {
+	const size_t count = 2000;
+	string_t root = path_allocate_concat(STRING_ARGS(environment_temporary_directory()),
+	                                     STRING_CONST("lua_import"));
+	string_t scripts = path_allocate_concat(STRING_ARGS(root), STRING_CONST("script"));
+	string_t sources = path_allocate_concat(STRING_ARGS(root), STRING_CONST("source"));
+	string_t mappath = path_allocate_concat(STRING_ARGS(root), STRING_CONST("import.map"));
+	fs_remove_directory(STRING_ARGS(root));
+	EXPECT_TRUE(fs_make_directory(STRING_ARGS(scripts)));
+	EXPECT_TRUE(fs_make_directory(STRING_ARGS(sources)));
+
+	//Own import map and source tree keep generated scripts out of the test resources
+	stream_t* stream = stream_open(STRING_ARGS(mappath), STREAM_OUT | STREAM_CREATE | STREAM_TRUNCATE);
+	EXPECT_NE(stream, 0);
+	stream_deallocate(stream);
+
+	string_t* paths = nullptr;
+	lua_import_job_t* jobs = nullptr;
+	for (size_t ifile = 0; ifile < count; ++ifile) {
+		char name[32];
+		string_t filename = string_format(name, sizeof(name), STRING_CONST("module%04" PRIsize ".lua"), ifile);
+		string_t path = path_allocate_concat(STRING_ARGS(scripts), STRING_ARGS(filename));
+		stream = stream_open(STRING_ARGS(path), STREAM_OUT | STREAM_CREATE | STREAM_TRUNCATE);
+		EXPECT_NE(stream, 0);
+		for (size_t iline = 0; iline <= ifile % 64; ++iline)
+			stream_write_format(stream, STRING_CONST("local value%" PRIsize " = %" PRIsize "\n"), iline, ifile);
+		stream_write_string(stream, STRING_CONST("return value0\n"));
+		stream_deallocate(stream);
+
+		lua_import_job_t job;
+		memset(&job, 0, sizeof(job));
+		job.path = string_const(STRING_ARGS(path));
+		array_push(jobs, job);
+		array_push(paths, path);
+	}
+
+	string_const_t source_path = resource_source_path();
+	string_t saved_source_path = string_clone(STRING_ARGS(source_path));
+	resource_source_set_path(STRING_ARGS(sources));
+
+	tick_t start = time_current();
+	EXPECT_EQ(lua_import_jobs(jobs, count, 0), count);
+	deltatime_t elapsed = time_ticks_to_seconds(time_diff(start, time_current()));
+
+	size_t bytes = 0;
+	for (size_t ifile = 0; ifile < count; ++ifile) {
+		EXPECT_TRUE(jobs[ifile].success);
+		bytes += jobs[ifile].size;
+	}
+	log_infof(HASH_LUA, STRING_CONST("Imported %" PRIsize " files (%" PRIsize " bytes) in %.2fms, %.0f files/s"),
+	          count, bytes, elapsed * 1000.0, elapsed > 0 ? (double)count / elapsed : 0.0);
+
+	//Single pass signature matches a separate digest of the file, source blob holds the whole file
+	for (size_t ifile = 0; ifile < count; ifile += 97) {
+		resource_signature_t signature = resource_import_lookup(STRING_ARGS(jobs[ifile].path));
+		EXPECT_FALSE(uuid_is_null(signature.uuid));
+		stream = stream_open(STRING_ARGS(jobs[ifile].path), STREAM_IN);
+		EXPECT_TRUE(uint256_equal(signature.sig, stream_sha256(stream)));
+		stream_deallocate(stream);
+
+		resource_source_t source;
+		resource_source_initialize(&source);
+		EXPECT_TRUE(resource_source_read(&source, signature.uuid));
+		resource_change_t* change = resource_source_get(&source, HASH_SOURCE, 0);
+		EXPECT_NE(change, 0);
+		EXPECT_EQ(change->value.blob.size, jobs[ifile].size);
+		resource_source_finalize(&source);
+	}
+
+	//Directories are collected recursively, only .lua files are imported
+	const char* treefiles[] = {"tree/first.lua", "tree/sub/second.lua", "tree/readme.txt", "tree/sub/third.luac"};
+	for (size_t ifile = 0; ifile < sizeof(treefiles) / sizeof(treefiles[0]); ++ifile) {
+		string_t path = path_allocate_concat(STRING_ARGS(root), treefiles[ifile], string_length(treefiles[ifile]));
+		string_const_t directory = path_directory_name(STRING_ARGS(path));
+		EXPECT_TRUE(fs_make_directory(STRING_ARGS(directory)));
+		stream = stream_open(STRING_ARGS(path), STREAM_OUT | STREAM_CREATE | STREAM_TRUNCATE);
+		EXPECT_NE(stream, 0);
+		stream_write_string(stream, STRING_CONST("return true\n"));
+		stream_deallocate(stream);
+		string_deallocate(path.str);
+	}
+	string_t tree = path_allocate_concat(STRING_ARGS(root), STRING_CONST("tree"));
+	string_t* treepaths = nullptr;
+	lua_import_job_t* treejobs = nullptr;
+	EXPECT_EQ(lua_import_collect(STRING_ARGS(tree), &treejobs, &treepaths), 2);
+	EXPECT_EQ(array_size(treepaths), 2);
+	for (size_t ijob = 0; ijob < array_size(treejobs); ++ijob)
+		EXPECT_TRUE(string_ends_with(STRING_ARGS(treejobs[ijob].path), STRING_CONST(".lua")));
+	EXPECT_EQ(lua_import_collect(STRING_ARGS(paths[0]), &treejobs, &treepaths), 1);
+	EXPECT_EQ(array_size(treepaths), 2);
+	EXPECT_EQ(lua_import_jobs(treejobs, array_size(treejobs), 0), 3);
+	string_array_deallocate(treepaths);
+	array_deallocate(treejobs);
+	string_deallocate(tree.str);
+
+	resource_source_set_path(STRING_ARGS(saved_source_path));
+	string_deallocate(saved_source_path.str);
+	fs_remove_directory(STRING_ARGS(root));
+	string_array_deallocate(paths);
+	array_deallocate(jobs);
+	string_deallocate(mappath.str);
+	string_deallocate(sources.str);
+	string_deallocate(scripts.str);
+	string_deallocate(root.str);
+
+	return 0;
+}
+
+static void
+test_lua_declare(void) {
+	ADD_TEST(lua, heap);
+	ADD_TEST(lua, profile);
+	ADD_TEST(lua, template);
+	ADD_TEST(lua, libraries);
+	ADD_TEST(lua, subenv);
+	ADD_TEST(lua, modulecache);
+	ADD_TEST(lua, mapped);
+	ADD_TEST(lua, moduleindex);
+	ADD_TEST(lua, modulemap);
+	ADD_TEST(lua, lazymodule);
+	ADD_TEST(lua, prefetch);
+	ADD_TEST(lua, reloadall);
+	ADD_TEST(lua, reloadpatch);
+	ADD_TEST(lua, reloadbatch);
+	ADD_TEST(lua, modulegraph);
+	ADD_TEST(lua, evalcache);
+	ADD_TEST(lua, bundle);
+	ADD_TEST(lua, archive);
+	ADD_TEST(lua, embedded);
+	ADD_TEST(lua, compress);
+	ADD_TEST(lua, compile);
+	ADD_TEST(lua, compilejobs);
+	ADD_TEST(lua, compilecache);
+	ADD_TEST(lua, compileprofile);
+	ADD_TEST(lua, import);
+}
+
+static test_suite_t test_lua_suite = {
+	test_lua_application,
+	test_lua_memory_system,
+	test_lua_config,
+	test_lua_declare,
+	test_lua_initialize,
+	test_lua_finalize,
+	test_lua_event
+};
+
+#if BUILD_MONOLITHIC
+
+int
+test_lua_run(void);
+
+int
+test_lua_run(void) {
+	test_suite = test_lua_suite;
+	return test_run_all();
+}
+
+#else
+
+test_suite_t
+test_suite_define(void);
+
+test_suite_t
+test_suite_define(void) {
+	return test_lua_suite;
+}
+
+#endif
@@ -21,3 +21,5 @@
 #define LUA_RESULT_UNABLE_TO_LOAD_JITLIB_BC       -3
 #define LUA_RESULT_FAILED_EVAL                    -4
 #define LUA_RESULT_ABORTED                        -5
+#define LUA_RESULT_UNABLE_TO_OPEN_HEAP_FILE       -6
+#define LUA_RESULT_UNABLE_TO_OPEN_PROFILE_FILE    -7
@@ -30,6 +30,9 @@ typedef struct lua_instance_t lua_instance_t;
 struct lua_instance_t {
 	string_const_t* config_files;
 	string_t        input_file;
+	string_t        heap_file;
+	string_t        heap_diff[2];
+	string_t        profile_file;
 	lua_t*          env;
 	mutex_t*        lock;
 	error_level_t   suppress_level;
@@ -55,6 +58,15 @@ _lua_process_file(lua_t* lua, const char* filename, size_t length);
 static void
 _lua_process_resource_event(lua_t* lua, mutex_t* lock, const event_t* event);
 
+static int
+_lua_write_heap(lua_t* lua, const char* filename, size_t length);
+
+static int
+_lua_diff_heap(const string_t* files);
+
+static int
+_lua_write_profile(lua_t* lua, const char* filename, size_t length);
+
 static int
 _lua_interpreter(lua_t* lua, mutex_t* lock);
 
@@ -125,7 +137,13 @@ event_thread(void* arg) {
 		event_process_system();
 		event_process_fs();
 		event_process_resource(instance->env, instance->lock);
-		thread_wait();
+
+		//Reloads are coalesced, wake up again when the quiet period has passed
+		unsigned int wait = lua_event_process_reloads(false);
+		if (wait)
+			thread_try_wait(wait);
+		else
+			thread_wait();
 	}
 
 	return 0;
@@ -169,6 +187,7 @@ main_initialize(void) {
 
 	lua_config_t lua_config;
 	memset(&lua_config, 0, sizeof(lua_config_t));
+	lua_config.reload_delay = BUILD_LUA_RELOAD_DELAY;
 	if ((ret = lua_module_initialize(lua_config)) < 0)
 		return ret;
 
@@ -187,6 +206,17 @@ main_run(void* main_arg) {
 	log_set_suppress(0, instance.suppress_level);
 	log_set_suppress(HASH_SCRIPT, ERRORLEVEL_NONE);
 
+	if (instance.heap_diff[0].length) {
+		result = _lua_diff_heap(instance.heap_diff);
+		string_deallocate(instance.heap_diff[0].str);
+		string_deallocate(instance.heap_diff[1].str);
+		string_deallocate(instance.heap_file.str);
+		string_deallocate(instance.profile_file.str);
+		string_deallocate(instance.input_file.str);
+		array_deallocate(instance.config_files);
+		return result;
+	}
+
 	thread_initialize(&eventthread, event_thread, &instance, STRING_CONST("event_thread"),
 	                  THREAD_PRIORITY_NORMAL, 0);
 	thread_start(&eventthread);
@@ -199,6 +229,9 @@ main_run(void* main_arg) {
 
 	instance.env = lua_allocate();
 
+	if (instance.profile_file.length)
+		lua_profile_allocation_begin(instance.env, 0);
+
 	if (instance.input_file.length) {
 		result = _lua_process_file(instance.env, STRING_ARGS(instance.input_file));
 	}
@@ -207,12 +240,20 @@ main_run(void* main_arg) {
 		result = _lua_interpreter(instance.env, instance.lock);
 	}
 
+	if (instance.profile_file.length && (result == LUA_RESULT_OK))
+		result = _lua_write_profile(instance.env, STRING_ARGS(instance.profile_file));
+
+	if (instance.heap_file.length && (result == LUA_RESULT_OK))
+		result = _lua_write_heap(instance.env, STRING_ARGS(instance.heap_file));
+
 	_lua_terminate();
 	thread_signal(&eventthread);
 
 	lua_deallocate(instance.env);
 	mutex_deallocate(instance.lock);
 	string_deallocate(instance.input_file.str);
+	string_deallocate(instance.heap_file.str);
+	string_deallocate(instance.profile_file.str);
 	array_deallocate(instance.config_files);
 
 	thread_finalize(&eventthread);
@@ -380,6 +421,65 @@ exit:
 	return result;
 }
 
+static int
+_lua_write_heap(lua_t* lua, const char* filename, size_t length) {
+	int result = LUA_RESULT_OK;
+	lua_heap_snapshot_t* snapshot = lua_heap_snapshot(lua);
+	stream_t* stream = stream_open(filename, length, STREAM_OUT | STREAM_CREATE | STREAM_TRUNCATE);
+	if (!snapshot || !stream || !lua_heap_snapshot_write(snapshot, stream)) {
+		log_errorf(HASH_LUA, ERROR_SYSTEM_CALL_FAIL, STRING_CONST("Unable to write heap snapshot: %.*s"),
+		           (int)length, filename);
+		result = LUA_RESULT_UNABLE_TO_OPEN_HEAP_FILE;
+	}
+	else {
+		lua_heap_snapshot_log(snapshot, 20);
+	}
+	stream_deallocate(stream);
+	lua_heap_snapshot_deallocate(snapshot);
+	return result;
+}
+
+static int
+_lua_diff_heap(const string_t* files) {
+	int result = LUA_RESULT_OK;
+	lua_heap_snapshot_t* snapshot[2] = {0, 0};
+	for (int ifile = 0; ifile < 2; ++ifile) {
+		stream_t* stream = stream_open(STRING_ARGS(files[ifile]), STREAM_IN);
+		snapshot[ifile] = lua_heap_snapshot_read(stream);
+		stream_deallocate(stream);
+		if (!snapshot[ifile]) {
+			log_errorf(HASH_LUA, ERROR_INVALID_VALUE, STRING_CONST("Unable to read heap snapshot: %.*s"),
+			           STRING_FORMAT(files[ifile]));
+			result = LUA_RESULT_UNABLE_TO_OPEN_HEAP_FILE;
+		}
+	}
+	if (result == LUA_RESULT_OK) {
+		lua_heap_snapshot_t* diff = lua_heap_snapshot_diff(snapshot[0], snapshot[1]);
+		lua_heap_snapshot_log(diff, 0);
+		lua_heap_snapshot_deallocate(diff);
+	}
+	lua_heap_snapshot_deallocate(snapshot[0]);
+	lua_heap_snapshot_deallocate(snapshot[1]);
+	return result;
+}
+
+static int
+_lua_write_profile(lua_t* lua, const char* filename, size_t length) {
+	int result = LUA_RESULT_OK;
+	lua_profile_allocation_end(lua);
+	stream_t* stream = stream_open(filename, length, STREAM_OUT | STREAM_CREATE | STREAM_TRUNCATE);
+	if (!stream || !lua_profile_allocation_write(lua, stream)) {
+		log_errorf(HASH_LUA, ERROR_SYSTEM_CALL_FAIL, STRING_CONST("Unable to write allocation profile: %.*s"),
+		           (int)length, filename);
+		result = LUA_RESULT_UNABLE_TO_OPEN_PROFILE_FILE;
+	}
+	else {
+		lua_profile_allocation_log(lua, 20);
+	}
+	stream_deallocate(stream);
+	return result;
+}
+
 static lua_instance_t
 _lua_parse_command_line(const string_const_t* cmdline) {
 	unsigned int arg, asize;
@@ -396,6 +496,29 @@ _lua_parse_command_line(const string_const_t* cmdline) {
 			if (arg < asize - 1)
 				array_push(instance.config_files, cmdline[++arg]);
 		}
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--heap"))) {
+			if (arg < asize - 1) {
+				string_deallocate(instance.heap_file.str);
+				++arg;
+				instance.heap_file = string_clone(STRING_ARGS(cmdline[arg]));
+			}
+		}
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--heap-diff"))) {
+			if (arg < asize - 2) {
+				string_deallocate(instance.heap_diff[0].str);
+				string_deallocate(instance.heap_diff[1].str);
+				instance.heap_diff[0] = string_clone(STRING_ARGS(cmdline[arg + 1]));
+				instance.heap_diff[1] = string_clone(STRING_ARGS(cmdline[arg + 2]));
+				arg += 2;
+			}
+		}
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--profile-alloc"))) {
+			if (arg < asize - 1) {
+				string_deallocate(instance.profile_file.str);
+				++arg;
+				instance.profile_file = string_clone(STRING_ARGS(cmdline[arg]));
+			}
+		}
 		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--help")))
 			display_help = true;
 		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--debug")))
@@ -428,13 +551,17 @@ _lua_print_usage(void) {
 	log_set_suppress(HASH_LUA, ERRORLEVEL_DEBUG);
 	log_info(HASH_LUA, STRING_CONST(
 	             "lua usage:\n"
-	             "  lua [--config <path> ...] [--help] [file] [--]\n"
+	             "  lua [--config <path> ...] [--heap <file>] [--heap-diff <file> <file>] [--profile-alloc <file>]\n"
+	             "      [--help] [file] [--]\n"
 	             "    Optional arguments:\n"
-	             "      --config <file>  Read and parse config file given by <path>\n"
-	             "                       Loads all .json/.sjson files in <path> if it is a directory\n"
-	             "      --help           Show this message\n"
-	             "      <file>           Read <file> instead of stdin\n"
-	             "      --               Stop processing command line arguments"
+	             "      --config <file>            Read and parse config file given by <path>\n"
+	             "                                 Loads all .json/.sjson files in <path> if it is a directory\n"
+	             "      --heap <file>              Write heap snapshot to <file> when done\n"
+	             "      --heap-diff <file> <file>  Show difference between two heap snapshots and exit\n"
+	             "      --profile-alloc <file>     Sample allocations and write folded call stacks to <file>\n"
+	             "      --help                     Show this message\n"
+	             "      <file>                     Read <file> instead of stdin\n"
+	             "      --                         Stop processing command line arguments"
 	         ));
 	log_set_suppress(HASH_LUA, ERRORLEVEL_INFO);
 }
@@ -21,9 +21,14 @@
 
 typedef struct {
 	bool              display_help;
+	bool              report;
 	int               binary;
-	uint64_t          platform;
+	int               profile;
+	unsigned int      jobs;
+	uint64_t*         platforms;
 	string_const_t    source_path;
+	string_const_t    cache_path;
+	string_const_t    archive_path;
 	string_const_t*   config_files;
 	string_const_t*   input_files;
 } luacompile_input_t;
@@ -39,6 +44,9 @@ luacompile_parse_command_line(const string_const_t* cmdline);
 static void
 luacompile_print_usage(void);
 
+static bool
+luacompile_report(const uuid_t uuid, uint64_t platform, string_const_t file, lua_compile_report_t* total);
+
 int
 main_initialize(void) {
 	int ret = 0;
@@ -72,6 +80,16 @@ main_initialize(void) {
 		return ret;
 	if ((ret = network_module_initialize(network_config)) < 0)
 		return ret;
+
+	//Module config must be set before initialization
+	const string_const_t* cmdline = environment_command_line();
+	for (size_t arg = 1, asize = array_size(cmdline); arg < asize; ++arg) {
+		if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--compress")))
+			lua_config.compress_resources = true;
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--")))
+			break;
+	}
+
 	if ((ret = resource_module_initialize(resource_config)) < 0)
 		return ret;
 	if ((ret = lua_module_initialize(lua_config)) < 0)
@@ -108,11 +126,20 @@ main_run(void* main_arg) {
 		goto exit;
 	}
 
+	if (input.cache_path.length)
+		lua_compile_cache_set_path(STRING_ARGS(input.cache_path));
+
+	if (input.profile >= 0) {
+		for (size_t iplat = 0, psize = array_size(input.platforms); iplat < psize; ++iplat)
+			lua_compile_set_profile(input.platforms[iplat], (lua_compile_profile_t)input.profile);
+	}
+
 	resource_compile_clear();
 	resource_compile_clear_path();
 
 	resource_compile_register(lua_compile);
 
+	lua_compile_job_t* jobs = nullptr;
 	size_t ifile, fsize;
 	for (ifile = 0, fsize = array_size(input.input_files); ifile < fsize; ++ifile) {
 		uuid_t uuid = string_to_uuid(STRING_ARGS(input.input_files[ifile]));
@@ -130,24 +157,104 @@ main_run(void* main_arg) {
 			break;
 		}
 
-		if (resource_compile(uuid, input.platform)) {
-			string_const_t uuidstr = string_from_uuid_static(uuid);
-			log_infof(HASH_RESOURCE, STRING_CONST("Successfully compiled: %.*s (%.*s)"),
-			          STRING_FORMAT(uuidstr), STRING_FORMAT(input.input_files[ifile]));
+		for (size_t iplat = 0, psize = array_size(input.platforms); iplat < psize; ++iplat) {
+			lua_compile_job_t job;
+			memset(&job, 0, sizeof(job));
+			job.uuid = uuid;
+			job.platform = input.platforms[iplat];
+			array_push(jobs, job);
+		}
+	}
+
+	if (result == LUACOMPILE_RESULT_OK) {
+		tick_t start = time_current();
+		size_t compiled = lua_compile_jobs(jobs, array_size(jobs), input.jobs);
+		deltatime_t elapsed = time_ticks_to_seconds(time_diff(start, time_current()));
+
+		deltatime_t serial = 0;
+		size_t platforms = array_size(input.platforms);
+		for (size_t ijob = 0, jsize = array_size(jobs); ijob < jsize; ++ijob) {
+			string_const_t uuidstr = string_from_uuid_static(jobs[ijob].uuid);
+			string_const_t file = input.input_files[ijob / platforms];
+			serial += jobs[ijob].time;
+			if (jobs[ijob].success) {
+				log_infof(HASH_RESOURCE, STRING_CONST("Successfully compiled: %.*s (%.*s) platform %" PRIx64 " in %.2fms"),
+				          STRING_FORMAT(uuidstr), STRING_FORMAT(file), jobs[ijob].platform, jobs[ijob].time * 1000.0);
+			}
+			else {
+				log_errorf(HASH_RESOURCE, ERROR_UNSUPPORTED, STRING_CONST("Failed to compile: %.*s (%.*s) platform %" PRIx64),
+				           STRING_FORMAT(uuidstr), STRING_FORMAT(file), jobs[ijob].platform);
+				result = LUACOMPILE_RESULT_COMPILE_FAILED;
+			}
+		}
+
+		log_infof(HASH_RESOURCE, STRING_CONST("Compiled %" PRIsize " of %" PRIsize " resources in %.2fms wall clock, "
+		                                      "%.2fms summed compile time (%.1fx)"),
+		          compiled, array_size(jobs), elapsed * 1000.0, serial * 1000.0, elapsed > 0 ? serial / elapsed : 0.0);
+
+		if (input.cache_path.length) {
+			lua_compile_cache_statistics_t cache = lua_compile_cache_statistics();
+			size_t lookups = cache.hits + cache.misses;
+			log_infof(HASH_RESOURCE, STRING_CONST("Compile cache: %" PRIsize " hits, %" PRIsize " misses (%.1f%% hit rate), "
+			                                      "%" PRIsize " stored, %.2fms saved"),
+			          cache.hits, cache.misses, lookups ? (100.0 * (double)cache.hits) / (double)lookups : 0.0,
+			          cache.stores, cache.time_saved * 1000.0);
+		}
+	}
+
+	if ((result == LUACOMPILE_RESULT_OK) && input.archive_path.length) {
+		uuid_t* uuids = nullptr;
+		uint64_t* platforms = nullptr;
+		for (size_t ijob = 0, jsize = array_size(jobs); ijob < jsize; ++ijob) {
+			array_push(uuids, jobs[ijob].uuid);
+			array_push(platforms, jobs[ijob].platform);
+		}
+		stream_t* stream = stream_open(STRING_ARGS(input.archive_path),
+		                               STREAM_OUT | STREAM_CREATE | STREAM_TRUNCATE | STREAM_BINARY);
+		if (stream && lua_archive_write(stream, uuids, platforms, array_size(uuids))) {
+			log_infof(HASH_RESOURCE, STRING_CONST("Wrote archive of %" PRIsize " modules: %.*s (%" PRIsize " bytes)"),
+			          array_size(uuids), STRING_FORMAT(input.archive_path), stream_size(stream));
 		}
 		else {
-			string_const_t uuidstr = string_from_uuid_static(uuid);
-			log_errorf(HASH_RESOURCE, ERROR_UNSUPPORTED, STRING_CONST("Failed to compile: %.*s (%.*s)"),
-			          STRING_FORMAT(uuidstr), STRING_FORMAT(input.input_files[ifile]));
+			log_errorf(HASH_RESOURCE, ERROR_SYSTEM_CALL_FAIL, STRING_CONST("Failed to write archive: %.*s"),
+			           STRING_FORMAT(input.archive_path));
 			result = LUACOMPILE_RESULT_COMPILE_FAILED;
-			break;
+		}
+		stream_deallocate(stream);
+		array_deallocate(uuids);
+		array_deallocate(platforms);
+	}
+
+	if ((result == LUACOMPILE_RESULT_OK) && input.report) {
+		lua_compile_report_t total;
+		memset(&total, 0, sizeof(total));
+		size_t platforms = array_size(input.platforms);
+		for (size_t ijob = 0, jsize = array_size(jobs); ijob < jsize; ijob += platforms)
+			luacompile_report(jobs[ijob].uuid, jobs[ijob].platform, input.input_files[ijob / platforms], &total);
+		log_infof(HASH_RESOURCE, STRING_CONST("Total: development %" PRIsize " bytes %.3fms load, "
+		                                      "release %" PRIsize " bytes %.3fms load (%.1f%% size)"),
+		          total.size[LUACOMPILE_DEVELOPMENT], total.load_time[LUACOMPILE_DEVELOPMENT] * 1000.0,
+		          total.size[LUACOMPILE_RELEASE], total.load_time[LUACOMPILE_RELEASE] * 1000.0,
+		          total.size[LUACOMPILE_DEVELOPMENT] ?
+		          (100.0 * (double)total.size[LUACOMPILE_RELEASE]) / (double)total.size[LUACOMPILE_DEVELOPMENT] : 0.0);
+		for (int profile = 0; profile < LUACOMPILE_PROFILE_COUNT; ++profile) {
+			log_infof(HASH_RESOURCE, STRING_CONST("Total %s compressed: %" PRIsize " bytes (%.1f%% size), "
+			                                      "%.3fms decompress (%.0f MiB/s)"),
+			          (profile == LUACOMPILE_RELEASE) ? "release" : "development", total.compressed_size[profile],
+			          total.size[profile] ? (100.0 * (double)total.compressed_size[profile]) / (double)total.size[profile] : 0.0,
+			          total.decompress_time[profile] * 1000.0,
+			          (total.decompress_time[profile] > 0) ?
+			          ((double)total.size[profile] / (1024.0 * 1024.0)) / total.decompress_time[profile] : 0.0);
 		}
 	}
 
+	array_deallocate(jobs);
+
 exit:
 
 	array_deallocate(input.config_files);
 	array_deallocate(input.input_files);
+	array_deallocate(input.platforms);
 
 	return result;
 }
@@ -160,6 +267,50 @@ main_finalize(void) {
 	foundation_finalize();
 }
 
+static bool
+luacompile_report(const uuid_t uuid, uint64_t platform, string_const_t file, lua_compile_report_t* total) {
+	lua_compile_report_t report;
+	resource_source_t source;
+	bool success = false;
+
+	resource_source_initialize(&source);
+	if (resource_source_read(&source, uuid)) {
+		resource_change_t* change = resource_source_get(&source, HASH_SOURCE, platform);
+		if (change && (change->flags & RESOURCE_SOURCEFLAG_BLOB) && change->value.blob.size) {
+			size_t size = change->value.blob.size;
+			void* blob = memory_allocate(HASH_RESOURCE, size, 0, MEMORY_PERSISTENT);
+			if (resource_source_read_blob(uuid, HASH_SOURCE, change->platform, change->value.blob.checksum,
+			                              blob, size))
+				success = (lua_compile_report(blob, size, &report) == 0);
+			memory_deallocate(blob);
+		}
+	}
+	resource_source_finalize(&source);
+
+	if (!success) {
+		log_warnf(HASH_RESOURCE, WARNING_INVALID_VALUE, STRING_CONST("Unable to report: %.*s"),
+		          STRING_FORMAT(file));
+		return false;
+	}
+
+	log_infof(HASH_RESOURCE, STRING_CONST("%.*s: development %" PRIsize " bytes %.3fms load, "
+	                                      "release %" PRIsize " bytes %.3fms load"),
+	          STRING_FORMAT(file), report.size[LUACOMPILE_DEVELOPMENT], report.load_time[LUACOMPILE_DEVELOPMENT] * 1000.0,
+	          report.size[LUACOMPILE_RELEASE], report.load_time[LUACOMPILE_RELEASE] * 1000.0);
+	log_infof(HASH_RESOURCE, STRING_CONST("%.*s: compressed development %" PRIsize " bytes %.3fms decompress, "
+	                                      "release %" PRIsize " bytes %.3fms decompress"),
+	          STRING_FORMAT(file), report.compressed_size[LUACOMPILE_DEVELOPMENT],
+	          report.decompress_time[LUACOMPILE_DEVELOPMENT] * 1000.0, report.compressed_size[LUACOMPILE_RELEASE],
+	          report.decompress_time[LUACOMPILE_RELEASE] * 1000.0);
+	for (int profile = 0; profile < LUACOMPILE_PROFILE_COUNT; ++profile) {
+		total->size[profile] += report.size[profile];
+		total->load_time[profile] += report.load_time[profile];
+		total->compressed_size[profile] += report.compressed_size[profile];
+		total->decompress_time[profile] += report.decompress_time[profile];
+	}
+	return true;
+}
+
 static void
 luacompile_parse_config(const char* path, size_t path_size,
                         const char* buffer, size_t size,
@@ -175,8 +326,7 @@ luacompile_parse_command_line(const string_const_t* cmdline) {
 
 	error_context_push(STRING_CONST("parse command line"), STRING_CONST(""));
 	memset(&input, 0, sizeof(input));
-
-	input.platform = RESOURCE_PLATFORM_ALL;
+	input.profile = -1;
 
 	for (arg = 1, asize = array_size(cmdline); arg < asize; ++arg) {
 		if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--help")))
@@ -185,6 +335,14 @@ luacompile_parse_command_line(const string_const_t* cmdline) {
 			if (arg < asize - 1)
 				input.source_path = cmdline[++arg];
 		}
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--archive"))) {
+			if (arg < asize - 1)
+				input.archive_path = cmdline[++arg];
+		}
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--cache"))) {
+			if (arg < asize - 1)
+				input.cache_path = cmdline[++arg];
+		}
 		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--config"))) {
 			if (arg < asize - 1)
 				array_push(input.config_files, cmdline[++arg]);
@@ -192,9 +350,27 @@ luacompile_parse_command_line(const string_const_t* cmdline) {
 		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--platform"))) {
 			if (arg < asize - 1) {
 				++arg;
-				input.platform = resource_platform_parse(STRING_ARGS(cmdline[arg]));
+				array_push(input.platforms, resource_platform_parse(STRING_ARGS(cmdline[arg])));
+			}
+		}
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--jobs"))) {
+			if (arg < asize - 1) {
+				++arg;
+				input.jobs = string_to_uint(STRING_ARGS(cmdline[arg]), false);
+			}
+		}
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--profile"))) {
+			if (arg < asize - 1) {
+				++arg;
+				input.profile = (int)lua_compile_profile_parse(STRING_ARGS(cmdline[arg]));
 			}
 		}
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--compress"))) {
+			//Handled before module initialization
+		}
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--report"))) {
+			input.report = true;
+		}
 		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--binary"))) {
 			input.binary = 1;
 		}
@@ -216,6 +392,9 @@ luacompile_parse_command_line(const string_const_t* cmdline) {
 	}
 	error_context_pop();
 
+	if (!array_size(input.platforms))
+		array_push(input.platforms, RESOURCE_PLATFORM_ALL);
+
 	if (!array_size(input.input_files)) {
 		log_errorf(HASH_RESOURCE, ERROR_INVALID_VALUE, STRING_CONST("No input files given"));
 		input.display_help = true;
@@ -230,15 +409,26 @@ luacompile_print_usage(void) {
 	log_set_suppress(0, ERRORLEVEL_DEBUG);
 	log_info(0, STRING_CONST(
 	             "luacompile usage:\n"
-	             "  luacompile [--source <path>] [--config <path> ...] [--platform <decl>] [--ascii] [--binary]\n"
-	             "             [--debug] [--help] <file> <uuid> ... [--]\n"
+	             "  luacompile [--source <path>] [--cache <path>] [--archive <path>] [--config <path> ...]\n"
+	             "             [--platform <decl> ...] [--jobs <n>] [--profile <name>] [--compress] [--report]\n"
+	             "             [--ascii] [--binary] [--debug] [--help] <file> <uuid> ... [--]\n"
 	             "    Arguments:\n"
 	             "      <file> <uuid> ...            Any number of input files or UUIDs\n"
 	             "    Optional arguments:\n"
 	             "      --source <path>              Operate on resource file source structure given by <path>\n"
+	             "      --archive <path>             Pack all compiled modules in a single archive file <path>\n"
+	             "      --cache <path>               Reuse and store compiled bytecode in compile cache directory <path>,\n"
+	             "                                   skipping compilation of unchanged sources\n"
 	             "      --config <file>              Read and parse config file given by <path>\n"
 	             "                                   Loads all .json/.sjson files in <path> if it is a directory\n"
-	             "      --platform <decl>            Compile for given target platform declaration\n"
+	             "      --platform <decl>            Compile for given target platform declaration, can be repeated\n"
+	             "      --jobs <n>                   Compile on <n> threads (default number of hardware threads,\n"
+	             "                                   1 for serial compilation)\n"
+	             "      --profile <name>             Compile with profile <name> for given platforms, \"release\" strips\n"
+	             "                                   debug info and \"development\" keeps it (default from config)\n"
+	             "      --compress                   Write compressed bytecode, decompressed on load\n"
+	             "      --report                     Report bytecode size, load time and compressed size of each\n"
+	             "                                   file in both profiles\n"
 	             "      --binary                     Write binary files\n"
 	             "      --ascii                      Write ASCII files (default)\n"
 	             "      --debug                      Enable debug output\n"
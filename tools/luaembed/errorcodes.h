@@ -0,0 +1,22 @@
+/* errorcodes.h  -  Lua library embedder  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#pragma once
+
+//Error codes returned by luaembed tool
+#define LUAEMBED_RESULT_OK                             0
+#define LUAEMBED_RESULT_COMPILE_FAILED                -1
+#define LUAEMBED_RESULT_INVALID_ARGUMENTS             -2
+#define LUAEMBED_RESULT_UNABLE_TO_OPEN_INPUT_FILE     -3
+#define LUAEMBED_RESULT_UNABLE_TO_OPEN_OUTPUT_FILE    -4
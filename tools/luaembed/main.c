@@ -0,0 +1,349 @@
+/* main.c  -  Lua library embedder  -  Public Domain  -  2017 Mattias Jansson / Rampant Pixels
+ *
+ * This library provides a cross-platform lua library in C11 for games and applications
+ * based on out foundation library. The latest source code is always available at
+ *
+ * https://github.com/rampantpixels/lua_lib
+ *
+ * This library is put in the public domain; you can redistribute it and/or modify it without
+ * any restrictions.
+ *
+ * The LuaJIT library is released under the MIT license. For more information about LuaJIT, see
+ * http://luajit.org/
+ */
+
+#include <foundation/foundation.h>
+#include <network/network.h>
+#include <resource/resource.h>
+#include <lua/lua.h>
+
+#include "errorcodes.h"
+
+typedef struct {
+	bool              display_help;
+	int               profile;
+	string_const_t    output_file;
+	string_const_t*   input_files;
+} luaembed_input_t;
+
+typedef struct {
+	uuid_t            uuid;
+	string_const_t    name;
+	void*             bytecode;
+	size_t            size;
+	string_t          script;
+	uint256_t         source;
+} luaembed_module_t;
+
+static luaembed_input_t
+luaembed_parse_command_line(const string_const_t* cmdline);
+
+static void
+luaembed_print_usage(void);
+
+static int
+luaembed_compile(string_const_t file, lua_compile_profile_t profile, luaembed_module_t* module);
+
+static string_const_t
+luaembed_script_path(string_const_t path);
+
+static int
+luaembed_write(string_const_t path, const char* variant, lua_compile_profile_t profile,
+               const luaembed_module_t* modules, size_t count);
+
+int
+main_initialize(void) {
+	int ret = 0;
+	application_t application;
+	foundation_config_t foundation_config;
+	resource_config_t resource_config;
+	network_config_t network_config;
+	lua_config_t lua_config;
+
+	memset(&foundation_config, 0, sizeof(foundation_config));
+	memset(&resource_config, 0, sizeof(resource_config));
+	memset(&network_config, 0, sizeof(network_config));
+	memset(&lua_config, 0, sizeof(lua_config));
+
+	memset(&application, 0, sizeof(application));
+	application.name = string_const(STRING_CONST("luaembed"));
+	application.short_name = string_const(STRING_CONST("luaembed"));
+	application.company = string_const(STRING_CONST("Rampant Pixels"));
+	application.flags = APPLICATION_UTILITY;
+
+	log_enable_prefix(false);
+	log_set_suppress(0, ERRORLEVEL_WARNING);
+
+	resource_config.enable_local_source = true;
+
+	//Modules are compiled from their scripts, never loaded
+	lua_config.disable_embedded_modules = true;
+
+	if ((ret = foundation_initialize(memory_system_malloc(), application, foundation_config)) < 0)
+		return ret;
+	if ((ret = network_module_initialize(network_config)) < 0)
+		return ret;
+	if ((ret = resource_module_initialize(resource_config)) < 0)
+		return ret;
+	if ((ret = lua_module_initialize(lua_config)) < 0)
+		return ret;
+
+	log_set_suppress(HASH_RESOURCE, ERRORLEVEL_INFO);
+	log_set_suppress(HASH_LUA, ERRORLEVEL_INFO);
+
+	return 0;
+}
+
+int
+main_run(void* main_arg) {
+	int result = LUAEMBED_RESULT_OK;
+	luaembed_input_t input = luaembed_parse_command_line(environment_command_line());
+	luaembed_module_t* modules = nullptr;
+
+	FOUNDATION_UNUSED(main_arg);
+
+	if (input.display_help) {
+		luaembed_print_usage();
+		result = LUAEMBED_RESULT_INVALID_ARGUMENTS;
+		goto exit;
+	}
+
+	lua_compile_profile_t profile = (input.profile >= 0) ? (lua_compile_profile_t)input.profile :
+	                                LUACOMPILE_DEVELOPMENT;
+	for (size_t ifile = 0, fsize = array_size(input.input_files); ifile < fsize; ++ifile) {
+		luaembed_module_t module;
+		result = luaembed_compile(input.input_files[ifile], profile, &module);
+		if (result != LUAEMBED_RESULT_OK)
+			break;
+		array_push(modules, module);
+	}
+
+	//Bytecode of LuaJIT builds with and without two-slot frame info is not interchangeable,
+	//each build of this tool generates the variant of the LuaJIT it links
+	if (result == LUAEMBED_RESULT_OK)
+		result = luaembed_write(input.output_file, lua_is_fr2() ? "fr2" : "compat", profile,
+		                        modules, array_size(modules));
+
+exit:
+
+	for (size_t imod = 0, msize = array_size(modules); imod < msize; ++imod) {
+		memory_deallocate(modules[imod].bytecode);
+		string_deallocate(modules[imod].script.str);
+	}
+	array_deallocate(modules);
+	array_deallocate(input.input_files);
+
+	return result;
+}
+
+void
+main_finalize(void) {
+	lua_module_finalize();
+	resource_module_finalize();
+	network_module_finalize();
+	foundation_finalize();
+}
+
+static int
+luaembed_compile(string_const_t file, lua_compile_profile_t profile, luaembed_module_t* module) {
+	char buffer[BUILD_MAX_PATHLEN];
+	string_t pathstr = string_copy(buffer, sizeof(buffer), STRING_ARGS(file));
+	pathstr = path_clean(STRING_ARGS(pathstr), sizeof(buffer));
+	pathstr = path_absolute(STRING_ARGS(pathstr), sizeof(buffer));
+
+	memset(module, 0, sizeof(luaembed_module_t));
+	module->uuid = resource_import_lookup(STRING_ARGS(pathstr)).uuid;
+	module->name = path_base_file_name(STRING_ARGS(file));
+	if (uuid_is_null(module->uuid)) {
+		log_errorf(HASH_RESOURCE, ERROR_INVALID_VALUE, STRING_CONST("Failed to lookup: %.*s"),
+		           STRING_FORMAT(file));
+		return LUAEMBED_RESULT_INVALID_ARGUMENTS;
+	}
+
+	stream_t* stream = stream_open(STRING_ARGS(pathstr), STREAM_IN | STREAM_BINARY);
+	if (!stream) {
+		log_errorf(HASH_RESOURCE, ERROR_INVALID_VALUE, STRING_CONST("Unable to open input file: %.*s"),
+		           STRING_FORMAT(file));
+		return LUAEMBED_RESULT_UNABLE_TO_OPEN_INPUT_FILE;
+	}
+	size_t size = stream_size(stream);
+	void* source = memory_allocate(HASH_LUA, size, 0, MEMORY_PERSISTENT);
+	bool read = (stream_read(stream, source, size) == size);
+	module->source = stream_sha256(stream);
+	stream_deallocate(stream);
+
+	string_const_t script = luaembed_script_path(string_to_const(pathstr));
+	module->script = string_clone(STRING_ARGS(script));
+	if (!script.length)
+		log_warnf(HASH_RESOURCE, WARNING_INVALID_VALUE, STRING_CONST("No import map for script, embedded module is not checked for changes: %.*s"),
+		          STRING_FORMAT(file));
+
+	int result = LUAEMBED_RESULT_OK;
+	if (!read || (lua_compile_bytecode(source, size, profile, &module->bytecode, &module->size) < 0)) {
+		log_errorf(HASH_RESOURCE, ERROR_INVALID_VALUE, STRING_CONST("Failed to compile: %.*s"),
+		           STRING_FORMAT(file));
+		result = LUAEMBED_RESULT_COMPILE_FAILED;
+	}
+	else {
+		string_const_t uuidstr = string_from_uuid_static(module->uuid);
+		log_infof(HASH_RESOURCE, STRING_CONST("Compiled: %.*s (%.*s) %" PRIsize " bytes"),
+		          STRING_FORMAT(uuidstr), STRING_FORMAT(file), module->size);
+	}
+	memory_deallocate(source);
+	return result;
+}
+
+//Path relative to the directory of the import map, matching the import base path at runtime
+static string_const_t
+luaembed_script_path(string_const_t path) {
+	char buffer[BUILD_MAX_PATHLEN];
+	string_const_t directory = path_directory_name(STRING_ARGS(path));
+	while (directory.length) {
+		string_t mappath = path_concat(buffer, sizeof(buffer), STRING_ARGS(directory), STRING_CONST("import.map"));
+		if (fs_is_file(STRING_ARGS(mappath)))
+			return path_subpath(STRING_ARGS(path), STRING_ARGS(directory));
+		string_const_t parent = path_directory_name(STRING_ARGS(directory));
+		if (parent.length >= directory.length)
+			break;
+		directory = parent;
+	}
+	return string_empty();
+}
+
+static int
+luaembed_write(string_const_t path, const char* variant, lua_compile_profile_t profile,
+               const luaembed_module_t* modules, size_t count) {
+	char buffer[256];
+	string_t line;
+
+	stream_t* stream = stream_open(STRING_ARGS(path), STREAM_OUT | STREAM_CREATE | STREAM_TRUNCATE);
+	if (!stream) {
+		log_errorf(HASH_RESOURCE, ERROR_INVALID_VALUE, STRING_CONST("Unable to open output file: %.*s"),
+		           STRING_FORMAT(path));
+		return LUAEMBED_RESULT_UNABLE_TO_OPEN_OUTPUT_FILE;
+	}
+
+	stream_write_string(stream, STRING_CONST("#pragma once\n\n"
+	                    "/* ****** AUTOMATICALLY GENERATED, DO NOT EDIT ******\n"
+	                    "    Edit the built-in module scripts in resource/script\n"
+	                    "    and rerun the luaembed tool to update this file */\n\n"));
+	line = string_format(buffer, sizeof(buffer), STRING_CONST("//Bytecode for states with%s FR2, %s profile"),
+	                     lua_is_fr2() ? "" : "out", (profile == LUACOMPILE_RELEASE) ? "release" : "development");
+	stream_write_string(stream, STRING_ARGS(line));
+	stream_write_endl(stream);
+
+	for (size_t imod = 0; imod < count; ++imod) {
+		const uint8_t* bytecode = modules[imod].bytecode;
+		line = string_format(buffer, sizeof(buffer), STRING_CONST("\nstatic const uint8_t lua_embedded_%s_%.*s[] = {"),
+		                     variant, STRING_FORMAT(modules[imod].name));
+		stream_write_string(stream, STRING_ARGS(line));
+		stream_write_endl(stream);
+		for (size_t offset = 0; offset < modules[imod].size; offset += 16) {
+			size_t length = 0;
+			buffer[length++] = '\t';
+			for (size_t ibyte = offset; (ibyte < offset + 16) && (ibyte < modules[imod].size); ++ibyte)
+				length += string_format(buffer + length, sizeof(buffer) - length, STRING_CONST("0x%02x, "),
+				                        bytecode[ibyte]).length;
+			stream_write_string(stream, buffer, length - 1);
+			stream_write_endl(stream);
+		}
+		stream_write_string(stream, STRING_CONST("};\n"));
+	}
+
+	line = string_format(buffer, sizeof(buffer), STRING_CONST("\nstatic const lua_embedded_module_t lua_embedded_%s[] = {"),
+	                     variant);
+	stream_write_string(stream, STRING_ARGS(line));
+	stream_write_endl(stream);
+	for (size_t imod = 0; imod < count; ++imod) {
+		line = string_format(buffer, sizeof(buffer), STRING_CONST("\t{{0x%016" PRIx64 "ULL, 0x%016" PRIx64 "ULL}, "
+		                                                          "sizeof(lua_embedded_%s_%.*s), lua_embedded_%s_%.*s,"),
+		                     modules[imod].uuid.word[0], modules[imod].uuid.word[1],
+		                     variant, STRING_FORMAT(modules[imod].name), variant, STRING_FORMAT(modules[imod].name));
+		stream_write_string(stream, STRING_ARGS(line));
+		stream_write_endl(stream);
+		//Digest and path let the library detect scripts changed after this header was generated
+		const uint256_t source = modules[imod].source;
+		line = string_format(buffer, sizeof(buffer), STRING_CONST("\t {0x%016" PRIx64 "ULL, 0x%016" PRIx64 "ULL, 0x%016" PRIx64
+		                                                          "ULL, 0x%016" PRIx64 "ULL}, \"%.*s\"},"),
+		                     source.word[0], source.word[1], source.word[2], source.word[3],
+		                     STRING_FORMAT(modules[imod].script));
+		stream_write_string(stream, STRING_ARGS(line));
+		stream_write_endl(stream);
+	}
+	stream_write_string(stream, STRING_CONST("};\n"));
+
+	log_infof(HASH_RESOURCE, STRING_CONST("Wrote %" PRIsize " modules: %.*s"), count, STRING_FORMAT(path));
+	stream_deallocate(stream);
+	return LUAEMBED_RESULT_OK;
+}
+
+static luaembed_input_t
+luaembed_parse_command_line(const string_const_t* cmdline) {
+	luaembed_input_t input;
+	size_t arg, asize;
+
+	error_context_push(STRING_CONST("parse command line"), STRING_CONST(""));
+	memset(&input, 0, sizeof(input));
+	input.profile = -1;
+
+	for (arg = 1, asize = array_size(cmdline); arg < asize; ++arg) {
+		if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--help")))
+			input.display_help = true;
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--output"))) {
+			if (arg < asize - 1)
+				input.output_file = cmdline[++arg];
+		}
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--profile"))) {
+			if (arg < asize - 1) {
+				++arg;
+				input.profile = (int)lua_compile_profile_parse(STRING_ARGS(cmdline[arg]));
+			}
+		}
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--debug"))) {
+			log_set_suppress(0, ERRORLEVEL_NONE);
+			log_set_suppress(HASH_RESOURCE, ERRORLEVEL_NONE);
+			log_set_suppress(HASH_LUA, ERRORLEVEL_NONE);
+		}
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--")))
+			break; //Stop parsing cmdline options
+		else {
+			array_push(input.input_files, cmdline[arg]);
+		}
+	}
+	error_context_pop();
+
+	if (!input.output_file.length) {
+		log_errorf(HASH_RESOURCE, ERROR_INVALID_VALUE, STRING_CONST("No output file given"));
+		input.display_help = true;
+	}
+
+	if (!array_size(input.input_files)) {
+		log_errorf(HASH_RESOURCE, ERROR_INVALID_VALUE, STRING_CONST("No input files given"));
+		input.display_help = true;
+	}
+
+	return input;
+}
+
+static void
+luaembed_print_usage(void) {
+	const error_level_t saved_level = log_suppress(0);
+	log_set_suppress(0, ERRORLEVEL_DEBUG);
+	log_info(0, STRING_CONST(
+	             "luaembed usage:\n"
+	             "  luaembed --output <file> [--profile <name>] [--debug] [--help] <file> ... [--]\n"
+	             "    Compiles the given imported scripts and writes their bytecode as static data in a\n"
+	             "    C header for linking into the library. Run luaembed for lua/embedded_fr2.h and\n"
+	             "    luaembed32 for lua/embedded_compat.h\n"
+	             "    Arguments:\n"
+	             "      <file> ...                   Any number of script files imported in the resource system\n"
+	             "      --output <file>              Write the generated header to <file>\n"
+	             "    Optional arguments:\n"
+	             "      --profile <name>             Compile with profile <name>, \"release\" strips debug info\n"
+	             "                                   and \"development\" keeps it (default development)\n"
+	             "      --debug                      Enable debug output\n"
+	             "      --help                       Display this help message\n"
+	             "      --                           Stop processing command line arguments"
+	         ));
+	log_set_suppress(0, saved_level);
+}
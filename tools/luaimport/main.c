@@ -23,6 +23,7 @@
 typedef struct {
 	bool              display_help;
 	int               binary;
+	unsigned int      jobs;
 	string_const_t    source_path;
 	string_const_t*   config_files;
 	string_const_t*   input_files;
@@ -104,21 +105,40 @@ main_run(void* main_arg) {
 
 	lua_symbol_load_foundation();
 
+	//Directories are imported recursively
+	lua_import_job_t* jobs = nullptr;
+	string_t* paths = nullptr;
 	size_t ifile, fsize;
-	for (ifile = 0, fsize = array_size(input.input_files); ifile < fsize; ++ifile) {
-		log_infof(HASH_RESOURCE, STRING_CONST("Importing: %.*s"),
-		          STRING_FORMAT(input.input_files[ifile]));
-		if (resource_import(STRING_ARGS(input.input_files[ifile]), uuid_null())) {
-			log_infof(HASH_RESOURCE, STRING_CONST("Successfully imported: %.*s"),
-			          STRING_FORMAT(input.input_files[ifile]));
+	for (ifile = 0, fsize = array_size(input.input_files); ifile < fsize; ++ifile)
+		lua_import_collect(STRING_ARGS(input.input_files[ifile]), &jobs, &paths);
+
+	tick_t start = time_current();
+	size_t imported = lua_import_jobs(jobs, array_size(jobs), input.jobs);
+	deltatime_t elapsed = time_ticks_to_seconds(time_diff(start, time_current()));
+
+	size_t bytes = 0;
+	for (size_t ijob = 0, jsize = array_size(jobs); ijob < jsize; ++ijob) {
+		if (jobs[ijob].success) {
+			bytes += jobs[ijob].size;
+			log_infof(HASH_RESOURCE, STRING_CONST("Successfully imported: %.*s in %.2fms"),
+			          STRING_FORMAT(jobs[ijob].path), jobs[ijob].time * 1000.0);
 		}
 		else {
 			log_warnf(HASH_RESOURCE, WARNING_UNSUPPORTED, STRING_CONST("Failed to import: %.*s"),
-			          STRING_FORMAT(input.input_files[ifile]));
+			          STRING_FORMAT(jobs[ijob].path));
 			result = LUAIMPORT_RESULT_IMPORT_FAILED;
 		}
 	}
 
+	log_infof(HASH_RESOURCE, STRING_CONST("Imported %" PRIsize " of %" PRIsize " files (%.2f MiB) in %.2fms, "
+	                                      "%.0f files/s, %.1f MiB/s"),
+	          imported, array_size(jobs), (double)bytes / (1024.0 * 1024.0), elapsed * 1000.0,
+	          elapsed > 0 ? (double)imported / elapsed : 0.0,
+	          elapsed > 0 ? ((double)bytes / (1024.0 * 1024.0)) / elapsed : 0.0);
+
+	array_deallocate(jobs);
+	string_array_deallocate(paths);
+
 exit:
 
 	array_deallocate(input.config_files);
@@ -162,6 +182,12 @@ luaimport_parse_command_line(const string_const_t* cmdline) {
 			if (arg < asize - 1)
 				array_push(input.config_files, cmdline[++arg]);
 		}
+		else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--jobs"))) {
+			if (arg < asize - 1) {
+				++arg;
+				input.jobs = string_to_uint(STRING_ARGS(cmdline[arg]), false);
+			}
+		}
 		/*else if (string_equal(STRING_ARGS(cmdline[arg]), STRING_CONST("--uuid"))) {
 			if (arg < asize - 1) {
 				++arg;
@@ -212,14 +238,17 @@ luaimport_print_usage(void) {
 	log_set_suppress(0, ERRORLEVEL_DEBUG);
 	log_info(0, STRING_CONST(
 	             "luaimport usage:\n"
-	             "  luaimport [--source <path>] [--config <path> ...] [--ascii] [--binary]\n"
+	             "  luaimport [--source <path>] [--config <path> ...] [--jobs <n>] [--ascii] [--binary]\n"
 	             "            [--debug] [--help] <file> <file> ... [--]\n"
 	             "    Arguments:\n"
-	             "      <file> <file> ...            Any number of input files\n"
+	             "      <file> <file> ...            Any number of input files or directories, all .lua files in\n"
+	             "                                   directories are imported recursively\n"
 	             "    Optional arguments:\n"
 	             "      --source <path>              Operate on resource file source structure given by <path>\n"
 	             "      --config <file>              Read and parse config file given by <path>\n"
 	             "                                   Loads all .json/.sjson files in <path> if it is a directory\n"
+	             "      --jobs <n>                   Import on <n> threads (default number of hardware threads,\n"
+	             "                                   1 for serial import)\n"
 	             "      --binary                     Write binary files\n"
 	             "      --ascii                      Write ASCII files (default)\n"
 	             "      --debug                      Enable debug output\n"